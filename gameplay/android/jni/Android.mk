@@ -21,6 +21,7 @@ LOCAL_SRC_FILES := \
     AudioSource.cpp \
     BoundingBox.cpp \
     BoundingSphere.cpp \
+    BufferedStream.cpp \
     Bundle.cpp \
     Button.cpp \
     Camera.cpp \
@@ -78,6 +79,7 @@ LOCAL_SRC_FILES := \
     Plane.cpp \
     Platform.cpp \
     PlatformAndroid.cpp \
+    PoolAllocator.cpp \
     Properties.cpp \
     Quaternion.cpp \
     RadioButton.cpp \
@@ -86,6 +88,7 @@ LOCAL_SRC_FILES := \
     Ref.cpp \
     RenderState.cpp \
     RenderTarget.cpp \
+    ResourceCache.cpp \
     Scene.cpp \
     SceneLoader.cpp \
     ScreenDisplayer.cpp \
@@ -100,6 +103,7 @@ LOCAL_SRC_FILES := \
     Texture.cpp \
     Theme.cpp \
     ThemeStyle.cpp \
+    TimeEventWheel.cpp \
     Transform.cpp \
     Vector2.cpp \
     Vector3.cpp \
@@ -158,6 +158,7 @@ private:
 
     AIStateMachine* _stateMachine;
     Node* _node;
+    const char* _internedId;    // Interned copy of the ID, or NULL if the ID changed since it was interned.
     bool _enabled;
     Listener* _listener;
     AIAgent* _next;
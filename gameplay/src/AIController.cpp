@@ -1,13 +1,23 @@
 #include "Base.h"
 #include "AIController.h"
 #include "Game.h"
+#include "Atomic.h"
 
 namespace gameplay
 {
 
+// Default maximum number of agents updated in each batch.
+#define AI_BATCH_SIZE 256
+
+// The batch being updated on this thread, which buffers the messages sent by its agents.
+static GP_THREAD_LOCAL void* __currentBatch = NULL;
+
 AIController::AIController()
-    : _paused(false), _firstMessage(NULL), _firstAgent(NULL)
+    : _paused(false), _updating(false), _elapsedTime(0), _firstMessage(NULL), _lastMessage(NULL),
+      _postedMessages(NULL), _firstAgent(NULL), _batchSize(AI_BATCH_SIZE), _dispatcher(NULL)
 {
+    _pending.firstMessage = NULL;
+    _pending.lastMessage = NULL;
 }
 
 AIController::~AIController()
@@ -39,6 +49,24 @@ void AIController::finalize()
         AIMessage::destroy(temp);
     }
     _firstMessage = NULL;
+    _lastMessage = NULL;
+
+    dropBatchMessages(_pending, NULL);
+    for (size_t i = 0, count = _batches.size(); i < count; ++i)
+    {
+        dropBatchMessages(_batches[i], NULL);
+    }
+
+    message = (AIMessage*)atomicExchangePointer((void* volatile*)&_postedMessages, NULL);
+    while (message)
+    {
+        AIMessage* temp = message;
+        message = message->_next;
+        AIMessage::destroy(temp);
+    }
+
+    // Free the pooled messages
+    AIMessage::clearPool();
 }
 
 void AIController::pause()
@@ -53,43 +81,95 @@ void AIController::resume()
 
 void AIController::sendMessage(AIMessage* message, float delay)
 {
-    if (delay <= 0)
+    GP_ASSERT(message);
+
+    if (_updating)
+    {
+        // Buffer until all agents have been updated, holding the delay in the delivery time.
+        // Each batch has its own buffer, so batches updating on other threads don't share one.
+        Batch* batch = __currentBatch ? (Batch*)__currentBatch : &_pending;
+        message->_deliveryTime = delay;
+        message->_next = NULL;
+        if (batch->lastMessage)
+            batch->lastMessage->_next = message;
+        else
+            batch->firstMessage = message;
+        batch->lastMessage = message;
+    }
+    else if (delay <= 0)
     {
         // Send instantly
-        if (message->getReceiver() == NULL || strlen(message->getReceiver()) == 0)
+        deliverMessage(message);
+    }
+    else
+    {
+        // Queue for later delivery, keeping the queue sorted by delivery time.
+        // Messages sent with the same delay arrive in order, so check the tail first.
+        message->_deliveryTime = Game::getGameTime() + delay;
+        message->_next = NULL;
+        if (!_firstMessage)
         {
-            // Broadcast message to all agents
-            AIAgent* agent = _firstAgent;
-            while (agent)
-            {
-                if (agent->processMessage(message))
-                    break; // message consumed by this agent - stop bubbling
-                agent = agent->_next;
-            }
+            _firstMessage = _lastMessage = message;
+        }
+        else if (message->_deliveryTime >= _lastMessage->_deliveryTime)
+        {
+            _lastMessage->_next = message;
+            _lastMessage = message;
+        }
+        else if (message->_deliveryTime < _firstMessage->_deliveryTime)
+        {
+            message->_next = _firstMessage;
+            _firstMessage = message;
         }
         else
         {
-            // Single recipient
-            AIAgent* agent = findAgent(message->getReceiver());
-            if (agent)
-            {
-                agent->processMessage(message);
-            }
-            else
-            {
-                GP_WARN("Failed to locate AIAgent for message recipient: %s", message->getReceiver());
-            }
+            AIMessage* prevMsg = _firstMessage;
+            while (prevMsg->_next->_deliveryTime <= message->_deliveryTime)
+                prevMsg = prevMsg->_next;
+            message->_next = prevMsg->_next;
+            prevMsg->_next = message;
         }
+    }
+}
 
-        // Delete the message, since it is finished being processed
-        AIMessage::destroy(message);
+void AIController::postMessage(AIMessage* message, float delay)
+{
+    GP_ASSERT(message);
+
+    // Hold the delay in the delivery time until the message is sent.
+    message->_deliveryTime = delay;
+
+    // Push onto the posted message stack. Only update() removes messages, and it
+    // takes the whole stack at once, so a compare and swap of the head is enough.
+    void* head;
+    do
+    {
+        head = _postedMessages;
+        message->_next = (AIMessage*)head;
     }
-    else
+    while (atomicCompareExchangePointer((void* volatile*)&_postedMessages, message, head) != head);
+}
+
+void AIController::sendPostedMessages()
+{
+    AIMessage* message = (AIMessage*)atomicExchangePointer((void* volatile*)&_postedMessages, NULL);
+
+    // The stack holds the most recently posted message first, so reverse it.
+    AIMessage* first = NULL;
+    while (message)
     {
-        // Queue for later delivery
-        if (_firstMessage)
-            message->_next = _firstMessage;
-        _firstMessage = message;
+        AIMessage* next = message->_next;
+        message->_next = first;
+        first = message;
+        message = next;
+    }
+
+    while (first)
+    {
+        message = first;
+        first = message->_next;
+        message->_next = NULL;
+        sendMessage(message, (float)message->_deliveryTime);
     }
 }
 
@@ -98,41 +178,173 @@ void AIController::update(float elapsedTime)
     if (_paused)
         return;
 
-    static Game* game = Game::getInstance();
+    sendPostedMessages();
+
+    // Send all pending messages that have expired (the queue is sorted by delivery time)
+    double gameTime = Game::getGameTime();
+    while (_firstMessage && _firstMessage->getDeliveryTime() <= gameTime)
+    {
+        // Link the message out of our list before sending it (this also deletes it)
+        AIMessage* msg = _firstMessage;
+        _firstMessage = msg->_next;
+        if (!_firstMessage)
+            _lastMessage = NULL;
+        msg->_next = NULL;
+        sendMessage(msg);
+    }
+
+    // Split the enabled agents into batches of consecutive agents.
+    _updateAgents.clear();
+    for (AIAgent* agent = _firstAgent; agent; agent = agent->_next)
+    {
+        if (agent->isEnabled())
+            _updateAgents.push_back(agent);
+    }
+    unsigned int batchCount = ((unsigned int)_updateAgents.size() + _batchSize - 1) / _batchSize;
+    if (_batches.size() < batchCount)
+    {
+        Batch batch;
+        batch.firstMessage = NULL;
+        batch.lastMessage = NULL;
+        _batches.resize(batchCount, batch);
+    }
+
+    // Update all enabled agents
+    _updating = true;
+    _elapsedTime = elapsedTime;
+    if (_dispatcher && batchCount > 0)
+    {
+        _dispatcher->dispatch(this, batchCount);
+    }
+    else
+    {
+        for (unsigned int i = 0; i < batchCount; ++i)
+        {
+            updateBatch(i);
+        }
+    }
+    _updating = false;
+
+    // Sync point: send the messages and state changes in the order of the batches that sent
+    // them, which is the order of the agents, whichever threads updated the batches.
+    // Messages sent from within this loop are delivered immediately.
+    for (unsigned int i = 0; i < batchCount; ++i)
+    {
+        sendBatchMessages(_batches[i]);
+    }
+    sendBatchMessages(_pending);
+}
+
+void AIController::updateBatch(unsigned int index)
+{
+    GP_ASSERT(_updating);
+    GP_ASSERT(index < _batches.size());
+
+    unsigned int first = index * _batchSize;
+    unsigned int last = std::min(first + _batchSize, (unsigned int)_updateAgents.size());
+
+    __currentBatch = &_batches[index];
+    for (unsigned int i = first; i < last; ++i)
+    {
+        // Agents removed during the update are cleared from the list.
+        AIAgent* agent = _updateAgents[i];
+        if (agent)
+            agent->update(_elapsedTime);
+    }
+    __currentBatch = NULL;
+}
 
-    // Send all pending messages that have expired
+void AIController::sendBatchMessages(Batch& batch)
+{
+    while (batch.firstMessage)
+    {
+        AIMessage* msg = batch.firstMessage;
+        batch.firstMessage = msg->_next;
+        if (!batch.firstMessage)
+            batch.lastMessage = NULL;
+        msg->_next = NULL;
+        sendMessage(msg, (float)msg->_deliveryTime);
+    }
+}
+
+void AIController::dropBatchMessages(Batch& batch, AIAgent* agent)
+{
     AIMessage* prevMsg = NULL;
-    AIMessage* msg = _firstMessage;
+    AIMessage* msg = batch.firstMessage;
     while (msg)
     {
-        // If the message delivery time has expired, send it (this also deletes it)
-        if (msg->getDeliveryTime() >= game->getGameTime())
+        AIMessage* next = msg->_next;
+        if (agent == NULL || msg->_target == agent)
         {
-            // Link the message out of our list
             if (prevMsg)
-                prevMsg->_next = msg->_next;
-
-            AIMessage* temp = msg;
-            msg = msg->_next;
-            temp->_next = NULL;
-            sendMessage(temp);
+                prevMsg->_next = next;
+            else
+                batch.firstMessage = next;
+            if (batch.lastMessage == msg)
+                batch.lastMessage = prevMsg;
+            AIMessage::destroy(msg);
         }
         else
         {
             prevMsg = msg;
-            msg = msg->_next;
         }
+        msg = next;
     }
+}
 
-    // Update all enabled agents
-    AIAgent* agent = _firstAgent;
-    while (agent)
-    {
-        if (agent->isEnabled())
-            agent->update(elapsedTime);
+unsigned int AIController::getBatchSize() const
+{
+    return _batchSize;
+}
 
-        agent = agent->_next;
+void AIController::setBatchSize(unsigned int batchSize)
+{
+    GP_ASSERT(!_updating);
+    _batchSize = std::max(batchSize, 1u);
+}
+
+void AIController::setDispatcher(Dispatcher* dispatcher)
+{
+    GP_ASSERT(!_updating);
+    _dispatcher = dispatcher;
+}
+
+void AIController::deliverMessage(AIMessage* message)
+{
+    GP_ASSERT(message);
+
+    if (message->_target)
+    {
+        // Message addressed directly to an agent
+        message->_target->processMessage(message);
+    }
+    else if (message->getReceiver() == NULL || strlen(message->getReceiver()) == 0)
+    {
+        // Broadcast message to all agents
+        AIAgent* agent = _firstAgent;
+        while (agent)
+        {
+            if (agent->processMessage(message))
+                break; // message consumed by this agent - stop bubbling
+            agent = agent->_next;
+        }
     }
+    else
+    {
+        // Single recipient (the receiver ID is interned)
+        AIAgent* agent = findAgentByInternedId(message->_receiver);
+        if (agent)
+        {
+            agent->processMessage(message);
+        }
+        else
+        {
+            GP_WARN("Failed to locate AIAgent for message recipient: %s", message->getReceiver());
+        }
+    }
+
+    // Delete the message, since it is finished being processed
+    AIMessage::destroy(message);
 }
 
 void AIController::addAgent(AIAgent* agent)
@@ -160,6 +372,18 @@ void AIController::removeAgent(AIAgent* agent)
                 _firstAgent = agent->_next;
 
             agent->_next = NULL;
+
+            // Drop any buffered messages addressed directly to this agent.
+            dropBatchMessages(_pending, agent);
+            for (size_t i = 0, count = _batches.size(); i < count; ++i)
+            {
+                dropBatchMessages(_batches[i], agent);
+            }
+
+            // Stop the current update from updating the agent once it is released.
+            if (_updating)
+                std::replace(_updateAgents.begin(), _updateAgents.end(), agent, (AIAgent*)NULL);
+
             agent->release();
             break;
         }
@@ -173,10 +397,39 @@ AIAgent* AIController::findAgent(const char* id) const
 {
     GP_ASSERT(id);
 
+    // Searching must not intern every ID that is searched for, since the IDs are kept until shutdown.
+    const char* internedId = AIMessage::findInternedId(id);
+    if (internedId)
+        return findAgentByInternedId(internedId);
+
+    // The ID has not been interned, so only an agent that has not interned its own ID yet can have it.
+    AIAgent* agent = _firstAgent;
+    while (agent)
+    {
+        if (!agent->_internedId)
+        {
+            agent->_internedId = AIMessage::internId(agent->getId());
+            if (strcmp(agent->_internedId, id) == 0)
+                return agent;
+        }
+        agent = agent->_next;
+    }
+
+    return NULL;
+}
+
+AIAgent* AIController::findAgentByInternedId(const char* id) const
+{
+    GP_ASSERT(id);
+
+    // Interned IDs are compared by address. Agents intern their ID the first time
+    // they are searched for after it changes.
     AIAgent* agent = _firstAgent;
     while (agent)
     {
-        if (strcmp(id, agent->getId()) == 0)
+        if (!agent->_internedId)
+            agent->_internedId = AIMessage::internId(agent->getId());
+        if (agent->_internedId == id)
             return agent;
 
         agent = agent->_next;
@@ -19,6 +19,38 @@ class AIController
 
 public:
 
+    /**
+     * Defines an interface for running the batches of an agent update, for example
+     * on worker threads.
+     *
+     * Batches can only run at the same time if the listeners of the agents, their state
+     * machines and their states are thread safe, and the agents have no script callbacks.
+     * Agents must not be added or removed while batches are running on other threads.
+     *
+     * @script{ignore}
+     */
+    class Dispatcher
+    {
+    public:
+
+        /**
+         * Destructor.
+         */
+        virtual ~Dispatcher() { }
+
+        /**
+         * Runs the batches of an agent update.
+         *
+         * Implementations must call AIController::updateBatch() once for every index
+         * from zero to batchCount - 1, in any order and on any threads, and must
+         * return only once all the batches have finished.
+         *
+         * @param controller The AIController to update.
+         * @param batchCount The number of batches.
+         */
+        virtual void dispatch(AIController* controller, unsigned int batchCount) = 0;
+    };
+
     /**
      * Routes the specified message to its intended recipient(s).
      *
@@ -29,11 +61,33 @@ public:
      * For this reason, AIMessage pointers should NOT be held or explicitly destroyed by any code after
      * they are sent through the AIController.
      *
+     * Messages sent while the AIController is updating its agents are buffered and
+     * sent once all agents have been updated, in the order of the agents that sent them.
+     * This keeps the outcome of a frame independent of the order in which agents are
+     * updated relative to the messages they exchange, and of how the update is split
+     * into batches and threads.
+     *
      * @param message The message to send.
      * @param delay The delay (in milliseconds) to wait before sending the message.
      */
     void sendMessage(AIMessage* message, float delay = 0);
 
+    /**
+     * Posts a message to be sent during the next update of the AIController.
+     *
+     * Unlike sendMessage(), this method can be called from any thread. Posting a message
+     * does not block and does not allocate memory. Messages posted from the same thread
+     * are sent in the order they were posted. The delay starts counting when the message
+     * is sent.
+     *
+     * Once posted, the message is owned by the AIController, as with sendMessage().
+     *
+     * @param message The message to post.
+     * @param delay The delay (in milliseconds) to wait before sending the message.
+     * @script{ignore}
+     */
+    void postMessage(AIMessage* message, float delay = 0);
+
     /**
      * Searches for an AIAgent that is registered with the AIController with the specified ID.
      *
@@ -43,8 +97,53 @@ public:
      */
     AIAgent* findAgent(const char* id) const;
 
+    /**
+     * Returns the maximum number of agents updated in each batch.
+     *
+     * @return The batch size.
+     */
+    unsigned int getBatchSize() const;
+
+    /**
+     * Sets the maximum number of agents updated in each batch (default is 256).
+     *
+     * Agents are split into batches of consecutive agents that are run by the dispatcher.
+     *
+     * @param batchSize The batch size (must be at least one).
+     */
+    void setBatchSize(unsigned int batchSize);
+
+    /**
+     * Sets the dispatcher that runs the batches of each agent update.
+     *
+     * By default, batches run one after another on the thread calling update().
+     *
+     * @param dispatcher The dispatcher, or NULL to run the batches one after another.
+     * @script{ignore}
+     */
+    void setDispatcher(Dispatcher* dispatcher);
+
+    /**
+     * Updates the agents in one batch of the current update.
+     *
+     * This is only called by a Dispatcher. It can be called from any thread.
+     *
+     * @param index The index of the batch.
+     * @script{ignore}
+     */
+    void updateBatch(unsigned int index);
+
 private:
 
+    /**
+     * The messages sent while one batch of agents was updating.
+     */
+    struct Batch
+    {
+        AIMessage* firstMessage;
+        AIMessage* lastMessage;
+    };
+
     /**
      * Constructor.
      */
@@ -96,9 +195,48 @@ private:
 
     void removeAgent(AIAgent* agent);
 
+    /**
+     * Delivers a message to its recipient(s) and destroys it.
+     */
+    void deliverMessage(AIMessage* message);
+
+    /**
+     * Sends the messages that were posted from other threads since the last update.
+     */
+    void sendPostedMessages();
+
+    /**
+     * Sends the messages buffered in a batch in the order they were sent, and empties the batch.
+     */
+    void sendBatchMessages(Batch& batch);
+
+    /**
+     * Destroys the messages in a batch that are addressed directly to the given agent,
+     * or all of them if agent is NULL.
+     */
+    static void dropBatchMessages(Batch& batch, AIAgent* agent);
+
+    /**
+     * Searches for an agent by its interned ID.
+     *
+     * @param id The interned ID, as returned by AIMessage::internId().
+     *
+     * @return The first agent with the ID, or NULL if there is none.
+     */
+    AIAgent* findAgentByInternedId(const char* id) const;
+
     bool _paused;
+    bool _updating;
+    float _elapsedTime;
     AIMessage* _firstMessage;
+    AIMessage* _lastMessage;
+    Batch _pending;
+    AIMessage* volatile _postedMessages;
     AIAgent* _firstAgent;
+    unsigned int _batchSize;
+    Dispatcher* _dispatcher;
+    std::vector<AIAgent*> _updateAgents;
+    std::vector<Batch> _batches;
 
 };
 
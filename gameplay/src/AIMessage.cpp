@@ -1,11 +1,61 @@
 #include "Base.h"
 #include "AIMessage.h"
+#include "Atomic.h"
 
 namespace gameplay
 {
 
+// Maximum number of released messages kept for reuse.
+static const unsigned int AI_MESSAGE_POOL_MAX_SIZE = 4096;
+
+// Released messages available for reuse, linked through AIMessage::_next.
+// Messages can be created and destroyed on any thread, so the pool is locked.
+static AIMessage* __messagePool = NULL;
+static unsigned int __messagePoolSize = 0;
+static volatile long __messagePoolLock = 0;
+
+// Interned agent IDs, in a hash table of chained entries. Each ID is stored once and
+// compared by address, so messages don't copy or compare ID strings.
+struct InternedId
+{
+    InternedId* next;
+    unsigned int hash;
+    char id[1];
+};
+static const unsigned int AGENT_ID_BUCKET_COUNT = 1024;
+static InternedId* __agentIds[AGENT_ID_BUCKET_COUNT];
+static volatile long __agentIdLock = 0;
+
+/**
+ * Hashes an agent ID (32-bit FNV-1a).
+ */
+static unsigned int hashId(const char* id)
+{
+    unsigned int hash = 2166136261u;
+    while (*id)
+    {
+        hash ^= (unsigned char)*id++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * Returns the interned copy of an agent ID, or NULL if it is not interned.
+ * The agent ID lock must be held.
+ */
+static const char* findAgentId(unsigned int hash, const char* id)
+{
+    for (InternedId* entry = __agentIds[hash % AGENT_ID_BUCKET_COUNT]; entry; entry = entry->next)
+    {
+        if (entry->hash == hash && strcmp(entry->id, id) == 0)
+            return entry->id;
+    }
+    return NULL;
+}
+
 AIMessage::AIMessage()
-    : _id(0), _deliveryTime(0), _parameters(NULL), _parameterCount(0), _messageType(MESSAGE_TYPE_CUSTOM), _next(NULL)
+    : _id(0), _sender(""), _receiver(""), _deliveryTime(0), _parameters(NULL), _parameterCount(0), _parameterCapacity(0), _messageType(MESSAGE_TYPE_CUSTOM), _target(NULL), _next(NULL)
 {
 }
 
@@ -16,21 +66,141 @@ AIMessage::~AIMessage()
 
 AIMessage* AIMessage::create(unsigned int id, const char* sender, const char* receiver, unsigned int parameterCount)
 {
-    AIMessage* message = new AIMessage();
+    spinLock(&__messagePoolLock);
+    AIMessage* message = __messagePool;
+    if (message)
+    {
+        __messagePool = message->_next;
+        --__messagePoolSize;
+    }
+    spinUnlock(&__messagePoolLock);
+
+    if (message)
+        message->_next = NULL;
+    else
+        message = new AIMessage();
+
     message->_id = id;
-    message->_sender = sender;
-    message->_receiver = receiver;
+    message->_sender = internId(sender);
+    message->_receiver = internId(receiver);
+    message->_deliveryTime = 0;
+    message->_messageType = MESSAGE_TYPE_CUSTOM;
+    message->_target = NULL;
     message->_parameterCount = parameterCount;
-    if (parameterCount > 0)
+    if (parameterCount > message->_parameterCapacity)
+    {
+        SAFE_DELETE_ARRAY(message->_parameters);
         message->_parameters = new AIMessage::Parameter[parameterCount];
+        message->_parameterCapacity = parameterCount;
+    }
     return message;
 }
 
 void AIMessage::destroy(AIMessage* message)
 {
+    if (!message)
+        return;
+
+    // Release any string parameters and return the message to the pool.
+    for (unsigned int i = 0; i < message->_parameterCount; ++i)
+        message->_parameters[i].clear();
+    message->_parameterCount = 0;
+
+    spinLock(&__messagePoolLock);
+    if (__messagePoolSize < AI_MESSAGE_POOL_MAX_SIZE)
+    {
+        message->_next = __messagePool;
+        __messagePool = message;
+        ++__messagePoolSize;
+        message = NULL;
+    }
+    spinUnlock(&__messagePoolLock);
+
     SAFE_DELETE(message);
 }
 
+void AIMessage::clearPool()
+{
+    spinLock(&__messagePoolLock);
+    AIMessage* message = __messagePool;
+    __messagePool = NULL;
+    __messagePoolSize = 0;
+    spinUnlock(&__messagePoolLock);
+
+    while (message)
+    {
+        AIMessage* next = message->_next;
+        SAFE_DELETE(message);
+        message = next;
+    }
+
+    // No messages or agents refer to the interned IDs anymore.
+    spinLock(&__agentIdLock);
+    for (unsigned int i = 0; i < AGENT_ID_BUCKET_COUNT; ++i)
+    {
+        InternedId* entry = __agentIds[i];
+        while (entry)
+        {
+            InternedId* next = entry->next;
+            delete[] reinterpret_cast<char*>(entry);
+            entry = next;
+        }
+        __agentIds[i] = NULL;
+    }
+    spinUnlock(&__agentIdLock);
+}
+
+const char* AIMessage::internId(const char* id)
+{
+    if (id == NULL || *id == '\0')
+        return "";
+
+    unsigned int hash = hashId(id);
+
+    spinLock(&__agentIdLock);
+    const char* internedId = findAgentId(hash, id);
+    spinUnlock(&__agentIdLock);
+    if (internedId)
+        return internedId;
+
+    // Copy the ID without holding the lock. The copy is dropped if another thread
+    // interned the same ID in the meantime.
+    size_t length = strlen(id);
+    InternedId* entry = reinterpret_cast<InternedId*>(new char[sizeof(InternedId) + length]);
+    entry->hash = hash;
+    memcpy(entry->id, id, length + 1);
+
+    spinLock(&__agentIdLock);
+    internedId = findAgentId(hash, id);
+    if (internedId == NULL)
+    {
+        InternedId*& bucket = __agentIds[hash % AGENT_ID_BUCKET_COUNT];
+        entry->next = bucket;
+        bucket = entry;
+        internedId = entry->id;
+        entry = NULL;
+    }
+    spinUnlock(&__agentIdLock);
+
+    if (entry)
+        delete[] reinterpret_cast<char*>(entry);
+    return internedId;
+}
+
+const char* AIMessage::findInternedId(const char* id)
+{
+    if (id == NULL || *id == '\0')
+        return "";
+
+    unsigned int hash = hashId(id);
+
+    spinLock(&__agentIdLock);
+    const char* internedId = findAgentId(hash, id);
+    spinUnlock(&__agentIdLock);
+
+    return internedId;
+}
+
 unsigned int AIMessage::getId() const
 {
     return _id;
@@ -38,12 +208,12 @@ unsigned int AIMessage::getId() const
 
 const char* AIMessage::getSender() const
 {
-    return _sender.c_str();
+    return _sender;
 }
 
 const char* AIMessage::getReceiver() const
 {
-    return _receiver.c_str();
+    return _receiver;
 }
 
 double AIMessage::getDeliveryTime() const
@@ -4,6 +4,8 @@
 namespace gameplay
 {
 
+class AIAgent;
+
 /**
  * Defines a simple message structure used for passing messages through
  * the AI system.
@@ -44,6 +46,11 @@ public:
      * once a message has been sent through AIController, it is unsafe to use or destroy
      * the message pointer.
      *
+     * Messages are recycled through an internal pool, so creating and destroying
+     * messages at a high rate does not allocate memory once the pool is warm. The
+     * sender and receiver IDs are interned, so each distinct ID is copied only once.
+     * Messages can be created and destroyed on any thread.
+     *
      * @param id The message ID.
      * @param sender AIAgent sender ID (can be empty or null for an anonymous message).
      * @param receiver AIAgent receiver ID (can be empty or null for a broadcast message).
@@ -267,13 +274,41 @@ private:
 
     void clearParameter(unsigned int index);
 
+    /**
+     * Frees all messages held in the message pool and all interned agent IDs.
+     */
+    static void clearPool();
+
+    /**
+     * Returns the interned copy of an agent ID.
+     *
+     * Every call with an equal ID returns the same pointer, so interned IDs can be
+     * compared by address. Interned IDs stay valid until clearPool() is called.
+     *
+     * @param id The agent ID (can be empty or null).
+     *
+     * @return The interned ID.
+     */
+    static const char* internId(const char* id);
+
+    /**
+     * Returns the interned copy of an agent ID without interning it.
+     *
+     * @param id The agent ID (can be empty or null).
+     *
+     * @return The interned ID, or NULL if the ID has not been interned.
+     */
+    static const char* findInternedId(const char* id);
+
     unsigned int _id;
-    std::string _sender;
-    std::string _receiver;
+    const char* _sender;
+    const char* _receiver;
     double _deliveryTime;
     Parameter* _parameters;
     unsigned int _parameterCount;
+    unsigned int _parameterCapacity;
     MessageType _messageType;
+    AIAgent* _target;
     AIMessage* _next;
 
 };
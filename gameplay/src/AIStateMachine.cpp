@@ -118,6 +118,9 @@ void AIStateMachine::sendChangeStateMessage(AIState* newState)
     AIMessage* message = AIMessage::create(0, _agent->getId(), _agent->getId(), 1);
     message->_messageType = AIMessage::MESSAGE_TYPE_STATE_CHANGE;
     message->setString(0, newState->getId());
+
+    // Address the message to our agent directly rather than by id.
+    message->_target = _agent;
     Game::getInstance()->getAIController()->sendMessage(message);
 }
 
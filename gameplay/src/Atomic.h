@@ -0,0 +1,172 @@
+#ifndef ATOMIC_H_
+#define ATOMIC_H_
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#if defined(WIN32)
+#include <windows.h>
+#else
+#include <sched.h>
+#endif
+
+/**
+ * Storage class for variables that have a separate instance on each thread.
+ * Only plain data types with constant initializers can be declared with it.
+ */
+#if defined(_MSC_VER)
+#define GP_THREAD_LOCAL __declspec(thread)
+#else
+#define GP_THREAD_LOCAL __thread
+#endif
+
+namespace gameplay
+{
+
+/**
+ * Atomically adds to a value.
+ *
+ * @param value The value to add to.
+ * @param amount The amount to add.
+ *
+ * @return The value before the addition.
+ * @script{ignore}
+ */
+inline long atomicAdd(volatile long* value, long amount)
+{
+#if defined(_MSC_VER)
+    return _InterlockedExchangeAdd(value, amount);
+#else
+    return __sync_fetch_and_add(value, amount);
+#endif
+}
+
+/**
+ * Atomically adds to a 64-bit value.
+ *
+ * @param value The value to add to.
+ * @param amount The amount to add.
+ *
+ * @return The value before the addition.
+ * @script{ignore}
+ */
+inline long long atomicAdd(volatile long long* value, long long amount)
+{
+#if defined(_MSC_VER)
+    return _InterlockedExchangeAdd64(value, amount);
+#else
+    return __sync_fetch_and_add(value, amount);
+#endif
+}
+
+/**
+ * Atomically sets a value.
+ *
+ * @param value The value to set.
+ * @param newValue The new value.
+ *
+ * @return The previous value.
+ * @script{ignore}
+ */
+inline long atomicExchange(volatile long* value, long newValue)
+{
+#if defined(_MSC_VER)
+    return _InterlockedExchange(value, newValue);
+#else
+    // __sync_lock_test_and_set is only an acquire barrier, so add a full barrier first.
+    __sync_synchronize();
+    return __sync_lock_test_and_set(value, newValue);
+#endif
+}
+
+/**
+ * Atomically sets a pointer.
+ *
+ * @param value The pointer to set.
+ * @param newValue The new pointer.
+ *
+ * @return The previous pointer.
+ * @script{ignore}
+ */
+inline void* atomicExchangePointer(void* volatile* value, void* newValue)
+{
+#if defined(_MSC_VER)
+    return _InterlockedExchangePointer(value, newValue);
+#else
+    __sync_synchronize();
+    return __sync_lock_test_and_set(value, newValue);
+#endif
+}
+
+/**
+ * Atomically sets a pointer if it holds an expected value.
+ *
+ * @param value The pointer to set.
+ * @param newValue The new pointer.
+ * @param comparand The expected pointer.
+ *
+ * @return The previous pointer. The pointer was set if this equals comparand.
+ * @script{ignore}
+ */
+inline void* atomicCompareExchangePointer(void* volatile* value, void* newValue, void* comparand)
+{
+#if defined(_MSC_VER)
+    return _InterlockedCompareExchangePointer(value, newValue, comparand);
+#else
+    return __sync_val_compare_and_swap(value, comparand, newValue);
+#endif
+}
+
+/**
+ * Waits for a spin lock to be released and acquires it.
+ *
+ * A spin lock is a long that is zero when it is released. Spin locks are for
+ * protecting short sections of code that are rarely contended.
+ *
+ * @param lock The lock to acquire.
+ * @script{ignore}
+ */
+inline void spinLock(volatile long* lock)
+{
+    while (atomicExchange(lock, 1) != 0)
+    {
+        // Spin on a plain read so waiting threads don't keep taking the cache line
+        // from the owner, and give up the time slice if the owner is taking long.
+        unsigned int spinCount = 0;
+        while (*lock != 0)
+        {
+#if defined(_MSC_VER)
+            _mm_pause();
+#elif defined(__i386__) || defined(__x86_64__)
+            __builtin_ia32_pause();
+#endif
+            if (++spinCount % 64 == 0)
+            {
+#if defined(WIN32)
+                SwitchToThread();
+#else
+                sched_yield();
+#endif
+            }
+        }
+    }
+}
+
+/**
+ * Releases a spin lock acquired with spinLock().
+ *
+ * @param lock The lock to release.
+ * @script{ignore}
+ */
+inline void spinUnlock(volatile long* lock)
+{
+#if defined(_MSC_VER)
+    _InterlockedExchange(lock, 0);
+#else
+    __sync_lock_release(lock);
+#endif
+}
+
+}
+
+#endif
@@ -1,12 +1,70 @@
 #include "Base.h"
 #include "AudioBuffer.h"
 #include "FileSystem.h"
+#include "ResourceCache.h"
+#include "Atomic.h"
+#ifndef WIN32
+#include <pthread.h>
+#endif
 
 namespace gameplay
 {
 
 // Audio buffer cache
-static std::vector<AudioBuffer*> __buffers;
+static ResourceCache* __bufferCache = NULL;
+
+static ResourceCache* getBufferCache()
+{
+    return ResourceCache::get(&__bufferCache, "AudioBuffer");
+}
+
+// Streamed buffers whose chunks are decoded on the decoding thread
+static std::vector<AudioBuffer*> __decodedBuffers;
+static volatile bool __decodeThreadRunning = false;
+#ifdef WIN32
+static HANDLE __decodeThread = NULL;
+static HANDLE __decodeEvent = NULL;
+static CRITICAL_SECTION __decodedBuffersLock;
+#else
+static pthread_t __decodeThread;
+static pthread_mutex_t __decodedBuffersLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t __decodeRequestLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t __decodeRequestCondition = PTHREAD_COND_INITIALIZER;
+static bool __decodeRequested = false;
+#endif
+
+static void lockDecodedBuffers()
+{
+#ifdef WIN32
+    EnterCriticalSection(&__decodedBuffersLock);
+#else
+    pthread_mutex_lock(&__decodedBuffersLock);
+#endif
+}
+
+static void unlockDecodedBuffers()
+{
+#ifdef WIN32
+    LeaveCriticalSection(&__decodedBuffersLock);
+#else
+    pthread_mutex_unlock(&__decodedBuffersLock);
+#endif
+}
+
+// Wakes the decoding thread to refill the chunk queues.
+static void requestDecoding()
+{
+    if (!__decodeThreadRunning)
+        return;
+#ifdef WIN32
+    SetEvent(__decodeEvent);
+#else
+    pthread_mutex_lock(&__decodeRequestLock);
+    __decodeRequested = true;
+    pthread_cond_signal(&__decodeRequestCondition);
+    pthread_mutex_unlock(&__decodeRequestLock);
+#endif
+}
 
 // Callbacks for loading an ogg file using Stream
 static size_t readStream(void *ptr, size_t size, size_t nmemb, void *datasource)
@@ -38,57 +96,73 @@ static long tellStream(void *datasource)
     return stream->position();
 }
 
-AudioBuffer::AudioBuffer(const char* path, ALuint buffer)
-    : _filePath(path), _alBuffer(buffer)
+AudioBuffer::AudioBuffer(const char* path, ALuint* buffers, bool streamed)
+    : _filePath(path), _streamed(streamed), _fileStream(NULL), _streamStateWav(NULL), _streamStateOgg(NULL), _duration(-1.0f),
+      _streamChunks(NULL), _streamReadChunk(0), _streamWriteChunk(0), _streamChunkCount(0), _streamLock(0),
+      _streamLooped(false), _streamEnded(false)
 {
+    memcpy(_alBufferQueue, buffers, sizeof(_alBufferQueue));
 }
 
 AudioBuffer::~AudioBuffer()
 {
     // Remove the buffer from the cache.
-    unsigned int bufferCount = (unsigned int)__buffers.size();
-    for (unsigned int i = 0; i < bufferCount; i++)
+    if (__bufferCache)
+        __bufferCache->remove(this);
+
+    // Wait for the decoding thread to finish with the stream before closing it.
+    if (_streamChunks)
+        stopDecoding(this);
+    SAFE_DELETE_ARRAY(_streamChunks);
+
+    for (unsigned int i = 0; i < STREAMING_BUFFER_QUEUE_SIZE; i++)
     {
-        if (this == __buffers[i])
+        if (_alBufferQueue[i])
         {
-            __buffers.erase(__buffers.begin() + i);
-            break;
+            AL_CHECK( alDeleteBuffers(1, &_alBufferQueue[i]) );
+            _alBufferQueue[i] = 0;
         }
     }
 
-    if (_alBuffer)
-    {
-        AL_CHECK( alDeleteBuffers(1, &_alBuffer) );
-        _alBuffer = 0;
-    }
+    if (_streamStateOgg)
+        ov_clear(&_streamStateOgg->oggFile);
+    SAFE_DELETE(_streamStateOgg);
+    SAFE_DELETE(_streamStateWav);
+    SAFE_DELETE(_fileStream);
 }
 
-AudioBuffer* AudioBuffer::create(const char* path)
+AudioBuffer* AudioBuffer::create(const char* path, bool streamed)
 {
     GP_ASSERT(path);
 
-    // Search the cache for a stream from this file.
-    unsigned int bufferCount = (unsigned int)__buffers.size();
     AudioBuffer* buffer = NULL;
-    for (unsigned int i = 0; i < bufferCount; i++)
+    std::string key = FileSystem::resolvePath(path);
+    if (!streamed)
     {
-        buffer = __buffers[i];
-        GP_ASSERT(buffer);
-        if (buffer->_filePath.compare(path) == 0)
+        // Search the cache for a buffer loaded from this file. Streamed buffers are not cached.
+        buffer = static_cast<AudioBuffer*>(getBufferCache()->find(key.c_str()));
+        if (buffer)
         {
+            getBufferCache()->use(buffer);
             buffer->addRef();
             return buffer;
         }
     }
 
-    ALuint alBuffer;
+    // Streamed sources keep a queue of buffers that are refilled as they play.
+    ALuint alBuffers[STREAMING_BUFFER_QUEUE_SIZE];
+    memset(alBuffers, 0, sizeof(alBuffers));
+    unsigned int alBufferCount = streamed ? STREAMING_BUFFER_QUEUE_SIZE : 1;
+
+    AudioStreamStateWav* streamStateWav = NULL;
+    AudioStreamStateOgg* streamStateOgg = NULL;
 
     // Load audio data into a buffer.
-    AL_CHECK( alGenBuffers(1, &alBuffer) );
+    AL_CHECK( alGenBuffers(alBufferCount, alBuffers) );
     if (AL_LAST_ERROR())
     {
         GP_ERROR("Failed to create OpenAL buffer; alGenBuffers error: %d", AL_LAST_ERROR());
-        AL_CHECK( alDeleteBuffers(1, &alBuffer) );
+        AL_CHECK( alDeleteBuffers(alBufferCount, alBuffers) );
         return NULL;
     }
     
@@ -111,7 +185,9 @@ AudioBuffer* AudioBuffer::create(const char* path)
     // Check the file format
     if (memcmp(header, "RIFF", 4) == 0)
     {
-        if (!AudioBuffer::loadWav(stream.get(), alBuffer))
+        if (streamed)
+            streamStateWav = new AudioStreamStateWav();
+        if (!AudioBuffer::loadWav(stream.get(), alBuffers[0], streamed, streamStateWav))
         {
             GP_ERROR("Invalid wave file: %s", path);
             goto cleanup;
@@ -119,7 +195,9 @@ AudioBuffer* AudioBuffer::create(const char* path)
     }
     else if (memcmp(header, "OggS", 4) == 0)
     {
-        if (!AudioBuffer::loadOgg(stream.get(), alBuffer))
+        if (streamed)
+            streamStateOgg = new AudioStreamStateOgg();
+        if (!AudioBuffer::loadOgg(stream.get(), alBuffers[0], streamed, streamStateOgg))
         {
             GP_ERROR("Invalid ogg file: %s", path);
             goto cleanup;
@@ -131,20 +209,38 @@ AudioBuffer* AudioBuffer::create(const char* path)
         goto cleanup;
     }
 
-    buffer = new AudioBuffer(path, alBuffer);
+    buffer = new AudioBuffer(path, alBuffers, streamed);
 
-    // Add the buffer to the cache.
-    __buffers.push_back(buffer);
+    if (streamed)
+    {
+        // The stream stays open to decode the file as it plays.
+        buffer->_fileStream = stream.release();
+        buffer->_streamStateWav = streamStateWav;
+        buffer->_streamStateOgg = streamStateOgg;
+
+        // The duration is read now, since the decoding thread owns the decoder from here on.
+        buffer->getDuration();
+        buffer->_streamChunks = new AudioStreamChunk[STREAMING_BUFFER_QUEUE_SIZE];
+        startDecoding(buffer);
+    }
+    else
+    {
+        // Add the buffer to the cache. The audio data is held by OpenAL in CPU memory.
+        ALint size = 0;
+        AL_CHECK( alGetBufferi(alBuffers[0], AL_SIZE, &size) );
+        getBufferCache()->add(key.c_str(), buffer, 0, (size_t)size);
+    }
 
     return buffer;
     
 cleanup:
-    if (alBuffer)
-        AL_CHECK( alDeleteBuffers(1, &alBuffer) );
+    SAFE_DELETE(streamStateWav);
+    SAFE_DELETE(streamStateOgg);
+    AL_CHECK( alDeleteBuffers(alBufferCount, alBuffers) );
     return NULL;
 }
 
-bool AudioBuffer::loadWav(Stream* stream, ALuint buffer)
+bool AudioBuffer::loadWav(Stream* stream, ALuint buffer, bool streamed, AudioStreamStateWav* streamState)
 {
     GP_ASSERT(stream);
 
@@ -275,6 +371,18 @@ bool AudioBuffer::loadWav(Stream* stream, ALuint buffer)
                 return false;
             }
 
+            // Streamed files are decoded later, starting from the current position.
+            if (streamed)
+            {
+                GP_ASSERT(streamState);
+                streamState->dataStart = stream->position();
+                streamState->dataSize = dataSize;
+                streamState->format = format;
+                streamState->frequency = frequency;
+                streamState->blockAlign = channels * bits / 8;
+                return true;
+            }
+
             char* data = new char[dataSize];
             if (stream->read(data, sizeof(char), dataSize) != dataSize)
             {
@@ -330,7 +438,7 @@ bool AudioBuffer::loadWav(Stream* stream, ALuint buffer)
     return false;
 }
 
-bool AudioBuffer::loadOgg(Stream* stream, ALuint buffer)
+bool AudioBuffer::loadOgg(Stream* stream, ALuint buffer, bool streamed, AudioStreamStateOgg* streamState)
 {
     GP_ASSERT(stream);
 
@@ -349,19 +457,30 @@ bool AudioBuffer::loadOgg(Stream* stream, ALuint buffer)
     callbacks.close_func = closeStream;
     callbacks.tell_func = tellStream;
 
-    if ((result = ov_open_callbacks(stream, &ogg_file, NULL, 0, callbacks)) < 0)
+    // Streamed files are decoded in place since the decoder state cannot be copied.
+    GP_ASSERT(!streamed || streamState);
+    OggVorbis_File* file = streamed ? &streamState->oggFile : &ogg_file;
+    if ((result = ov_open_callbacks(stream, file, NULL, 0, callbacks)) < 0)
     {
         GP_ERROR("Failed to open ogg file.");
         return false;
     }
 
-    info = ov_info(&ogg_file, -1);
+    info = ov_info(file, -1);
     GP_ASSERT(info);
     if (info->channels == 1)
         format = AL_FORMAT_MONO16;
     else
         format = AL_FORMAT_STEREO16;
 
+    // Streamed files keep the decoder open and are decoded later in chunks.
+    if (streamed)
+    {
+        streamState->format = format;
+        streamState->rate = info->rate;
+        return true;
+    }
+
     // size = #samples * #channels * 2 (for 16 bit).
     long data_size = ov_pcm_total(&ogg_file, -1) * info->channels * 2;
     char* data = new char[data_size];
@@ -400,4 +519,309 @@ bool AudioBuffer::loadOgg(Stream* stream, ALuint buffer)
     return true;
 }
 
+bool AudioBuffer::streamData(ALuint buffer, bool looped)
+{
+    GP_ASSERT(_streamed && _fileStream && _streamChunks);
+
+    if (looped != _streamLooped)
+    {
+        spinLock(&_streamLock);
+        _streamLooped = looped;
+        if (looped)
+            _streamEnded = false;
+        spinUnlock(&_streamLock);
+    }
+
+    // Decode the chunk here if the decoding thread hasn't got to it yet.
+    if (atomicAdd(&_streamChunkCount, 0) == 0)
+    {
+        decodeChunk();
+        if (atomicAdd(&_streamChunkCount, 0) == 0)
+            return false;
+    }
+
+    // Only this thread takes chunks from the queue, so the chunk stays valid until it is released below.
+    const AudioStreamChunk& chunk = _streamChunks[_streamReadChunk];
+    ALenum format = _streamStateWav ? (ALenum)_streamStateWav->format : _streamStateOgg->format;
+    ALsizei frequency = _streamStateWav ? (ALsizei)_streamStateWav->frequency : (ALsizei)_streamStateOgg->rate;
+    AL_CHECK( alBufferData(buffer, format, chunk.data, chunk.size, frequency) );
+    _streamReadChunk = (_streamReadChunk + 1) % STREAMING_BUFFER_QUEUE_SIZE;
+    atomicAdd(&_streamChunkCount, -1);
+
+    requestDecoding();
+    return true;
+}
+
+bool AudioBuffer::decodeChunk()
+{
+    spinLock(&_streamLock);
+    bool decoded = false;
+    if (!_streamEnded && atomicAdd(&_streamChunkCount, 0) < STREAMING_BUFFER_QUEUE_SIZE)
+    {
+        AudioStreamChunk& chunk = _streamChunks[_streamWriteChunk];
+        chunk.size = decode(chunk.data);
+        if (chunk.size > 0)
+        {
+            // Adding to the count publishes the chunk to the thread that takes it.
+            _streamWriteChunk = (_streamWriteChunk + 1) % STREAMING_BUFFER_QUEUE_SIZE;
+            atomicAdd(&_streamChunkCount, 1);
+            decoded = true;
+        }
+        else
+        {
+            _streamEnded = true;
+        }
+    }
+    spinUnlock(&_streamLock);
+    return decoded;
+}
+
+ALsizei AudioBuffer::decode(char* data)
+{
+    GP_ASSERT(_fileStream);
+
+    ALsizei size = 0;
+    bool rewound = false;
+
+    if (_streamStateWav)
+    {
+        long dataEnd = _streamStateWav->dataStart + (long)_streamStateWav->dataSize;
+        while (size < STREAMING_BUFFER_SIZE)
+        {
+            long remaining = dataEnd - (long)_fileStream->position();
+            if (remaining <= 0)
+            {
+                // Wrap around once per chunk at most, so an empty file cannot spin here.
+                if (!_streamLooped || rewound)
+                    break;
+                rewindStream();
+                rewound = true;
+                continue;
+            }
+
+            size_t count = min((long)(STREAMING_BUFFER_SIZE - size), remaining);
+            size_t read = _fileStream->read(data + size, 1, count);
+            if (read == 0)
+                break;
+            size += (ALsizei)read;
+        }
+    }
+    else if (_streamStateOgg)
+    {
+        int section;
+        while (size < STREAMING_BUFFER_SIZE)
+        {
+            long result = ov_read(&_streamStateOgg->oggFile, data + size, STREAMING_BUFFER_SIZE - size, 0, 2, 1, &section);
+            if (result > 0)
+            {
+                size += result;
+                rewound = false;
+            }
+            else if (result == 0)
+            {
+                if (!_streamLooped || rewound)
+                    break;
+                rewindStream();
+                rewound = true;
+            }
+            else
+            {
+                GP_WARN("Failed to read ogg file '%s'; file is missing data.", _filePath.c_str());
+                break;
+            }
+        }
+    }
+
+    return size;
+}
+
+void AudioBuffer::rewindStream()
+{
+    if (_streamStateWav)
+    {
+        GP_ASSERT(_fileStream);
+        _fileStream->seek(_streamStateWav->dataStart, SEEK_SET);
+    }
+    else if (_streamStateOgg)
+    {
+        ov_pcm_seek(&_streamStateOgg->oggFile, 0);
+    }
+}
+
+void AudioBuffer::seekStreamToTime(float time)
+{
+    float duration = getDuration();
+    if (duration > 0.0f)
+        time = fmod(time, duration);
+
+    spinLock(&_streamLock);
+    if (time <= 0.0f)
+    {
+        rewindStream();
+    }
+    else if (_streamStateWav)
+    {
+        GP_ASSERT(_fileStream);
+
+        // Seek to the start of a sample frame.
+        unsigned int frame = (unsigned int)(time * _streamStateWav->frequency);
+        _fileStream->seek(_streamStateWav->dataStart + (long)(frame * _streamStateWav->blockAlign), SEEK_SET);
+    }
+    else if (_streamStateOgg)
+    {
+        ov_pcm_seek(&_streamStateOgg->oggFile, (ogg_int64_t)(time * _streamStateOgg->rate));
+    }
+
+    // Discard the chunks decoded from the previous position.
+    _streamReadChunk = 0;
+    _streamWriteChunk = 0;
+    atomicExchange(&_streamChunkCount, 0);
+    _streamEnded = false;
+    spinUnlock(&_streamLock);
+
+    requestDecoding();
+}
+
+void AudioBuffer::startDecoding(AudioBuffer* buffer)
+{
+    GP_ASSERT(buffer);
+
+    if (!__decodeThreadRunning)
+    {
+        // Without the thread, streamed chunks are decoded on the game thread as they are needed.
+        __decodeThreadRunning = true;
+#ifdef WIN32
+        InitializeCriticalSection(&__decodedBuffersLock);
+        __decodeEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+        __decodeThread = __decodeEvent ? CreateThread(NULL, 0, decodeThread, NULL, 0, NULL) : NULL;
+        if (__decodeThread == NULL)
+#else
+        if (pthread_create(&__decodeThread, NULL, decodeThread, NULL) != 0)
+#endif
+        {
+            GP_WARN("Failed to start the audio decoding thread; streamed audio will be decoded on the game thread.");
+            __decodeThreadRunning = false;
+#ifdef WIN32
+            if (__decodeEvent)
+                CloseHandle(__decodeEvent);
+            __decodeEvent = NULL;
+            DeleteCriticalSection(&__decodedBuffersLock);
+#endif
+            return;
+        }
+    }
+
+    lockDecodedBuffers();
+    __decodedBuffers.push_back(buffer);
+    unlockDecodedBuffers();
+    requestDecoding();
+}
+
+void AudioBuffer::stopDecoding(AudioBuffer* buffer)
+{
+    GP_ASSERT(buffer);
+
+    if (!__decodeThreadRunning)
+        return;
+
+    // The decoding thread holds the lock while it decodes, so the buffer is no longer in use once it is removed.
+    lockDecodedBuffers();
+    std::vector<AudioBuffer*>::iterator itr = std::find(__decodedBuffers.begin(), __decodedBuffers.end(), buffer);
+    if (itr != __decodedBuffers.end())
+        __decodedBuffers.erase(itr);
+    bool empty = __decodedBuffers.empty();
+    unlockDecodedBuffers();
+    if (!empty)
+        return;
+
+    // Stop the thread with the last buffer, so none is left running once audio is shut down.
+#ifdef WIN32
+    __decodeThreadRunning = false;
+    SetEvent(__decodeEvent);
+    WaitForSingleObject(__decodeThread, INFINITE);
+    CloseHandle(__decodeThread);
+    CloseHandle(__decodeEvent);
+    __decodeThread = NULL;
+    __decodeEvent = NULL;
+    DeleteCriticalSection(&__decodedBuffersLock);
+#else
+    pthread_mutex_lock(&__decodeRequestLock);
+    __decodeThreadRunning = false;
+    pthread_cond_signal(&__decodeRequestCondition);
+    pthread_mutex_unlock(&__decodeRequestLock);
+    pthread_join(__decodeThread, NULL);
+#endif
+}
+
+#ifdef WIN32
+unsigned long __stdcall AudioBuffer::decodeThread(void*)
+#else
+void* AudioBuffer::decodeThread(void*)
+#endif
+{
+    while (true)
+    {
+        // Sleep until a chunk is taken from a queue or the thread is stopped.
+#ifdef WIN32
+        WaitForSingleObject(__decodeEvent, INFINITE);
+        if (!__decodeThreadRunning)
+            break;
+#else
+        pthread_mutex_lock(&__decodeRequestLock);
+        while (!__decodeRequested && __decodeThreadRunning)
+            pthread_cond_wait(&__decodeRequestCondition, &__decodeRequestLock);
+        __decodeRequested = false;
+        bool running = __decodeThreadRunning;
+        pthread_mutex_unlock(&__decodeRequestLock);
+        if (!running)
+            break;
+#endif
+
+        lockDecodedBuffers();
+        for (std::vector<AudioBuffer*>::iterator itr = __decodedBuffers.begin(); itr != __decodedBuffers.end(); ++itr)
+        {
+            while ((*itr)->decodeChunk())
+                ;
+        }
+        unlockDecodedBuffers();
+    }
+    return 0;
+}
+
+float AudioBuffer::getDuration()
+{
+    if (_duration < 0.0f)
+    {
+        _duration = 0.0f;
+        if (!_streamed)
+        {
+            _duration = getBufferDuration(_alBufferQueue[0]);
+        }
+        else if (_streamStateWav)
+        {
+            if (_streamStateWav->frequency > 0 && _streamStateWav->blockAlign > 0)
+                _duration = (float)_streamStateWav->dataSize / (float)(_streamStateWav->frequency * _streamStateWav->blockAlign);
+        }
+        else if (_streamStateOgg)
+        {
+            double duration = ov_time_total(&_streamStateOgg->oggFile, -1);
+            if (duration > 0.0)
+                _duration = (float)duration;
+        }
+    }
+    return _duration;
+}
+
+float AudioBuffer::getBufferDuration(ALuint buffer)
+{
+    ALint size, frequency, channels, bits;
+    AL_CHECK( alGetBufferi(buffer, AL_SIZE, &size) );
+    AL_CHECK( alGetBufferi(buffer, AL_FREQUENCY, &frequency) );
+    AL_CHECK( alGetBufferi(buffer, AL_CHANNELS, &channels) );
+    AL_CHECK( alGetBufferi(buffer, AL_BITS, &bits) );
+    if (frequency > 0 && channels > 0 && bits > 0)
+        return (float)size / (float)(frequency * channels * (bits / 8));
+    return 0.0f;
+}
+
 }
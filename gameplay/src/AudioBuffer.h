@@ -4,6 +4,12 @@
 #include "Ref.h"
 #include "Stream.h"
 
+// Number of OpenAL buffers queued on a streamed audio source, and of decoded chunks waiting for them.
+#define STREAMING_BUFFER_QUEUE_SIZE 3
+
+// Size in bytes of each streamed chunk of decoded audio data.
+#define STREAMING_BUFFER_SIZE 48000
+
 namespace gameplay
 {
 
@@ -13,17 +19,54 @@ class AudioSource;
  * Defines the actual audio buffer data.
  *
  * Currently only supports supported formats: .ogg, .wav, .au and .raw files.
+ *
+ * Streamed buffers decode their file in small chunks into a queue of OpenAL buffers
+ * instead of decoding it entirely up front, which suits long music and ambient tracks.
+ * The chunks are decoded ahead of playback on a background thread, so refilling the
+ * OpenAL buffers on the game thread only copies decoded data.
  */
 class AudioBuffer : public Ref
 {
     friend class AudioSource;
+    friend class AudioBufferTest;
 
 private:
-    
+
+    /**
+     * Streaming state for a wave file.
+     */
+    struct AudioStreamStateWav
+    {
+        long dataStart;
+        unsigned int dataSize;
+        ALuint format;
+        ALuint frequency;
+        unsigned int blockAlign;
+    };
+
+    /**
+     * Streaming state for an ogg file.
+     */
+    struct AudioStreamStateOgg
+    {
+        OggVorbis_File oggFile;
+        ALenum format;
+        long rate;
+    };
+
+    /**
+     * A chunk of decoded audio data waiting to be copied into an OpenAL buffer.
+     */
+    struct AudioStreamChunk
+    {
+        char data[STREAMING_BUFFER_SIZE];
+        ALsizei size;
+    };
+
     /**
      * Constructor.
      */
-    AudioBuffer(const char* path, ALuint buffer);
+    AudioBuffer(const char* path, ALuint* buffers, bool streamed);
 
     /**
      * Destructor.
@@ -39,17 +82,116 @@ private:
      * Creates an audio buffer from a file.
      * 
      * @param path The path to the audio buffer on the filesystem.
+     * @param streamed true to decode the file in chunks as it plays rather than all at once.
+     *        Streamed buffers are not shared between sources.
      * 
      * @return The buffer from a file.
      */
-    static AudioBuffer* create(const char* path);
+    static AudioBuffer* create(const char* path, bool streamed);
     
-    static bool loadWav(Stream* stream, ALuint buffer);
+    static bool loadWav(Stream* stream, ALuint buffer, bool streamed, AudioStreamStateWav* streamState);
     
-    static bool loadOgg(Stream* stream, ALuint buffer);
+    static bool loadOgg(Stream* stream, ALuint buffer, bool streamed, AudioStreamStateOgg* streamState);
+
+    /**
+     * Fills the given OpenAL buffer with the next decoded chunk of a streamed file.
+     *
+     * The chunk is taken from those decoded ahead on the decoding thread. If that thread
+     * has fallen behind, the chunk is decoded here instead. Chunks that were already
+     * decoded ahead keep the looping they were decoded with.
+     *
+     * @param buffer The OpenAL buffer to fill.
+     * @param looped true to continue from the start of the file once its end is reached.
+     *
+     * @return true if data was written to the buffer, false if the end of the file was reached.
+     */
+    bool streamData(ALuint buffer, bool looped);
+
+    /**
+     * Moves a streamed file to the given time, wrapping around its duration, and discards
+     * the chunks decoded from the previous position.
+     *
+     * @param time The time to move to, in seconds.
+     */
+    void seekStreamToTime(float time);
+
+    /**
+     * Decodes the next chunk of a streamed file into its chunk queue, if there is room for it.
+     *
+     * @return true if a chunk was added to the queue.
+     */
+    bool decodeChunk();
+
+    /**
+     * Decodes audio data from the current position of a streamed file.
+     * Must be called with the stream lock held.
+     *
+     * @param data The memory to decode into, STREAMING_BUFFER_SIZE bytes long.
+     *
+     * @return The number of bytes decoded, or 0 if the end of the file was reached.
+     */
+    ALsizei decode(char* data);
+
+    /**
+     * Moves a streamed file back to its start. Must be called with the stream lock held.
+     */
+    void rewindStream();
+
+    /**
+     * Starts decoding streamed chunks on the decoding thread, starting the thread if needed.
+     *
+     * @param buffer The streamed buffer.
+     */
+    static void startDecoding(AudioBuffer* buffer);
+
+    /**
+     * Stops decoding streamed chunks on the decoding thread, stopping the thread once no
+     * buffers are left. Returns after any chunk being decoded for the buffer is finished.
+     *
+     * @param buffer The streamed buffer.
+     */
+    static void stopDecoding(AudioBuffer* buffer);
+
+    /**
+     * Runs the decoding thread, which fills the chunk queues of streamed buffers whenever
+     * chunks are taken from them.
+     */
+#ifdef WIN32
+    static unsigned long __stdcall decodeThread(void*);
+#else
+    static void* decodeThread(void*);
+#endif
+
+    /**
+     * Gets the length of the audio data in seconds.
+     *
+     * @return The duration, or 0 if it cannot be determined.
+     */
+    float getDuration();
+
+    /**
+     * Gets the length of the audio data in an OpenAL buffer in seconds.
+     *
+     * @param buffer The OpenAL buffer.
+     *
+     * @return The duration of the data in the buffer.
+     */
+    static float getBufferDuration(ALuint buffer);
 
     std::string _filePath;
-    ALuint _alBuffer;
+    bool _streamed;
+    ALuint _alBufferQueue[STREAMING_BUFFER_QUEUE_SIZE];
+    Stream* _fileStream;
+    AudioStreamStateWav* _streamStateWav;
+    AudioStreamStateOgg* _streamStateOgg;
+    float _duration;
+    AudioStreamChunk* _streamChunks;
+    unsigned int _streamReadChunk;
+    unsigned int _streamWriteChunk;
+    volatile long _streamChunkCount;
+    volatile long _streamLock;
+    bool _streamLooped;
+    bool _streamEnded;
 };
 
 }
@@ -4,11 +4,18 @@
 #include "AudioBuffer.h"
 #include "AudioSource.h"
 
+// Default number of audio sources that play through an OpenAL voice at once
+#define AUDIO_MAX_VOICES_DEFAULT 32
+
+// Sources quieter than this at the listener (about -60 dB) are not given a voice
+#define AUDIO_INAUDIBLE_GAIN 0.001f
+
 namespace gameplay
 {
 
 AudioController::AudioController() 
-    : _alcDevice(NULL), _alcContext(NULL), _pausingSource(NULL)
+    : _alcDevice(NULL), _alcContext(NULL), _pausingSource(NULL),
+      _maxVoices(AUDIO_MAX_VOICES_DEFAULT), _realVoiceCount(0), _virtualVoiceCount(0)
 {
 }
 
@@ -91,6 +98,26 @@ void AudioController::resume()
     }
 }
 
+unsigned int AudioController::getMaxVoices() const
+{
+    return _maxVoices;
+}
+
+void AudioController::setMaxVoices(unsigned int maxVoices)
+{
+    _maxVoices = maxVoices;
+}
+
+unsigned int AudioController::getRealVoiceCount() const
+{
+    return _realVoiceCount;
+}
+
+unsigned int AudioController::getVirtualVoiceCount() const
+{
+    return _virtualVoiceCount;
+}
+
 void AudioController::update(float elapsedTime)
 {
     AudioListener* listener = AudioListener::getInstance();
@@ -101,6 +128,101 @@ void AudioController::update(float elapsedTime)
         AL_CHECK( alListenerfv(AL_VELOCITY, (ALfloat*)&listener->getVelocity()) );
         AL_CHECK( alListenerfv(AL_POSITION, (ALfloat*)&listener->getPosition()) );
     }
+
+    // Keep the buffer queues of streamed sources filled, before their state is checked below.
+    for (std::set<AudioSource*>::iterator itr = _playingSources.begin(); itr != _playingSources.end(); itr++)
+    {
+        GP_ASSERT(*itr);
+        if ((*itr)->_alSource && (*itr)->isStreamed())
+            (*itr)->streamDataIfNeeded();
+    }
+
+    updateVoices(elapsedTime);
+}
+
+void AudioController::updateVoices(float elapsedTime)
+{
+    AudioListener* listener = AudioListener::getInstance();
+    const Vector3& listenerPosition = listener ? listener->getPosition() : Vector3::zero();
+
+    _voices.clear();
+    _realVoiceCount = 0;
+    _virtualVoiceCount = 0;
+
+    for (std::set<AudioSource*>::iterator itr = _playingSources.begin(); itr != _playingSources.end(); itr++)
+    {
+        AudioSource* source = *itr;
+        GP_ASSERT(source);
+        source->updateVoice(elapsedTime);
+        if (source->getState() != AudioSource::PLAYING)
+        {
+            // Paused sources keep whatever voice they have.
+            if (source->_alSource)
+                _realVoiceCount++;
+            else if (source->isVirtual())
+                _virtualVoiceCount++;
+            continue;
+        }
+
+        // Estimate the gain at the listener using OpenAL's default inverse distance model.
+        Vector3 position = source->_node ? source->_node->getTranslationWorld() : Vector3::zero();
+        float distance = position.distance(listenerPosition);
+
+        Voice voice;
+        voice.source = source;
+        voice.streamed = source->isStreamed();
+        voice.priority = source->_priority;
+        voice.audibility = source->_gain / max(distance, 1.0f);
+        _voices.push_back(voice);
+    }
+
+    std::sort(_voices.begin(), _voices.end(), compareVoices);
+
+    // Take voices away from sources that rank too low or cannot be heard first,
+    // so they are free for the higher ranked sources. Restarting a streamed source
+    // decodes its file again from its playback position, so streamed sources keep theirs.
+    unsigned int voiceCount = (unsigned int)_voices.size();
+    for (unsigned int i = 0; i < voiceCount; i++)
+    {
+        Voice& voice = _voices[i];
+        if (!voice.streamed && (i >= _maxVoices || voice.audibility < AUDIO_INAUDIBLE_GAIN))
+            voice.source->releaseVoice();
+    }
+
+    for (unsigned int i = 0; i < voiceCount; i++)
+    {
+        Voice& voice = _voices[i];
+        AudioSource* source = voice.source;
+        if (!source->_alSource && i < _maxVoices && (voice.streamed || voice.audibility >= AUDIO_INAUDIBLE_GAIN))
+        {
+            if (source->acquireVoice())
+            {
+                if (voice.streamed)
+                    source->restartStream();
+                AL_CHECK( alSourcePlay(source->_alSource) );
+            }
+        }
+
+        if (source->_alSource)
+        {
+            // Apply node movement once per frame rather than on every transform change.
+            source->updatePosition();
+            _realVoiceCount++;
+        }
+        else
+        {
+            _virtualVoiceCount++;
+        }
+    }
+}
+
+bool AudioController::compareVoices(const Voice& v1, const Voice& v2)
+{
+    if (v1.streamed != v2.streamed)
+        return v1.streamed;
+    if (v1.priority != v2.priority)
+        return v1.priority > v2.priority;
+    return v1.audibility > v2.audibility;
 }
 
 }
@@ -9,6 +9,11 @@ class AudioSource;
 
 /**
  * Defines a class for controlling game audio.
+ *
+ * Playing audio sources compete for a limited number of OpenAL voices. Each frame the
+ * controller ranks them by priority and then by how loud they are at the listener's
+ * position. The highest ranked sources get a voice, and the rest play virtually until
+ * they rank high enough again.
  */
 class AudioController
 {
@@ -22,7 +27,48 @@ public:
      */
     virtual ~AudioController();
 
+    /**
+     * Gets the maximum number of audio sources that can play through an OpenAL voice at the same time.
+     *
+     * @return The maximum number of voices.
+     */
+    unsigned int getMaxVoices() const;
+
+    /**
+     * Sets the maximum number of audio sources that can play through an OpenAL voice at the same time.
+     *
+     * Playing sources beyond this limit become virtual. The default is 32.
+     *
+     * @param maxVoices The maximum number of voices.
+     */
+    void setMaxVoices(unsigned int maxVoices);
+
+    /**
+     * Gets the number of playing audio sources that currently have an OpenAL voice.
+     *
+     * @return The number of real voices.
+     */
+    unsigned int getRealVoiceCount() const;
+
+    /**
+     * Gets the number of playing audio sources that are currently virtual.
+     *
+     * @return The number of virtual voices.
+     */
+    unsigned int getVirtualVoiceCount() const;
+
 private:
+
+    /**
+     * A playing audio source ranked for a voice.
+     */
+    struct Voice
+    {
+        AudioSource* source;
+        bool streamed;
+        int priority;
+        float audibility;
+    };
     
     /**
      * Constructor.
@@ -54,11 +100,25 @@ private:
      */
     void update(float elapsedTime);
 
+    /**
+     * Ranks the playing sources and hands out the available voices.
+     */
+    void updateVoices(float elapsedTime);
+
+    /**
+     * Orders voices from the most to the least important.
+     */
+    static bool compareVoices(const Voice& v1, const Voice& v2);
+
 
     ALCdevice* _alcDevice;
     ALCcontext* _alcContext;
     std::set<AudioSource*> _playingSources;
     AudioSource* _pausingSource;
+    std::vector<Voice> _voices;
+    unsigned int _maxVoices;
+    unsigned int _realVoiceCount;
+    unsigned int _virtualVoiceCount;
 };
 
 }
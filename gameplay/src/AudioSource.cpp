@@ -9,28 +9,23 @@
 namespace gameplay
 {
 
-AudioSource::AudioSource(AudioBuffer* buffer, ALuint source) 
-    : _alSource(source), _buffer(buffer), _looped(false), _gain(1.0f), _pitch(1.0f), _node(NULL)
+// Number of OpenAL voices currently held by audio sources
+static unsigned int __voiceCount = 0;
+
+AudioSource::AudioSource(AudioBuffer* buffer) 
+    : _alSource(0), _buffer(buffer), _looped(false), _gain(1.0f), _pitch(1.0f), _node(NULL),
+      _priority(0), _state(INITIAL), _playbackTime(0.0f), _streamTime(0.0f), _positionDirty(false)
 {
     GP_ASSERT(buffer);
-    AL_CHECK( alSourcei(_alSource, AL_BUFFER, buffer->_alBuffer) );
-    AL_CHECK( alSourcei(_alSource, AL_LOOPING, _looped) );
-    AL_CHECK( alSourcef(_alSource, AL_PITCH, _pitch) );
-    AL_CHECK( alSourcef(_alSource, AL_GAIN, _gain) );
-    AL_CHECK( alSourcefv(_alSource, AL_VELOCITY, (const ALfloat*)&_velocity) );
 }
 
 AudioSource::~AudioSource()
 {
-    if (_alSource)
-    {
-        AL_CHECK( alDeleteSources(1, &_alSource) );
-        _alSource = 0;
-    }
+    releaseVoice();
     SAFE_RELEASE(_buffer);
 }
 
-AudioSource* AudioSource::create(const char* url)
+AudioSource* AudioSource::create(const char* url, bool streamed)
 {
     // Load from a .audio file.
     std::string pathStr = url;
@@ -49,22 +44,12 @@ AudioSource* AudioSource::create(const char* url)
     }
 
     // Create an audio buffer from this URL.
-    AudioBuffer* buffer = AudioBuffer::create(url);
+    AudioBuffer* buffer = AudioBuffer::create(url, streamed);
     if (buffer == NULL)
         return NULL;
 
-    // Load the audio source.
-    ALuint alSource = 0;
-
-    AL_CHECK( alGenSources(1, &alSource) );
-    if (AL_LAST_ERROR())
-    {
-        SAFE_RELEASE(buffer);
-        GP_ERROR("Error generating audio source.");
-        return NULL;
-    }
-    
-    return new AudioSource(buffer, alSource);
+    // The OpenAL source (voice) is only acquired once the source is played.
+    return new AudioSource(buffer);
 }
 
 AudioSource* AudioSource::create(Properties* properties)
@@ -85,7 +70,7 @@ AudioSource* AudioSource::create(Properties* properties)
     }
 
     // Create the audio source.
-    AudioSource* audio = AudioSource::create(path.c_str());
+    AudioSource* audio = AudioSource::create(path.c_str(), properties->getBool("streamed"));
     if (audio == NULL)
     {
         GP_ERROR("Audio file '%s' failed to load properly.", path.c_str());
@@ -105,6 +90,10 @@ AudioSource* AudioSource::create(Properties* properties)
     {
         audio->setPitch(properties->getFloat("pitch"));
     }
+    if (properties->exists("priority"))
+    {
+        audio->setPriority(properties->getInt("priority"));
+    }
     Vector3 v;
     if (properties->getVector3("velocity", &v))
     {
@@ -116,6 +105,10 @@ AudioSource* AudioSource::create(Properties* properties)
 
 AudioSource::State AudioSource::getState() const
 {
+    // Sources without a voice track their own state.
+    if (!_alSource)
+        return _state;
+
     ALint state;
     AL_CHECK( alGetSourcei(_alSource, AL_SOURCE_STATE, &state) );
 
@@ -133,9 +126,31 @@ AudioSource::State AudioSource::getState() const
     return INITIAL;
 }
 
+bool AudioSource::isStreamed() const
+{
+    GP_ASSERT(_buffer);
+    return _buffer->_streamed;
+}
+
 void AudioSource::play()
 {
-    AL_CHECK( alSourcePlay(_alSource) );
+    // Sources start over from the beginning unless they are paused.
+    State state = getState();
+    if (state != PAUSED)
+        _playbackTime = 0.0f;
+
+    // Without a free voice the source plays virtually until the controller can give it one.
+    bool hadVoice = (_alSource != 0);
+    if (hadVoice || acquireVoice())
+    {
+        // Streamed sources refill their buffer queue from their playback position.
+        if (isStreamed() && (state != PAUSED || !hadVoice))
+            restartStream();
+
+        updatePosition();
+        AL_CHECK( alSourcePlay(_alSource) );
+    }
+    _state = PLAYING;
 
     // Add the source to the controller's list of currently playing sources.
     AudioController* audioController = Game::getInstance()->getAudioController();
@@ -146,7 +161,10 @@ void AudioSource::play()
 
 void AudioSource::pause()
 {
-    AL_CHECK( alSourcePause(_alSource) );
+    if (_alSource)
+        AL_CHECK( alSourcePause(_alSource) );
+    else if (_state == PLAYING)
+        _state = PAUSED;
 
     // Remove the source from the controller's set of currently playing sources
     // if the source is being paused by the user and not the controller itself.
@@ -170,7 +188,14 @@ void AudioSource::resume()
 
 void AudioSource::stop()
 {
-    AL_CHECK( alSourceStop(_alSource) );
+    // Stopped sources give their voice back for other sources to use.
+    if (_alSource)
+    {
+        AL_CHECK( alSourceStop(_alSource) );
+        releaseVoice();
+    }
+    _state = STOPPED;
+    _playbackTime = 0.0f;
 
     // Remove the source from the controller's set of currently playing sources.
     AudioController* audioController = Game::getInstance()->getAudioController();
@@ -182,7 +207,10 @@ void AudioSource::stop()
 
 void AudioSource::rewind()
 {
-    AL_CHECK( alSourceRewind(_alSource) );
+    if (_alSource)
+        AL_CHECK( alSourceRewind(_alSource) );
+    _state = INITIAL;
+    _playbackTime = 0.0f;
 }
 
 bool AudioSource::isLooped() const
@@ -192,10 +220,15 @@ bool AudioSource::isLooped() const
 
 void AudioSource::setLooped(bool looped)
 {
-    AL_CHECK( alSourcei(_alSource, AL_LOOPING, (looped) ? AL_TRUE : AL_FALSE) );
-    if (AL_LAST_ERROR())
+    // Streamed sources loop by decoding from the start of the file again, which
+    // OpenAL's looping would prevent by replaying the queued buffers instead.
+    if (_alSource && !isStreamed())
     {
-        GP_ERROR("Failed to set audio source's looped attribute with error: %d", AL_LAST_ERROR());
+        AL_CHECK( alSourcei(_alSource, AL_LOOPING, (looped) ? AL_TRUE : AL_FALSE) );
+        if (AL_LAST_ERROR())
+        {
+            GP_ERROR("Failed to set audio source's looped attribute with error: %d", AL_LAST_ERROR());
+        }
     }
     _looped = looped;
 }
@@ -207,7 +240,8 @@ float AudioSource::getGain() const
 
 void AudioSource::setGain(float gain)
 {
-    AL_CHECK( alSourcef(_alSource, AL_GAIN, gain) );
+    if (_alSource)
+        AL_CHECK( alSourcef(_alSource, AL_GAIN, gain) );
     _gain = gain;
 }
 
@@ -218,7 +252,8 @@ float AudioSource::getPitch() const
 
 void AudioSource::setPitch(float pitch)
 {
-    AL_CHECK( alSourcef(_alSource, AL_PITCH, pitch) );
+    if (_alSource)
+        AL_CHECK( alSourcef(_alSource, AL_PITCH, pitch) );
     _pitch = pitch;
 }
 
@@ -227,9 +262,25 @@ const Vector3& AudioSource::getVelocity() const
     return _velocity;
 }
 
+int AudioSource::getPriority() const
+{
+    return _priority;
+}
+
+void AudioSource::setPriority(int priority)
+{
+    _priority = priority;
+}
+
+bool AudioSource::isVirtual() const
+{
+    return !_alSource && (_state == PLAYING || _state == PAUSED);
+}
+
 void AudioSource::setVelocity(const Vector3& velocity)
 {
-    AL_CHECK( alSourcefv(_alSource, AL_VELOCITY, (ALfloat*)&velocity) );
+    if (_alSource)
+        AL_CHECK( alSourcefv(_alSource, AL_VELOCITY, (ALfloat*)&velocity) );
     _velocity = velocity;
 }
 
@@ -267,31 +318,36 @@ void AudioSource::setNode(Node* node)
 
 void AudioSource::transformChanged(Transform* transform, long cookie)
 {
-    if (_node)
-    {
-        Vector3 translation = _node->getTranslationWorld();
-        AL_CHECK( alSourcefv(_alSource, AL_POSITION, (const ALfloat*)&translation.x) );
-    }
+    // The position is applied once per frame by the AudioController, however often the node moves.
+    _positionDirty = true;
 }
 
 AudioSource* AudioSource::clone(NodeCloneContext &context) const
 {
     GP_ASSERT(_buffer);
 
-    ALuint alSource = 0;
-    AL_CHECK( alGenSources(1, &alSource) );
-    if (AL_LAST_ERROR())
+    // Streamed buffers hold their own decoding position, so clones stream from a buffer of their own.
+    AudioBuffer* buffer = _buffer;
+    if (_buffer->_streamed)
     {
-        GP_ERROR("Error generating audio source.");
-        return NULL;
+        buffer = AudioBuffer::create(_buffer->_filePath.c_str(), true);
+        if (buffer == NULL)
+        {
+            GP_ERROR("Error creating streamed audio buffer.");
+            return NULL;
+        }
+    }
+    else
+    {
+        _buffer->addRef();
     }
-    AudioSource* audioClone = new AudioSource(_buffer, alSource);
+    AudioSource* audioClone = new AudioSource(buffer);
 
-    _buffer->addRef();
     audioClone->setLooped(isLooped());
     audioClone->setGain(getGain());
     audioClone->setPitch(getPitch());
     audioClone->setVelocity(getVelocity());
+    audioClone->setPriority(getPriority());
     if (Node* node = getNode())
     {
         Node* clonedNode = context.findClonedNode(node);
@@ -303,4 +359,153 @@ AudioSource* AudioSource::clone(NodeCloneContext &context) const
     return audioClone;
 }
 
+bool AudioSource::acquireVoice()
+{
+    GP_ASSERT(!_alSource);
+
+    AudioController* audioController = Game::getInstance()->getAudioController();
+    GP_ASSERT(audioController);
+    if (__voiceCount >= audioController->_maxVoices)
+        return false;
+
+    // Running out of hardware voices is expected here, so the error is handled rather than reported.
+    while (alGetError() != AL_NO_ERROR) ;
+    alGenSources(1, &_alSource);
+    if (alGetError() != AL_NO_ERROR)
+    {
+        _alSource = 0;
+        return false;
+    }
+    __voiceCount++;
+
+    // Streamed sources queue their buffers when played.
+    if (!isStreamed())
+    {
+        AL_CHECK( alSourcei(_alSource, AL_BUFFER, _buffer->_alBufferQueue[0]) );
+        AL_CHECK( alSourcei(_alSource, AL_LOOPING, _looped) );
+        if (_playbackTime > 0.0f)
+            AL_CHECK( alSourcef(_alSource, AL_SEC_OFFSET, _playbackTime) );
+    }
+    AL_CHECK( alSourcef(_alSource, AL_PITCH, _pitch) );
+    AL_CHECK( alSourcef(_alSource, AL_GAIN, _gain) );
+    AL_CHECK( alSourcefv(_alSource, AL_VELOCITY, (const ALfloat*)&_velocity) );
+
+    _positionDirty = true;
+    updatePosition();
+
+    return true;
+}
+
+void AudioSource::releaseVoice()
+{
+    if (!_alSource)
+        return;
+
+    // Remember where playback was so that it continues from there with the next voice.
+    _state = getState();
+    _playbackTime = 0.0f;
+    if (_state != STOPPED && _state != INITIAL)
+    {
+        AL_CHECK( alGetSourcef(_alSource, AL_SEC_OFFSET, &_playbackTime) );
+
+        // The offset of a streamed source is from the start of its first queued buffer.
+        if (isStreamed())
+        {
+            _playbackTime += _streamTime;
+            float duration = _buffer->getDuration();
+            if (duration > 0.0f)
+                _playbackTime = fmod(_playbackTime, duration);
+        }
+    }
+
+    AL_CHECK( alDeleteSources(1, &_alSource) );
+    _alSource = 0;
+
+    GP_ASSERT(__voiceCount > 0);
+    __voiceCount--;
+}
+
+void AudioSource::updateVoice(float elapsedTime)
+{
+    if (_alSource)
+    {
+        // Sources that finished playing on their own give their voice back.
+        State state = getState();
+        if (state == STOPPED || state == INITIAL)
+            releaseVoice();
+        return;
+    }
+
+    if (_state != PLAYING)
+        return;
+
+    // Virtual sources advance their playback position as if they were playing.
+    _playbackTime += elapsedTime * 0.001f * _pitch;
+    float duration = _buffer->getDuration();
+    if (duration > 0.0f && _playbackTime >= duration)
+    {
+        if (_looped)
+        {
+            _playbackTime = fmod(_playbackTime, duration);
+        }
+        else
+        {
+            _state = STOPPED;
+            _playbackTime = 0.0f;
+        }
+    }
+}
+
+void AudioSource::updatePosition()
+{
+    if (_alSource && _positionDirty)
+    {
+        Vector3 translation = _node ? _node->getTranslationWorld() : Vector3::zero();
+        AL_CHECK( alSourcefv(_alSource, AL_POSITION, (const ALfloat*)&translation.x) );
+        _positionDirty = false;
+    }
+}
+
+void AudioSource::streamDataIfNeeded()
+{
+    GP_ASSERT(isStreamed());
+
+    // Refill the buffers that have finished playing and queue them again.
+    ALint processed = 0;
+    AL_CHECK( alGetSourcei(_alSource, AL_BUFFERS_PROCESSED, &processed) );
+    while (processed-- > 0)
+    {
+        ALuint buffer;
+        AL_CHECK( alSourceUnqueueBuffers(_alSource, 1, &buffer) );
+        _streamTime += AudioBuffer::getBufferDuration(buffer);
+        if (_buffer->streamData(buffer, _looped))
+            AL_CHECK( alSourceQueueBuffers(_alSource, 1, &buffer) );
+    }
+
+    // If the queue ran dry before it could be refilled (such as during a long frame),
+    // OpenAL stops the source, so start it again.
+    ALint queued = 0;
+    AL_CHECK( alGetSourcei(_alSource, AL_BUFFERS_QUEUED, &queued) );
+    if (queued > 0 && getState() == STOPPED)
+        AL_CHECK( alSourcePlay(_alSource) );
+}
+
+void AudioSource::restartStream()
+{
+    GP_ASSERT(isStreamed());
+
+    // Detaching the buffer from a stopped source unqueues all of its buffers.
+    AL_CHECK( alSourceStop(_alSource) );
+    AL_CHECK( alSourcei(_alSource, AL_BUFFER, 0) );
+
+    _buffer->seekStreamToTime(_playbackTime);
+    _streamTime = _playbackTime;
+    for (unsigned int i = 0; i < STREAMING_BUFFER_QUEUE_SIZE; i++)
+    {
+        if (!_buffer->streamData(_buffer->_alBufferQueue[i], _looped))
+            break;
+        AL_CHECK( alSourceQueueBuffers(_alSource, 1, &_buffer->_alBufferQueue[i]) );
+    }
+}
+
 }
@@ -17,6 +17,11 @@ class NodeCloneContext;
  *
  * This can be attached to a Node for applying its 3D transformation.
  *
+ * An audio source only holds an OpenAL voice while it plays and the AudioController
+ * considers it among the most important sources at the listener's position. Other
+ * playing sources are virtual: they keep track of their playback position and
+ * continue from there once they are given a voice again.
+ *
  * @see http://gameplay3d.github.io/GamePlay/docs/file-formats.html#wiki-Audio
  */
 class AudioSource : public Ref, public Transform::Listener
@@ -42,11 +47,15 @@ public:
      * Alternately, a URL specifying a Properties object that defines an audio source can be used (where the URL is of the format
      * "<file-path>.<extension>#<namespace-id>/<namespace-id>/.../<namespace-id>" and "#<namespace-id>/<namespace-id>/.../<namespace-id>" is optional).
      * 
+     * Long music or ambient tracks can be streamed, in which case they are decoded in small chunks on a
+     * background thread as they play rather than all at once when the source is created.
+     * 
      * @param url The relative location on disk of the sound file or a URL specifying a Properties object defining an audio source.
+     * @param streamed true to stream the sound file; ignored when loading from a Properties object, which uses its "streamed" property.
      * @return The newly created audio source, or NULL if an audio source cannot be created.
      * @script{create}
      */
-    static AudioSource* create(const char* url);
+    static AudioSource* create(const char* url, bool streamed = false);
 
     /**
      * Create an audio source from the given properties object.
@@ -82,6 +91,13 @@ public:
      */
     void rewind();
 
+    /**
+     * Determines whether the audio source is streamed from its file while it plays.
+     *
+     * @return true if the audio source is streamed, false if it was decoded up front.
+     */
+    bool isStreamed() const;
+
     /**
      * Gets the current state of the audio source.
      *
@@ -131,6 +147,37 @@ public:
      */
     void setPitch(float pitch);
 
+    /**
+     * Returns the priority of the audio source.
+     *
+     * @return The priority.
+     */
+    int getPriority() const;
+
+    /**
+     * Sets the priority of the audio source.
+     *
+     * When more sources are playing than there are voices available, sources with a
+     * higher priority keep their voice over sources with a lower priority. Sources of
+     * equal priority are ranked by how loud they are at the listener's position.
+     *
+     * @param priority The priority of the source (default is 0).
+     *
+     * @see AudioController::setMaxVoices
+     */
+    void setPriority(int priority);
+
+    /**
+     * Determines whether the audio source is virtual.
+     *
+     * A virtual source is playing (or paused) without an OpenAL voice, either because it
+     * cannot be heard at the listener's position or because all voices are taken by
+     * higher ranked sources.
+     *
+     * @return true if the audio source is virtual, false otherwise.
+     */
+    bool isVirtual() const;
+
     /**
      * Gets the velocity of the audio source.
      *
@@ -166,7 +213,7 @@ private:
     /**
      * Constructor that takes an AudioBuffer.
      */
-    AudioSource(AudioBuffer* buffer, ALuint source);
+    AudioSource(AudioBuffer* buffer);
 
     /**
      * Destructor.
@@ -197,6 +244,42 @@ private:
      */
     AudioSource* clone(NodeCloneContext &context) const;
 
+    /**
+     * Gets an OpenAL voice for this source and applies its current settings to it.
+     *
+     * @return true if a voice was acquired, false if none is available.
+     */
+    bool acquireVoice();
+
+    /**
+     * Returns the OpenAL voice of this source, remembering its playback state and position.
+     */
+    void releaseVoice();
+
+    /**
+     * Advances the playback position of a virtual source, and releases the voice
+     * of a source that has finished playing.
+     *
+     * @param elapsedTime The elapsed game time.
+     */
+    void updateVoice(float elapsedTime);
+
+    /**
+     * Updates the position of the OpenAL voice if the node has moved since it was last set.
+     */
+    void updatePosition();
+
+    /**
+     * Refills and queues the buffers that a streamed source has finished playing.
+     * Called by the AudioController each frame.
+     */
+    void streamDataIfNeeded();
+
+    /**
+     * Discards the buffers queued on a streamed source and queues new ones from its playback position.
+     */
+    void restartStream();
+
     ALuint _alSource;
     AudioBuffer* _buffer;
     bool _looped;
@@ -204,6 +287,11 @@ private:
     float _pitch;
     Vector3 _velocity;
     Node* _node;
+    int _priority;
+    State _state;
+    float _playbackTime;
+    float _streamTime;
+    bool _positionDirty;
 };
 
 }
@@ -23,6 +23,7 @@
 #include <stack>
 #include <map>
 #include <queue>
+#include <deque>
 #include <algorithm>
 #include <limits>
 #include <functional>
@@ -197,6 +198,12 @@ extern int strcmpnocase(const char* s1, const char* s2);
 // Image
 #include <png.h>
 
+// Fonts (FreeType), only needed to rasterize TrueType fonts at runtime
+#ifdef GP_USE_FREETYPE
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#endif
+
 // Scripting
 using std::va_list;
 #include <lua.hpp>
@@ -269,6 +276,11 @@ using std::va_list;
     #endif
 #endif
 
+// SIMD math on x86 processors with SSE2 (always available on x86-64)
+#if !defined(USE_NEON) && !defined(GP_NO_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define USE_SSE
+#endif
+
 // Graphics (GLSL)
 #define VERTEX_ATTRIBUTE_POSITION_NAME              "a_position"
 #define VERTEX_ATTRIBUTE_NORMAL_NAME                "a_normal"
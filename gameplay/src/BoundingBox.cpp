@@ -325,25 +325,31 @@ void BoundingBox::set(const BoundingSphere& sphere)
 
 void BoundingBox::transform(const Matrix& matrix)
 {
-    // Calculate the corners.
-    Vector3 corners[8];
-    getCorners(corners);
+    transform(this, 1, matrix, this);
+}
+
+void BoundingBox::transform(const BoundingBox* boxes, unsigned int count, const Matrix& matrix, BoundingBox* dst)
+{
+    GP_ASSERT(boxes);
+    GP_ASSERT(dst);
 
-    // Transform the corners, recalculating the min and max points along the way.
-    matrix.transformPoint(&corners[0]);
-    Vector3 newMin = corners[0];
-    Vector3 newMax = corners[0];
-    for (int i = 1; i < 8; i++)
+    Vector3 corners[8];
+    for (unsigned int i = 0; i < count; i++)
     {
-        matrix.transformPoint(&corners[i]);
-        updateMinMax(&corners[i], &newMin, &newMax);
+        // Calculate and transform the corners.
+        boxes[i].getCorners(corners);
+        matrix.transformPoints(corners, 8, corners);
+
+        // Recalculate the min and max points from the transformed corners.
+        Vector3 newMin = corners[0];
+        Vector3 newMax = corners[0];
+        for (int j = 1; j < 8; j++)
+        {
+            updateMinMax(&corners[j], &newMin, &newMax);
+        }
+        dst[i].min = newMin;
+        dst[i].max = newMax;
     }
-    this->min.x = newMin.x;
-    this->min.y = newMin.y;
-    this->min.z = newMin.z;
-    this->max.x = newMax.x;
-    this->max.y = newMax.y;
-    this->max.z = newMax.z;
 }
 
 }
@@ -208,6 +208,21 @@ public:
      */
     void transform(const Matrix& matrix);
 
+    /**
+     * Transforms each of the specified bounding boxes by the given transformation
+     * matrix and stores the results in dst.
+     *
+     * The boxes may be transformed in place by passing the same array as dst.
+     *
+     * @param boxes The bounding boxes to transform.
+     * @param count The number of bounding boxes to transform.
+     * @param matrix The transformation matrix to transform by.
+     * @param dst An array of at least count bounding boxes to store the results in.
+     *
+     * @script{ignore}
+     */
+    static void transform(const BoundingBox* boxes, unsigned int count, const Matrix& matrix, BoundingBox* dst);
+
     /**
      * Transforms this bounding box by the given matrix.
      * 
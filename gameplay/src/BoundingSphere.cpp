@@ -202,6 +202,51 @@ void BoundingSphere::merge(const BoundingSphere& sphere)
     radius = r;
 }
 
+void BoundingSphere::merge(const BoundingSphere* spheres, unsigned int count)
+{
+    GP_ASSERT(spheres || count == 0);
+
+    // Calculate the combined extents of this sphere and the non-empty spheres.
+    bool empty = isEmpty();
+    float minX = empty ? FLT_MAX : center.x - radius;
+    float minY = empty ? FLT_MAX : center.y - radius;
+    float minZ = empty ? FLT_MAX : center.z - radius;
+    float maxX = empty ? -FLT_MAX : center.x + radius;
+    float maxY = empty ? -FLT_MAX : center.y + radius;
+    float maxZ = empty ? -FLT_MAX : center.z + radius;
+    for (unsigned int i = 0; i < count; i++)
+    {
+        const BoundingSphere& sphere = spheres[i];
+        if (sphere.isEmpty())
+            continue;
+
+        empty = false;
+        minX = min(minX, sphere.center.x - sphere.radius);
+        minY = min(minY, sphere.center.y - sphere.radius);
+        minZ = min(minZ, sphere.center.z - sphere.radius);
+        maxX = max(maxX, sphere.center.x + sphere.radius);
+        maxY = max(maxY, sphere.center.y + sphere.radius);
+        maxZ = max(maxZ, sphere.center.z + sphere.radius);
+    }
+    if (empty)
+        return;
+
+    // Center the new sphere on the extents and grow it to reach the far side of every sphere.
+    Vector3 c((minX + maxX) * 0.5f, (minY + maxY) * 0.5f, (minZ + maxZ) * 0.5f);
+    float r = isEmpty() ? 0.0f : c.distance(center) + radius;
+    for (unsigned int i = 0; i < count; i++)
+    {
+        const BoundingSphere& sphere = spheres[i];
+        if (!sphere.isEmpty())
+        {
+            r = max(r, c.distance(sphere.center) + sphere.radius);
+        }
+    }
+
+    center = c;
+    radius = r;
+}
+
 void BoundingSphere::merge(const BoundingBox& box)
 {
     if (box.isEmpty())
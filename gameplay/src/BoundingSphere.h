@@ -124,6 +124,21 @@ public:
      */
     void merge(const BoundingBox& box);
 
+    /**
+     * Sets this bounding sphere to a bounding sphere that contains both this
+     * bounding sphere and all of the specified bounding spheres.
+     *
+     * The spheres are bounded in a single pass around the center of their combined extents,
+     * so the result can be slightly larger than merging each sphere in turn but does not
+     * depend on the order of the spheres.
+     *
+     * @param spheres The bounding spheres to merge with.
+     * @param count The number of bounding spheres to merge with.
+     *
+     * @script{ignore}
+     */
+    void merge(const BoundingSphere* spheres, unsigned int count);
+
     /**
      * Sets this bounding sphere to the specified values.
      *
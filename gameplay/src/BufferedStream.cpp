@@ -0,0 +1,214 @@
+#include "Base.h"
+#include "BufferedStream.h"
+
+namespace gameplay
+{
+
+BufferedStream::BufferedStream(Stream* stream, char* buffer, size_t bufferSize, size_t bufferLength, long int bufferStart)
+    : _stream(stream), _buffer(buffer), _bufferSize(bufferSize), _bufferLength(bufferLength), _bufferPosition(0), _bufferStart(bufferStart)
+{
+}
+
+BufferedStream::~BufferedStream()
+{
+    close();
+}
+
+BufferedStream* BufferedStream::create(Stream* stream, size_t bufferSize)
+{
+    if (stream == NULL)
+        return NULL;
+    if (!stream->canRead())
+    {
+        SAFE_DELETE(stream);
+        return NULL;
+    }
+
+    long int position = 0;
+    if (stream->canSeek())
+    {
+        // Don't allocate more than the rest of the stream.
+        position = stream->position();
+        size_t length = stream->length();
+        if (position >= 0 && (size_t)position < length)
+            bufferSize = std::min(bufferSize, length - (size_t)position);
+    }
+    bufferSize = std::max(bufferSize, (size_t)1);
+
+    return new BufferedStream(stream, new char[bufferSize], bufferSize, 0, position);
+}
+
+BufferedStream* BufferedStream::create(char* data, size_t length)
+{
+    GP_ASSERT(data || length == 0);
+
+    return new BufferedStream(NULL, data, length, length, 0);
+}
+
+bool BufferedStream::canRead()
+{
+    return _buffer != NULL;
+}
+
+bool BufferedStream::canWrite()
+{
+    return false;
+}
+
+bool BufferedStream::canSeek()
+{
+    return _buffer != NULL && (_stream == NULL || _stream->canSeek());
+}
+
+void BufferedStream::close()
+{
+    if (_stream)
+        _stream->close();
+    SAFE_DELETE(_stream);
+    SAFE_DELETE_ARRAY(_buffer);
+    _bufferLength = 0;
+    _bufferPosition = 0;
+}
+
+bool BufferedStream::fill()
+{
+    if (_stream == NULL)
+        return false;
+
+    _bufferStart += (long int)_bufferLength;
+    _bufferLength = _stream->read(_buffer, 1, _bufferSize);
+    _bufferPosition = 0;
+    return _bufferLength > 0;
+}
+
+size_t BufferedStream::read(void* ptr, size_t size, size_t count)
+{
+    if (!canRead() || size == 0)
+        return 0;
+
+    char* dst = (char*)ptr;
+    size_t remaining = size * count;
+    while (remaining > 0)
+    {
+        size_t available = _bufferLength - _bufferPosition;
+        if (available == 0)
+        {
+            if (_stream && remaining >= _bufferSize)
+            {
+                // Large reads go straight to the underlying stream instead of through the buffer.
+                _bufferStart += (long int)_bufferLength;
+                _bufferLength = 0;
+                _bufferPosition = 0;
+                size_t bytesRead = _stream->read(dst, 1, remaining);
+                _bufferStart += (long int)bytesRead;
+                dst += bytesRead;
+                remaining -= bytesRead;
+                break;
+            }
+            if (!fill())
+                break;
+            available = _bufferLength;
+        }
+
+        size_t n = std::min(available, remaining);
+        memcpy(dst, _buffer + _bufferPosition, n);
+        _bufferPosition += n;
+        dst += n;
+        remaining -= n;
+    }
+
+    return (size * count - remaining) / size;
+}
+
+char* BufferedStream::readLine(char* str, int num)
+{
+    if (!canRead() || num <= 0)
+        return NULL;
+
+    int i = 0;
+    while (i < num - 1)
+    {
+        if (_bufferPosition >= _bufferLength && !fill())
+            break;
+
+        char c = _buffer[_bufferPosition++];
+        str[i++] = c;
+        if (c == '\n')
+            break;
+    }
+    str[i] = '\0';
+
+    // As with fgets(), nothing read at the end of the stream is an error.
+    return i > 0 || num == 1 ? str : NULL;
+}
+
+size_t BufferedStream::write(const void* ptr, size_t size, size_t count)
+{
+    return 0;
+}
+
+bool BufferedStream::eof()
+{
+    if (_bufferPosition < _bufferLength)
+        return false;
+    return _stream == NULL || _stream->eof();
+}
+
+size_t BufferedStream::length()
+{
+    if (_stream)
+        return _stream->length();
+    return _bufferLength;
+}
+
+long int BufferedStream::position()
+{
+    if (!canRead())
+        return -1;
+    return _bufferStart + (long int)_bufferPosition;
+}
+
+bool BufferedStream::seek(long int offset, int origin)
+{
+    if (!canSeek())
+        return false;
+
+    long int position;
+    switch (origin)
+    {
+    case SEEK_SET:
+        position = offset;
+        break;
+    case SEEK_CUR:
+        position = this->position() + offset;
+        break;
+    case SEEK_END:
+        position = (long int)length() + offset;
+        break;
+    default:
+        return false;
+    }
+    if (position < 0)
+        return false;
+
+    // Seeking within the buffered data only moves the read position.
+    if (position >= _bufferStart && position <= _bufferStart + (long int)_bufferLength)
+    {
+        _bufferPosition = (size_t)(position - _bufferStart);
+        return true;
+    }
+
+    if (_stream == NULL || !_stream->seek(position, SEEK_SET))
+        return false;
+    _bufferStart = position;
+    _bufferLength = 0;
+    _bufferPosition = 0;
+    return true;
+}
+
+bool BufferedStream::rewind()
+{
+    return seek(0, SEEK_SET);
+}
+
+}
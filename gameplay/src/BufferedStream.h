@@ -0,0 +1,173 @@
+#ifndef BUFFEREDSTREAM_H_
+#define BUFFEREDSTREAM_H_
+
+#include "Stream.h"
+
+namespace gameplay
+{
+
+/**
+ * Defines a read-only stream that reads from another stream in large blocks.
+ *
+ * Small reads, such as the individual fields of a bundle or the characters of a
+ * properties file, are copied from a memory buffer instead of each calling into
+ * the underlying stream. The typed read() and readArray() methods are inlined so
+ * that reads which can be served from the buffer make no function calls at all.
+ *
+ * A buffered stream can also be created over a block of memory, in which case
+ * the whole stream is held in the buffer.
+ *
+ * @script{ignore}
+ */
+class BufferedStream : public Stream
+{
+public:
+
+    /**
+     * Creates a buffered stream that reads from the given stream.
+     *
+     * The buffered stream takes ownership of the given stream and deletes it when closed.
+     *
+     * @param stream The stream to read from. May be NULL.
+     * @param bufferSize The size of the buffer in bytes.
+     *
+     * @return The new buffered stream, or NULL if stream is NULL or cannot be read.
+     */
+    static BufferedStream* create(Stream* stream, size_t bufferSize = 16384);
+
+    /**
+     * Creates a stream that reads from a block of memory.
+     *
+     * The stream takes ownership of the memory, which must have been allocated
+     * with new[], and deletes it when closed.
+     *
+     * @param data The memory to read from.
+     * @param length The length of the memory in bytes.
+     *
+     * @return The new stream.
+     */
+    static BufferedStream* create(char* data, size_t length);
+
+    /**
+     * Destructor.
+     */
+    ~BufferedStream();
+
+    /**
+     * @see Stream::canRead()
+     */
+    virtual bool canRead();
+
+    /**
+     * @see Stream::canWrite()
+     */
+    virtual bool canWrite();
+
+    /**
+     * @see Stream::canSeek()
+     */
+    virtual bool canSeek();
+
+    /**
+     * @see Stream::close()
+     */
+    virtual void close();
+
+    /**
+     * @see Stream::read()
+     */
+    virtual size_t read(void* ptr, size_t size, size_t count);
+
+    /**
+     * Reads a line from the stream.
+     *
+     * Lines are read up to and including the next "\n", as with fgets().
+     *
+     * @see Stream::readLine()
+     */
+    virtual char* readLine(char* str, int num);
+
+    /**
+     * Buffered streams are read-only, so this method always returns zero.
+     *
+     * @see Stream::write()
+     */
+    virtual size_t write(const void* ptr, size_t size, size_t count);
+
+    /**
+     * @see Stream::eof()
+     */
+    virtual bool eof();
+
+    /**
+     * @see Stream::length()
+     */
+    virtual size_t length();
+
+    /**
+     * @see Stream::position()
+     */
+    virtual long int position();
+
+    /**
+     * Sets the position of the file pointer.
+     *
+     * Seeking within the data that is currently buffered does not access the underlying stream.
+     *
+     * @see Stream::seek()
+     */
+    virtual bool seek(long int offset, int origin);
+
+    /**
+     * @see Stream::rewind()
+     */
+    virtual bool rewind();
+
+    /**
+     * Reads a single value of type T.
+     *
+     * @param value The value to read into.
+     *
+     * @return True if the value was read, false otherwise.
+     */
+    template <class T>
+    bool read(T* value);
+
+    /**
+     * Reads an array of values of type T into memory allocated by the caller.
+     *
+     * @param values The memory to read into, with room for at least count values.
+     * @param count The number of values to read.
+     *
+     * @return True if all values were read, false otherwise.
+     */
+    template <class T>
+    bool readArray(T* values, size_t count);
+
+private:
+
+    /**
+     * Constructor.
+     */
+    BufferedStream(Stream* stream, char* buffer, size_t bufferSize, size_t bufferLength, long int bufferStart);
+
+    /**
+     * Discards the buffered data and reads the next block from the underlying stream.
+     *
+     * @return True if any data was read, false otherwise.
+     */
+    bool fill();
+
+    Stream* _stream;
+    char* _buffer;
+    size_t _bufferSize;
+    size_t _bufferLength;
+    size_t _bufferPosition;
+    long int _bufferStart;
+};
+
+}
+
+#include "BufferedStream.inl"
+
+#endif
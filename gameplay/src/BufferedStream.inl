@@ -0,0 +1,30 @@
+#include "BufferedStream.h"
+
+namespace gameplay
+{
+
+template <class T>
+inline bool BufferedStream::read(T* value)
+{
+    if (_bufferLength - _bufferPosition >= sizeof(T))
+    {
+        memcpy(value, _buffer + _bufferPosition, sizeof(T));
+        _bufferPosition += sizeof(T);
+        return true;
+    }
+    return read(value, sizeof(T), 1) == 1;
+}
+
+template <class T>
+inline bool BufferedStream::readArray(T* values, size_t count)
+{
+    if (_bufferLength - _bufferPosition >= sizeof(T) * count)
+    {
+        memcpy(values, _buffer + _bufferPosition, sizeof(T) * count);
+        _bufferPosition += sizeof(T) * count;
+        return true;
+    }
+    return read(values, sizeof(T), count) == count;
+}
+
+}
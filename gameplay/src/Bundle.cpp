@@ -1,9 +1,11 @@
 #include "Base.h"
 #include "Bundle.h"
 #include "FileSystem.h"
+#include "BufferedStream.h"
 #include "MeshPart.h"
 #include "Scene.h"
 #include "Joint.h"
+#include "ResourceCache.h"
 
 // Minimum version numbers supported
 #define BUNDLE_VERSION_MAJOR_REQUIRED   1 
@@ -35,6 +37,28 @@ namespace gameplay
 
 static std::vector<Bundle*> __bundleCache;
 
+// Cache of meshes loaded from bundles (defined in Mesh.cpp).
+extern ResourceCache* getMeshCache();
+
+// Whether meshes are shared between the models that load them.
+static bool __meshSharing = false;
+
+/**
+ * Returns the size in bytes of the indices of a mesh part.
+ */
+static unsigned int getIndexSize(Mesh::IndexFormat indexFormat)
+{
+    switch (indexFormat)
+    {
+    case Mesh::INDEX8:
+        return 1;
+    case Mesh::INDEX16:
+        return 2;
+    default:
+        return 4;
+    }
+}
+
 Bundle::Bundle(const char* path) :
     _path(path), _referenceCount(0), _references(NULL), _stream(NULL), _trackedNodes(NULL)
 {
@@ -69,6 +93,16 @@ unsigned int Bundle::getVersionMinor() const
     return (unsigned int)_version[1];
 }
 
+void Bundle::setMeshSharingEnabled(bool enabled)
+{
+    __meshSharing = enabled;
+}
+
+bool Bundle::isMeshSharingEnabled()
+{
+    return __meshSharing;
+}
+
 template <class T>
 bool Bundle::readArray(unsigned int* length, T** ptr)
 {
@@ -84,7 +118,7 @@ bool Bundle::readArray(unsigned int* length, T** ptr)
     if (*length > 0)
     {
         *ptr = new T[*length];
-        if (_stream->read(*ptr, sizeof(T), *length) != *length)
+        if (!_stream->readArray(*ptr, *length))
         {
             GP_ERROR("Failed to read an array of data from bundle (into an array).");
             SAFE_DELETE_ARRAY(*ptr);
@@ -108,7 +142,7 @@ bool Bundle::readArray(unsigned int* length, std::vector<T>* values)
     if (*length > 0 && values)
     {
         values->resize(*length);
-        if (_stream->read(&(*values)[0], sizeof(T), *length) != *length)
+        if (!_stream->readArray(&(*values)[0], *length))
         {
             GP_ERROR("Failed to read an array of data from bundle (into a std::vector).");
             return false;
@@ -141,12 +175,12 @@ bool Bundle::readArray(unsigned int* length, std::vector<T>* values, unsigned in
     return true;
 }
 
-static std::string readString(Stream* stream)
+static std::string readString(BufferedStream* stream)
 {
     GP_ASSERT(stream);
 
     unsigned int length;
-    if (stream->read(&length, 4, 1) != 1)
+    if (!stream->read(&length))
     {
         GP_ERROR("Failed to read the length of a string from a bundle.");
         return std::string();
@@ -159,7 +193,7 @@ static std::string readString(Stream* stream)
     if (length > 0)
     {
         str.resize(length);
-        if (stream->read(&str[0], 1, length) != length)
+        if (!stream->readArray(&str[0], length))
         {
             GP_ERROR("Failed to read string from bundle.");
             return std::string();
@@ -185,8 +219,8 @@ Bundle* Bundle::create(const char* path)
         }
     }
 
-    // Open the bundle.
-    Stream* stream = FileSystem::open(path);
+    // Open the bundle. Most reads are of single fields, so they are buffered.
+    BufferedStream* stream = BufferedStream::create(FileSystem::open(path));
     if (!stream)
     {
         GP_WARN("Failed to open file '%s'.", path);
@@ -232,8 +266,8 @@ Bundle* Bundle::create(const char* path)
     for (unsigned int i = 0; i < refCount; ++i)
     {
         if ((refs[i].id = readString(stream)).empty() ||
-            stream->read(&refs[i].type, 4, 1) != 1 ||
-            stream->read(&refs[i].offset, 4, 1) != 1)
+            !stream->read(&refs[i].type) ||
+            !stream->read(&refs[i].offset))
         {
             SAFE_DELETE(stream);
             GP_WARN("Failed to read ref number %d for bundle '%s'.", i, path);
@@ -371,22 +405,22 @@ Bundle::Reference* Bundle::seekToFirstType(unsigned int type)
 
 bool Bundle::read(unsigned int* ptr)
 {
-    return _stream->read(ptr, sizeof(unsigned int), 1) == 1;
+    return _stream->read(ptr);
 }
 
 bool Bundle::read(unsigned char* ptr)
 {
-    return _stream->read(ptr, sizeof(unsigned char), 1) == 1;
+    return _stream->read(ptr);
 }
 
 bool Bundle::read(float* ptr)
 {
-    return _stream->read(ptr, sizeof(float), 1) == 1;
+    return _stream->read(ptr);
 }
 
 bool Bundle::readMatrix(float* m)
 {
-    return _stream->read(m, sizeof(float), 16) == 16;
+    return _stream->readArray(m, 16);
 }
 
 Scene* Bundle::loadScene(const char* id)
@@ -1365,6 +1399,22 @@ Mesh* Bundle::loadMesh(const char* id, const char* nodeId)
     GP_ASSERT(_stream);
     GP_ASSERT(id);
 
+    // Meshes are only shared between the models that load them if sharing is enabled,
+    // but they are always added to the cache to account for their memory.
+    std::string key = FileSystem::resolvePath(_path.c_str());
+    key += "#";
+    key += id;
+    if (__meshSharing)
+    {
+        Mesh* cached = static_cast<Mesh*>(getMeshCache()->find(key.c_str()));
+        if (cached)
+        {
+            getMeshCache()->use(cached);
+            cached->addRef();
+            return cached;
+        }
+    }
+
     // Save the file position.
     long position = _stream->position();
     if (position == -1L)
@@ -1403,6 +1453,7 @@ Mesh* Bundle::loadMesh(const char* id, const char* nodeId)
     mesh->_url += id;
 
     mesh->setVertexData((float*)meshData->vertexData, 0, meshData->vertexCount);
+    size_t memoryUsage = meshData->vertexCount * meshData->vertexFormat.getVertexSize();
 
     mesh->_boundingBox.set(meshData->boundingBox);
     mesh->_boundingSphere.set(meshData->boundingSphere);
@@ -1421,10 +1472,14 @@ Mesh* Bundle::loadMesh(const char* id, const char* nodeId)
             return NULL;
         }
         part->setIndexData(partData->indexData, 0, partData->indexCount);
+        memoryUsage += partData->indexCount * getIndexSize(partData->indexFormat);
     }
 
     SAFE_DELETE(meshData);
 
+    // The vertex and index data is held in GPU buffers only.
+    getMeshCache()->add(key.c_str(), mesh, memoryUsage);
+
     // Restore file pointer.
     if (_stream->seek(position, SEEK_SET) == false)
     {
@@ -9,6 +9,8 @@
 namespace gameplay
 {
 
+class BufferedStream;
+
 /**
  * Defines a gameplay bundle file (.gpb) that contains a
  * collection of binary game assets that can be loaded.
@@ -113,6 +115,29 @@ public:
      */
     unsigned int getVersionMinor() const;
 
+    /**
+     * Sets whether meshes are shared between the models that load them.
+     *
+     * By default each call to load a mesh creates a new mesh. When sharing is enabled,
+     * loading a mesh that is already loaded from the same bundle returns the existing
+     * mesh with its reference count incremented, so that models using the same mesh
+     * share its vertex and index buffers. Only enable sharing if meshes loaded from
+     * bundles are not modified, since a change to a shared mesh affects every model
+     * using it.
+     *
+     * @param enabled True to share meshes, false to load a new mesh each time.
+     * @script{ignore}
+     */
+    static void setMeshSharingEnabled(bool enabled);
+
+    /**
+     * Determines whether meshes are shared between the models that load them.
+     *
+     * @return True if meshes are shared.
+     * @script{ignore}
+     */
+    static bool isMeshSharingEnabled();
+
 private:
 
     class Reference
@@ -454,7 +479,7 @@ private:
     std::string _materialPath;
     unsigned int _referenceCount;
     Reference* _references;
-    Stream* _stream;
+    BufferedStream* _stream;
 
     std::vector<MeshSkinData*> _meshSkins;
     std::map<std::string, Node*>* _trackedNodes;
@@ -238,6 +238,7 @@ unsigned int Container::addControl(Control* control)
 	}
 
 	control->_parent = this;
+	control->setTopLevelForm(_form);
 
 	sortControls();
 
@@ -259,6 +260,7 @@ void Container::insertControl(Control* control, unsigned int index)
         _controls.insert(it, control);
         control->addRef();
         control->_parent = this;
+        control->setTopLevelForm(_form);
     }
 }
 
@@ -270,6 +272,7 @@ void Container::removeControl(unsigned int index)
     Control* control = *it;
     _controls.erase(it);
     control->_parent = NULL;
+    control->setTopLevelForm(NULL);
 
     if (_activeControl == control)
         _activeControl = NULL;
@@ -415,7 +418,14 @@ const Vector2& Container::getScrollPosition() const
 
 void Container::setScrollPosition(const Vector2& scrollPosition)
 {
-    _scrollPosition = scrollPosition;
+    if (scrollPosition != _scrollPosition)
+    {
+        _scrollPosition = scrollPosition;
+
+        // Children are offset by the scroll position.
+        setDirty(DIRTY_BOUNDS);
+        setChildrenDirty(DIRTY_BOUNDS, true);
+    }
 }
 
 Animation* Container::getAnimation(const char* id) const
@@ -499,13 +509,22 @@ void Container::setActiveControl(Control* control)
 
 void Container::setChildrenDirty(int bits, bool recursive)
 {
+    if (_controls.empty())
+        return;
+
+    // Set the bits directly rather than through setDirty, so that large
+    // containers only invalidate their form once.
     for (size_t i = 0, count = _controls.size(); i < count; ++i)
     {
         Control* ctrl = _controls[i];
-        ctrl->setDirty(bits);
+        ctrl->_dirtyBits |= bits;
         if (recursive && ctrl->isContainer())
             static_cast<Container*>(ctrl)->setChildrenDirty(bits, true);
     }
+
+    Form* form = getTopLevelForm();
+    if (form)
+        form->invalidate();
 }
 
 void Container::update(float elapsedTime)
@@ -621,6 +640,15 @@ bool Container::updateChildBounds()
 
         if (ctrl->isVisible())
         {
+            // Children scrolled entirely out of view keep their dirty bits and are
+            // updated once they scroll back in, so long lists only pay for what is shown.
+            if (isScrolledOutOfView(ctrl))
+            {
+                ctrl->_absoluteClipBounds.set(0, 0, 0, 0);
+                ctrl->_viewportClipBounds.set(0, 0, 0, 0);
+                continue;
+            }
+
             bool changed = ctrl->updateBoundsInternal(_scrollPosition);
 
             // If the child bounds have changed, dirty our bounds and all of our
@@ -642,6 +670,20 @@ bool Container::updateChildBounds()
     return result;
 }
 
+bool Container::isScrolledOutOfView(const Control* control) const
+{
+    // Only controls positioned in absolute pixels can be tested before their bounds
+    // are updated, since percentages and alignment depend on this container.
+    if (_scroll == SCROLL_NONE || control->_boundsBits != 0 || control->_alignment != ALIGN_TOP_LEFT)
+        return false;
+
+    const Rectangle& bounds = control->_bounds;
+    float x = bounds.x + _scrollPosition.x;
+    float y = bounds.y + _scrollPosition.y;
+
+    return (x + bounds.width < 0 || y + bounds.height < 0 || x > _viewportBounds.width || y > _viewportBounds.height);
+}
+
 unsigned int Container::draw(Form* form, const Rectangle& clip)
 {
     if (!_visible)
@@ -654,7 +696,7 @@ unsigned int Container::draw(Form* form, const Rectangle& clip)
     for (size_t i = 0, count = _controls.size(); i < count; ++i)
     {
         Control* control = _controls[i];
-        if (control && control->_absoluteClipBounds.intersects(_absoluteClipBounds))
+        if (control && !isScrolledOutOfView(control) && control->_absoluteClipBounds.intersects(_absoluteClipBounds))
         {
             drawCalls += control->draw(form, _viewportClipBounds);
         }
@@ -1073,8 +1115,7 @@ void Container::updateScroll()
 
     // Calculate total width and height.
     _totalWidth = _totalHeight = 0.0f;
-    std::vector<Control*> controls = getControls();
-    for (size_t i = 0, count = controls.size(); i < count; ++i)
+    for (size_t i = 0, count = _controls.size(); i < count; ++i)
     {
         Control* control = _controls[i];
 
@@ -1218,7 +1259,16 @@ bool Container::touchEventScroll(Touch::TouchEvent evt, int x, int y, unsigned i
             }
             _scrollBarOpacity = 1.0f;
             if (dirty)
+            {
                 setDirty(DIRTY_BOUNDS);
+            }
+            else
+            {
+                // Scrollbars are shown again, so cached form geometry is stale.
+                Form* form = getTopLevelForm();
+                if (form)
+                    form->invalidate();
+            }
             return false;
         }
         break;
@@ -1552,8 +1602,15 @@ void Container::setAnimationPropertyValue(int propertyId, AnimationValue* value,
     switch(propertyId)
     {
     case ANIMATE_SCROLLBAR_OPACITY:
+    {
         _scrollBarOpacity = Curve::lerp(blendWeight, _opacity, value->getFloat(0));
+
+        // Scrollbars are drawn with the container, so cached form geometry is stale.
+        Form* form = getTopLevelForm();
+        if (form)
+            form->invalidate();
         break;
+    }
     default:
         Control::setAnimationPropertyValue(propertyId, value, blendWeight);
         break;
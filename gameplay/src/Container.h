@@ -571,6 +571,10 @@ private:
     void clearContacts();
     bool inContact();
 
+    // Returns true if the child lies entirely outside the viewport of this scrolling
+    // container, in which case its bounds update and drawing are skipped.
+    bool isScrolledOutOfView(const Control* control) const;
+
     AnimationClip* _scrollBarOpacityClip;
     int _zIndexDefault;
     bool _selectButtonDown;
@@ -48,7 +48,7 @@ static bool parseCoordPair(const char* s, float* v1, float* v2, bool* v1Percenta
 Control::Control()
     : _id(""), _boundsBits(0), _dirtyBits(DIRTY_BOUNDS | DIRTY_STATE), _consumeInputEvents(true), _alignment(ALIGN_TOP_LEFT),
     _autoSize(AUTO_SIZE_BOTH), _style(NULL), _listeners(NULL), _visible(true), _zIndex(-1),
-    _contactIndex(INVALID_CONTACT_INDEX), _focusIndex(-1), _canFocus(false), _state(NORMAL), _parent(NULL), _styleOverridden(false), _skin(NULL)
+    _contactIndex(INVALID_CONTACT_INDEX), _focusIndex(-1), _canFocus(false), _state(NORMAL), _parent(NULL), _form(NULL), _styleOverridden(false), _skin(NULL)
 {
     addScriptEvent("controlEvent", "<Control>[Control::Listener::EventType]");
 }
@@ -962,6 +962,7 @@ void Control::setZIndex(int zIndex)
         {
 			_parent->sortControls();
         }
+        invalidateForm();
     }
 }
 
@@ -1102,9 +1103,19 @@ void Control::controlEvent(Control::Listener::EventType evt)
 {
 }
 
+void Control::invalidateForm()
+{
+    Form* form = getTopLevelForm();
+    if (form)
+        form->invalidate();
+}
+
 void Control::setDirty(int bits)
 {
     _dirtyBits |= bits;
+
+    // Cached form geometry no longer reflects this control.
+    invalidateForm();
 }
 
 bool Control::isDirty(int bit) const
@@ -1122,9 +1133,17 @@ void Control::update(float elapsedTime)
 
     // Since opacity is pre-multiplied, we compute it every frame so that we don't need to
     // dirty the entire hierarchy any time a state changes (which could affect opacity).
+    float opacity = _opacity;
     _opacity = getOpacity(state);
     if (_parent)
         _opacity *= _parent->_opacity;
+
+    if (_opacity != opacity)
+    {
+        Form* form = getTopLevelForm();
+        if (form)
+            form->invalidate();
+    }
 }
 
 void Control::updateState(State state)
@@ -1502,17 +1521,23 @@ bool Control::isChild(Control* control) const
 
 Form* Control::getTopLevelForm() const
 {
-    if (_parent)
-        return _parent->getTopLevelForm();
+    return _form;
+}
+
+void Control::setTopLevelForm(Form* form)
+{
+    // A form that is not inside another form is its own top level form.
+    if (!form && isContainer() && static_cast<Container*>(this)->isForm())
+        form = static_cast<Form*>(this);
+
+    _form = form;
 
     if (isContainer())
     {
-        Container* container = static_cast<Container*>(const_cast<Control*>(this));
-        if (container->isForm())
-            return static_cast<Form*>(container);
+        const std::vector<Control*>& controls = static_cast<Container*>(this)->_controls;
+        for (size_t i = 0, count = controls.size(); i < count; ++i)
+            controls[i]->setTopLevelForm(form);
     }
-
-    return NULL;
 }
 
 // Implementation of AnimationHandler
@@ -1677,6 +1702,9 @@ Theme::Style::Overlay* Control::getOverlay(State state) const
 
 void Control::overrideStyle()
 {
+    // The style is only overridden by setters that change how the control is drawn.
+    invalidateForm();
+
     if (_styleOverridden)
     {
         return;
@@ -1262,6 +1262,12 @@ protected:
      */
     virtual void controlEvent(Control::Listener::EventType evt);
 
+    /**
+     * Discards the cached geometry of the form containing this control, so that
+     * a change to how the control is drawn shows on the next frame.
+     */
+    void invalidateForm();
+
     /**
      * Sets dirty bits for the control.
      *
@@ -1401,6 +1407,11 @@ protected:
      */
     Container* _parent;
 
+    /**
+     * The control's top level form, updated as the control is added to and removed from containers.
+     */
+    Form* _form;
+
 private:
 
     /*
@@ -1430,6 +1441,8 @@ private:
 
     void addSpecificListener(Control::Listener* listener, Control::Listener::EventType eventType);
 
+    void setTopLevelForm(Form* form);
+
     bool _styleOverridden;
     Theme::Skin* _skin;
 
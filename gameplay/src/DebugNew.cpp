@@ -9,27 +9,72 @@
 #include <windows.h>
 #include <dbghelp.h>
 #pragma comment(lib,"dbghelp.lib")
+#elif defined(__GLIBC__) || defined(__APPLE__)
+#include <execinfo.h>
+#define GP_USE_EXECINFO
+#endif
+
+// Atomic operations, so that allocations can be tracked from any thread (doesn't include Base.h).
+#include "Atomic.h"
 
+// Maximum number of program counters in a stack trace
 #define MAX_STACK_FRAMES 16
-bool __trackStackTrace = false;
-#endif
+
+// Number of lists that allocation records are spread across, each with its own lock
+#define MEMORY_BUCKET_COUNT 1024
+
+// Number of source files whose allocation totals can be tracked
+#define MEMORY_FILE_COUNT 1024
+
+// Number of allocations and frees a thread buffers before adding them to the global totals
+#define MEMORY_FLUSH_INTERVAL 64
 
 struct MemoryAllocationRecord
 {
-    unsigned long address;          // address returned to the caller after allocation
-    unsigned int size;              // size of the allocation request
+    void* address;                  // address returned to the caller after allocation
+    std::size_t size;               // size of the allocation request
     const char* file;               // source file of allocation request
     int line;                       // source line of the allocation request
+    unsigned int fileIndex;         // index of the totals for the source file
+    void** stackTrace;              // NULL-terminated program counters, if the stack trace was sampled
     MemoryAllocationRecord* next;
     MemoryAllocationRecord* prev;
-#ifdef WIN32
-    bool trackStackTrace;
-    unsigned int pc[MAX_STACK_FRAMES];
-#endif
 };
 
-MemoryAllocationRecord* __memoryAllocations = 0;
-int __memoryAllocationCount = 0;
+// Size of a record rounded up so that the memory following it stays 16 byte aligned
+#define MEMORY_RECORD_SIZE ((sizeof(MemoryAllocationRecord) + 15) & ~(std::size_t)15)
+
+struct MemoryBucket
+{
+    volatile long lock;
+    MemoryAllocationRecord* records;
+};
+
+struct MemoryFileUsage
+{
+    const char* volatile file;
+    volatile long long allocationCount;
+    volatile long long size;
+};
+
+// Allocation records are hashed by address into buckets, so that threads rarely wait for each other.
+static MemoryBucket __memoryBuckets[MEMORY_BUCKET_COUNT];
+
+// Live totals per source file; the extra entry counts files that don't fit in the table.
+static MemoryFileUsage __memoryFiles[MEMORY_FILE_COUNT + 1];
+
+static volatile long long __memoryAllocationCount = 0;
+static volatile long long __memoryAllocationSize = 0;
+static unsigned int __stackTraceSampleRate = 0;
+
+// Changes to the global totals made by this thread that haven't been added to them yet,
+// so that threads don't all update the same counters on every allocation.
+static GP_THREAD_LOCAL long long __threadAllocationCount = 0;
+static GP_THREAD_LOCAL long long __threadAllocationSize = 0;
+static GP_THREAD_LOCAL unsigned int __threadOperationCount = 0;
+
+// Allocations made by this thread since its last sampled stack trace.
+static GP_THREAD_LOCAL unsigned int __threadStackTraceCounter = 0;
 
 void* debugAlloc(std::size_t size, const char* file, int line);
 void debugFree(void* p);
@@ -95,75 +140,121 @@ void operator delete[] (void* p, const char* file, int line) throw()
 // Include Base.h (needed for logging macros) AFTER new operator impls
 #include "Base.h"
 
+using gameplay::atomicAdd;
+using gameplay::spinLock;
+using gameplay::spinUnlock;
+
+/**
+ * Adds the changes buffered by this thread to the global totals.
+ */
+static void flushThreadTotals()
+{
+    atomicAdd(&__memoryAllocationCount, __threadAllocationCount);
+    atomicAdd(&__memoryAllocationSize, __threadAllocationSize);
+    __threadAllocationCount = 0;
+    __threadAllocationSize = 0;
+    __threadOperationCount = 0;
+}
+
+/**
+ * Buffers a change to the global totals in this thread, adding them to the totals at intervals.
+ */
+static void addThreadTotals(long long count, long long size)
+{
+    __threadAllocationCount += count;
+    __threadAllocationSize += size;
+    if (++__threadOperationCount >= MEMORY_FLUSH_INTERVAL)
+        flushThreadTotals();
+}
+
+static unsigned int getBucketIndex(const void* address)
+{
+    std::size_t hash = (std::size_t)address >> 4;
+    hash ^= hash >> 10;
+    return (unsigned int)(hash % MEMORY_BUCKET_COUNT);
+}
+
+/**
+ * Finds or adds the totals for a source file. Files are identified by the address of their
+ * __FILE__ string, so this is a short lock-free probe in the common case.
+ */
+static unsigned int getFileIndex(const char* file)
+{
+    std::size_t hash = ((std::size_t)file >> 3) * 2654435761u;
+    for (unsigned int i = 0; i < MEMORY_FILE_COUNT; ++i)
+    {
+        unsigned int index = (unsigned int)((hash + i) % MEMORY_FILE_COUNT);
+        const char* entry = __memoryFiles[index].file;
+        if (entry == NULL)
+            entry = (const char*)gameplay::atomicCompareExchangePointer((void* volatile*)&__memoryFiles[index].file, (void*)file, NULL);
+        if (entry == NULL || entry == file)
+            return index;
+    }
+    return MEMORY_FILE_COUNT;
+}
+
+/**
+ * Captures the stack trace of the current thread into a NULL-terminated array allocated with malloc().
+ */
+static void** captureStackTrace()
+{
+    void* frames[MAX_STACK_FRAMES];
+    int frameCount = 0;
+#if defined(WIN32)
+    frameCount = CaptureStackBackTrace(2, MAX_STACK_FRAMES, frames, NULL);
+#elif defined(GP_USE_EXECINFO)
+    frameCount = backtrace(frames, MAX_STACK_FRAMES);
+#endif
+    if (frameCount <= 0)
+        return NULL;
+
+    void** stackTrace = (void**)malloc(sizeof(void*) * (frameCount + 1));
+    if (stackTrace)
+    {
+        memcpy(stackTrace, frames, sizeof(void*) * frameCount);
+        stackTrace[frameCount] = NULL;
+    }
+    return stackTrace;
+}
+
 void* debugAlloc(std::size_t size, const char* file, int line)
 {
     // Allocate memory + size for a MemoryAlloctionRecord
-    unsigned char* mem = (unsigned char*)malloc(size + sizeof(MemoryAllocationRecord));
+    unsigned char* mem = (unsigned char*)malloc(size + MEMORY_RECORD_SIZE);
 
     MemoryAllocationRecord* rec = (MemoryAllocationRecord*)mem;
 
     // Move memory pointer past record
-    mem += sizeof(MemoryAllocationRecord);
+    mem += MEMORY_RECORD_SIZE;
 
-    rec->address = (unsigned long)mem;
-    rec->size = (unsigned int)size;
+    rec->address = mem;
+    rec->size = size;
     rec->file = file;
     rec->line = line;
-    rec->next = __memoryAllocations;
-    rec->prev = 0;
+    rec->fileIndex = getFileIndex(file);
+    rec->stackTrace = NULL;
 
-    // Capture the stack frame (up to MAX_STACK_FRAMES) if we 
-    // are running on Windows and the user has enabled it.
-#if defined(WIN32) && defined(_M_IX86)
-    rec->trackStackTrace = __trackStackTrace;
-    if (rec->trackStackTrace)
+    // Capture the stack trace of one in every __stackTraceSampleRate allocations of each thread.
+    unsigned int sampleRate = __stackTraceSampleRate;
+    if (sampleRate != 0 && ++__threadStackTraceCounter >= sampleRate)
     {
-        static bool initialized = false;
-        if (!initialized)
-        {
-            if (!SymInitialize(GetCurrentProcess(), NULL, true))
-                gameplay::print("Stack trace tracking will not work.\n");
-            initialized = true;
-        }
-    
-        // Get the current context (state of EBP, EIP, ESP registers).
-        static CONTEXT context;
-        RtlCaptureContext(&context);
-    
-        static STACKFRAME64 stackFrame;
-        memset(&stackFrame, 0, sizeof(STACKFRAME64));
-
-        // Initialize the stack frame based on the machine architecture.
-#ifdef _M_IX86
-        static const DWORD machineType = IMAGE_FILE_MACHINE_I386;
-        stackFrame.AddrPC.Offset = context.Eip;
-        stackFrame.AddrPC.Mode = AddrModeFlat;
-        stackFrame.AddrFrame.Offset = context.Ebp;
-        stackFrame.AddrFrame.Mode = AddrModeFlat;
-        stackFrame.AddrStack.Offset = context.Esp;
-        stackFrame.AddrStack.Mode = AddrModeFlat;
-#else
-#error "Machine architecture not supported!"
-#endif
-
-        // Walk up the stack and store the program counters.
-        memset(rec->pc, 0, sizeof(rec->pc));
-        for (int i = 0; i < MAX_STACK_FRAMES; i++)
-        {
-            rec->pc[i] = stackFrame.AddrPC.Offset;
-            if (!StackWalk64(machineType, GetCurrentProcess(), GetCurrentThread(), &stackFrame,
-                &context, NULL, SymFunctionTableAccess64, SymGetModuleBase64, NULL))
-            {
-                break;
-            }
-        }
+        __threadStackTraceCounter = 0;
+        rec->stackTrace = captureStackTrace();
     }
-#endif
 
-    if (__memoryAllocations)
-        __memoryAllocations->prev = rec;
-    __memoryAllocations = rec;
-    ++__memoryAllocationCount;
+    atomicAdd(&__memoryFiles[rec->fileIndex].allocationCount, 1);
+    atomicAdd(&__memoryFiles[rec->fileIndex].size, (long long)size);
+    addThreadTotals(1, (long long)size);
+
+    // Link this item in
+    MemoryBucket& bucket = __memoryBuckets[getBucketIndex(mem)];
+    spinLock(&bucket.lock);
+    rec->next = bucket.records;
+    rec->prev = 0;
+    if (bucket.records)
+        bucket.records->prev = rec;
+    bucket.records = rec;
+    spinUnlock(&bucket.lock);
 
     return mem;
 }
@@ -174,27 +265,34 @@ void debugFree(void* p)
         return;
 
     // Backup passed in pointer to access memory allocation record
-    void* mem = ((unsigned char*)p) - sizeof(MemoryAllocationRecord);
+    void* mem = ((unsigned char*)p) - MEMORY_RECORD_SIZE;
 
     MemoryAllocationRecord* rec = (MemoryAllocationRecord*)mem;
 
     // Sanity check: ensure that address in record matches passed in address
-    if (rec->address != (unsigned long)p)
+    if (rec->address != p)
     {
         gameplay::print("[memory] CORRUPTION: Attempting to free memory address with invalid memory allocation record.\n");
         return;
     }
 
     // Link this item out
-    if (__memoryAllocations == rec)
-        __memoryAllocations = rec->next;
+    MemoryBucket& bucket = __memoryBuckets[getBucketIndex(p)];
+    spinLock(&bucket.lock);
+    if (bucket.records == rec)
+        bucket.records = rec->next;
     if (rec->prev)
         rec->prev->next = rec->next;
     if (rec->next)
         rec->next->prev = rec->prev;
-    --__memoryAllocationCount;
+    spinUnlock(&bucket.lock);
+
+    atomicAdd(&__memoryFiles[rec->fileIndex].allocationCount, -1);
+    atomicAdd(&__memoryFiles[rec->fileIndex].size, -(long long)rec->size);
+    addThreadTotals(-1, -(long long)rec->size);
 
     // Free the address from the original alloc location (before mem allocation record)
+    free(rec->stackTrace);
     free(mem);
 }
 
@@ -203,12 +301,19 @@ void printStackTrace(MemoryAllocationRecord* rec)
 {
     const unsigned int bufferSize = 512;
 
+    static bool initialized = false;
+    if (!initialized)
+    {
+        if (!SymInitialize(GetCurrentProcess(), NULL, true))
+            gameplay::print("Stack trace tracking will not work.\n");
+        initialized = true;
+    }
+
     // Resolve the program counter to the corresponding function names.
-    unsigned int pc;
     for (int i = 0; i < MAX_STACK_FRAMES; i++)
     {
         // Check to see if we are at the end of the stack trace.
-        pc = rec->pc[i];
+        DWORD64 pc = (DWORD64)rec->stackTrace[i];
         if (pc == 0)
             break;
 
@@ -235,71 +340,175 @@ void printStackTrace(MemoryAllocationRecord* rec)
             else
             {
                 // Get the file and line number.
-                if (pc != 0)
+                IMAGEHLP_LINE64 line;
+                DWORD displacement;
+                memset(&line, 0, sizeof(line));
+                line.SizeOfStruct = sizeof(line);
+                if (!SymGetLineFromAddr64(GetCurrentProcess(), pc, &displacement, &line))
                 {
-                    IMAGEHLP_LINE64 line;
-                    DWORD displacement;
-                    memset(&line, 0, sizeof(line));
-                    line.SizeOfStruct = sizeof(line);
-                    if (!SymGetLineFromAddr64(GetCurrentProcess(), pc, &displacement, &line))
-                    {
-                        gameplay::print("[memory] STACK TRACE: %s - <unknown file>:<unknown line number>\n", symbol->Name);
-                    }
+                    gameplay::print("[memory] STACK TRACE: %s - <unknown file>:<unknown line number>\n", symbol->Name);
+                }
+                else
+                {
+                    const char* file = strrchr(line.FileName, '\\');
+                    if(!file) 
+                        file = line.FileName;
                     else
-                    {
-                        const char* file = strrchr(line.FileName, '\\');
-                        if(!file) 
-                            file = line.FileName;
-                        else
-                            file++;
-                        
-                        gameplay::print("[memory] STACK TRACE: %s - %s:%d\n", symbol->Name, file, line.LineNumber);
-                    }
+                        file++;
+                    
+                    gameplay::print("[memory] STACK TRACE: %s - %s:%d\n", symbol->Name, file, line.LineNumber);
                 }
             }
         }
     }
 }
+#else
+void printStackTrace(MemoryAllocationRecord* rec)
+{
+    int frameCount = 0;
+    while (frameCount < MAX_STACK_FRAMES && rec->stackTrace[frameCount])
+        ++frameCount;
+
+#ifdef GP_USE_EXECINFO
+    char** symbols = backtrace_symbols(rec->stackTrace, frameCount);
+    if (symbols)
+    {
+        for (int i = 0; i < frameCount; i++)
+        {
+            gameplay::print("[memory] STACK TRACE: %s\n", symbols[i]);
+        }
+        free(symbols);
+        return;
+    }
+#endif
+    for (int i = 0; i < frameCount; i++)
+    {
+        gameplay::print("[memory] STACK TRACE: %p\n", rec->stackTrace[i]);
+    }
+}
 #endif
 
 extern void printMemoryLeaks()
 {
-    // Dump general heap memory leaks
-    if (__memoryAllocationCount == 0)
+    // Dump general heap memory leaks. This is called at exit, when no other threads are
+    // allocating, so the records are not locked while they are printed. Threads may not
+    // have added all their allocations to the global totals, so count the records.
+    long long allocationCount = 0;
+    for (unsigned int i = 0; i < MEMORY_BUCKET_COUNT; ++i)
+    {
+        for (MemoryAllocationRecord* rec = __memoryBuckets[i].records; rec != NULL; rec = rec->next)
+            ++allocationCount;
+    }
+    if (allocationCount == 0)
     {
         gameplay::print("[memory] All HEAP allocations successfully cleaned up (no leaks detected).\n");
     }
     else
     {
-        gameplay::print("[memory] WARNING: %d HEAP allocations still active in memory.\n", __memoryAllocationCount);
-        MemoryAllocationRecord* rec = __memoryAllocations;
-        while (rec)
+        gameplay::print("[memory] WARNING: %d HEAP allocations still active in memory.\n", (int)allocationCount);
+        for (unsigned int i = 0; i < MEMORY_BUCKET_COUNT; ++i)
         {
-#ifdef WIN32
-            if (rec->trackStackTrace)
+            for (MemoryAllocationRecord* rec = __memoryBuckets[i].records; rec != NULL; rec = rec->next)
             {
-                gameplay::print("[memory] LEAK: HEAP allocation leak at address %#x of size %d:\n", rec->address, rec->size);
-                printStackTrace(rec);
+                if (rec->stackTrace)
+                {
+                    gameplay::print("[memory] LEAK: HEAP allocation leak at address %p of size %d:\n", rec->address, (int)rec->size);
+                    printStackTrace(rec);
+                }
+                else
+                {
+                    gameplay::print("[memory] LEAK: HEAP allocation leak at address %p of size %d from line %d in file '%s'.\n", rec->address, (int)rec->size, rec->line, rec->file);
+                }
             }
-            else
-                gameplay::print("[memory] LEAK: HEAP allocation leak at address %#x of size %d from line %d in file '%s'.\n", rec->address, rec->size, rec->line, rec->file);
-#else
-            gameplay::print("[memory] LEAK: HEAP allocation leak at address %#x of size %d from line %d in file '%s'.\n", rec->address, rec->size, rec->line, rec->file);
-#endif
-            rec = rec->next;
         }
     }
 }
 
+unsigned int getMemoryAllocationCount()
+{
+    flushThreadTotals();
+    return (unsigned int)atomicAdd(&__memoryAllocationCount, 0);
+}
+
+size_t getMemoryAllocationSize()
+{
+    flushThreadTotals();
+    return (size_t)atomicAdd(&__memoryAllocationSize, 0);
+}
+
+unsigned int getMemoryUsage(MemoryUsage* usage, unsigned int count)
+{
+    unsigned int usageCount = 0;
+    for (unsigned int i = 0; i <= MEMORY_FILE_COUNT && usageCount < count; ++i)
+    {
+        MemoryFileUsage& fileUsage = __memoryFiles[i];
+        long long allocationCount = atomicAdd(&fileUsage.allocationCount, 0);
+        if (allocationCount <= 0)
+            continue;
+
+        MemoryUsage& u = usage[usageCount++];
+        u.file = i == MEMORY_FILE_COUNT ? "<other>" : fileUsage.file;
+        if (u.file == NULL || *u.file == '\0')
+            u.file = "<unknown>";
+        u.allocationCount = (unsigned int)allocationCount;
+        u.size = (size_t)atomicAdd(&fileUsage.size, 0);
+    }
+    return usageCount;
+}
+
+static bool compareMemoryUsageFile(const MemoryUsage& a, const MemoryUsage& b)
+{
+    return strcmp(a.file, b.file) < 0;
+}
+
+static bool compareMemoryUsageSize(const MemoryUsage& a, const MemoryUsage& b)
+{
+    return a.size > b.size;
+}
+
+void printMemoryUsage()
+{
+    // Headers compiled into several translation units have a __FILE__ string in each,
+    // so merge the totals of entries with the same name.
+    static MemoryUsage usage[MEMORY_FILE_COUNT + 1];
+    unsigned int count = getMemoryUsage(usage, MEMORY_FILE_COUNT + 1);
+    std::sort(usage, usage + count, compareMemoryUsageFile);
+    unsigned int merged = 0;
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        if (merged > 0 && strcmp(usage[merged - 1].file, usage[i].file) == 0)
+        {
+            usage[merged - 1].allocationCount += usage[i].allocationCount;
+            usage[merged - 1].size += usage[i].size;
+        }
+        else
+        {
+            usage[merged++] = usage[i];
+        }
+    }
+    std::sort(usage, usage + merged, compareMemoryUsageSize);
+
+    gameplay::print("[memory] %u HEAP allocations using %u bytes.\n", getMemoryAllocationCount(), (unsigned int)getMemoryAllocationSize());
+    for (unsigned int i = 0; i < merged; ++i)
+    {
+        gameplay::print("[memory] %10u bytes in %8u allocations from '%s'.\n", (unsigned int)usage[i].size, usage[i].allocationCount, usage[i].file);
+    }
+}
+
+void setStackTraceSampleRate(unsigned int rate)
+{
+    __stackTraceSampleRate = rate;
+}
+
 #if defined(WIN32)
 void setTrackStackTrace(bool trackStackTrace)
 {
-    __trackStackTrace = trackStackTrace;
+    __stackTraceSampleRate = trackStackTrace ? 1 : 0;
 }
 
 void toggleTrackStackTrace()
 {
-    __trackStackTrace = !__trackStackTrace;
+    __stackTraceSampleRate = __stackTraceSampleRate ? 0 : 1;
 }
 #endif
 
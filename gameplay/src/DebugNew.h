@@ -14,6 +14,46 @@
 // Prints all heap and reference leaks to stderr.
 extern void printMemoryLeaks();
 
+/**
+ * The heap memory currently allocated from one source file.
+ */
+struct MemoryUsage
+{
+    const char* file;               // source file of the allocations, or "<unknown>"
+    unsigned int allocationCount;   // number of live allocations
+    std::size_t size;               // total size of the live allocations in bytes
+};
+
+// Returns the number of live heap allocations. Each thread adds its allocations to the
+// total in batches, so allocations made on other threads may not be counted yet.
+extern unsigned int getMemoryAllocationCount();
+
+// Returns the total size of the live heap allocations in bytes (counted like getMemoryAllocationCount).
+extern std::size_t getMemoryAllocationSize();
+
+/**
+ * Gets a snapshot of the live heap allocations grouped by source file, without allocating memory.
+ *
+ * @param usage The array to fill in.
+ * @param count The number of entries in the array.
+ *
+ * @return The number of entries filled in.
+ */
+extern unsigned int getMemoryUsage(MemoryUsage* usage, unsigned int count);
+
+// Prints the live heap allocations grouped by source file, largest first.
+extern void printMemoryUsage();
+
+/**
+ * Sets how often the stack trace of a heap allocation is captured, so that it can be printed if the allocation leaks.
+ *
+ * Capturing a stack trace is slow, so by default no stack traces are captured.
+ *
+ * @param rate The stack trace of one in every rate allocations made by each thread is captured,
+ *      or 0 to capture none.
+ */
+extern void setStackTraceSampleRate(unsigned int rate);
+
 // global new/delete operator overloads
 #ifdef _MSC_VER
 #pragma warning( disable : 4290 ) // C++ exception specification ignored.
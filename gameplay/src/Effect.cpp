@@ -2,6 +2,7 @@
 #include "Effect.h"
 #include "FileSystem.h"
 #include "Game.h"
+#include "ResourceCache.h"
 
 #define OPENGL_ES_DEFINE  "OPENGL_ES"
 
@@ -9,7 +10,12 @@ namespace gameplay
 {
 
 // Cache of unique effects.
-static std::map<std::string, Effect*> __effectCache;
+static ResourceCache* __effectCache = NULL;
+
+static ResourceCache* getEffectCache()
+{
+    return ResourceCache::get(&__effectCache, "Effect");
+}
 static Effect* __currentEffect = NULL;
 
 Effect::Effect() : _program(0)
@@ -19,7 +25,8 @@ Effect::Effect() : _program(0)
 Effect::~Effect()
 {
     // Remove this effect from the cache.
-    __effectCache.erase(_id);
+    if (__effectCache)
+        __effectCache->remove(this);
 
     // Free uniforms.
     for (std::map<std::string, Uniform*>::iterator itr = _uniforms.begin(); itr != _uniforms.end(); ++itr)
@@ -55,13 +62,13 @@ Effect* Effect::createFromFile(const char* vshPath, const char* fshPath, const c
     {
         uniqueId += defines;
     }
-    std::map<std::string, Effect*>::const_iterator itr = __effectCache.find(uniqueId);
-    if (itr != __effectCache.end())
+    Effect* cached = static_cast<Effect*>(getEffectCache()->find(uniqueId.c_str()));
+    if (cached)
     {
         // Found an exiting effect with this id, so increase its ref count and return it.
-        GP_ASSERT(itr->second);
-        itr->second->addRef();
-        return itr->second;
+        getEffectCache()->use(cached);
+        cached->addRef();
+        return cached;
     }
 
     // Read source from file.
@@ -92,7 +99,7 @@ Effect* Effect::createFromFile(const char* vshPath, const char* fshPath, const c
     {
         // Store this effect in the cache.
         effect->_id = uniqueId;
-        __effectCache[uniqueId] = effect;
+        getEffectCache()->add(uniqueId.c_str(), effect);
     }
 
     return effect;
@@ -2,10 +2,13 @@
 #include "FileSystem.h"
 #include "Properties.h"
 #include "Stream.h"
+#include "BufferedStream.h"
 #include "Platform.h"
+#include "Atomic.h"
 
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <zlib.h>
 
 #ifdef WIN32
     #include <windows.h>
@@ -27,6 +30,9 @@
 extern AAssetManager* __assetManager;
 #endif
 
+#define ARCHIVE_VERSION_MAJOR_REQUIRED 1
+#define ARCHIVE_VERSION_MINOR_REQUIRED 0
+
 namespace gameplay
 {
 
@@ -89,6 +95,81 @@ static bool androidFileExists(const char* filePath)
 static std::string __resourcePath("./");
 static std::map<std::string, std::string> __aliases;
 
+/**
+ * An entry in the directory of a resource archive.
+ *
+ * @script{ignore}
+ */
+struct ArchiveEntry
+{
+    unsigned int hash;
+    unsigned int nameOffset;
+    unsigned int offset;
+    unsigned int size;
+    unsigned int storedSize;
+};
+
+/**
+ * The open file of a mounted archive, shared by the archive and the streams reading from it.
+ *
+ * @script{ignore}
+ */
+struct ArchiveFile
+{
+    FILE* file;
+    // Held while seeking and reading, since all streams share the file position.
+    volatile long lock;
+    // One reference for the mounted archive and one for each open stream.
+    volatile long refCount;
+};
+
+/**
+ * A mounted resource archive.
+ *
+ * @script{ignore}
+ */
+struct Archive
+{
+    std::string path;
+    std::string mountPath;
+    ArchiveFile* file;
+    // Sorted by hash and then by name, as written by the encoder.
+    std::vector<ArchiveEntry> entries;
+    std::vector<char> names;
+};
+
+/** @script{ignore} */
+static std::list<Archive> __archives;
+
+/**
+ * Releases a reference to an archive file, closing it when the last reference is released.
+ */
+static void releaseArchiveFile(ArchiveFile* file)
+{
+    GP_ASSERT(file);
+    if (atomicAdd(&file->refCount, -1) == 1)
+    {
+        fclose(file->file);
+        SAFE_DELETE(file);
+    }
+}
+
+/**
+ * Reads from an archive file at the specified offset.
+ *
+ * @return The number of elements read.
+ */
+static size_t readArchiveFile(ArchiveFile* file, long int offset, void* ptr, size_t size, size_t count)
+{
+    spinLock(&file->lock);
+    if (fseek(file->file, offset, SEEK_SET) == 0)
+        count = fread(ptr, size, count, file->file);
+    else
+        count = 0;
+    spinUnlock(&file->lock);
+    return count;
+}
+
 /**
  * Gets the fully resolved path.
  * If the path is relative then it will be prefixed with the resource path.
@@ -110,6 +191,70 @@ static void getFullPath(const char* path, std::string& fullPath)
     }
 }
 
+/**
+ * Hashes a path within an archive (32-bit FNV-1a). Must match the hash used by the encoder.
+ */
+static unsigned int hashPath(const char* path)
+{
+    unsigned int hash = 2166136261u;
+    while (*path)
+    {
+        hash ^= (unsigned char)*path++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * Skips any leading "./" in a relative path.
+ */
+static const char* skipCurrentDirectory(const char* path)
+{
+    while (path[0] == '.' && path[1] == '/')
+        path += 2;
+    return path;
+}
+
+static bool compareEntryHash(const ArchiveEntry& entry, unsigned int hash)
+{
+    return entry.hash < hash;
+}
+
+/**
+ * Searches the mounted archives for a file.
+ * 
+ * @param path The resolved path of the file, relative to the resource path.
+ * @param archive The archive containing the file. (out param)
+ * 
+ * @return The directory entry of the file, or NULL if no mounted archive contains it.
+ */
+static const ArchiveEntry* findArchiveEntry(const char* path, const Archive** archive)
+{
+    if (__archives.empty() || FileSystem::isAbsolutePath(path))
+        return NULL;
+
+    path = skipCurrentDirectory(path);
+    for (std::list<Archive>::const_iterator itr = __archives.begin(); itr != __archives.end(); ++itr)
+    {
+        const std::string& mountPath = itr->mountPath;
+        if (strncmp(path, mountPath.c_str(), mountPath.length()) != 0)
+            continue;
+
+        const char* name = path + mountPath.length();
+        unsigned int hash = hashPath(name);
+        std::vector<ArchiveEntry>::const_iterator entry = std::lower_bound(itr->entries.begin(), itr->entries.end(), hash, compareEntryHash);
+        for (; entry != itr->entries.end() && entry->hash == hash; ++entry)
+        {
+            if (strcmp(&itr->names[entry->nameOffset], name) == 0)
+            {
+                *archive = &(*itr);
+                return &(*entry);
+            }
+        }
+    }
+    return NULL;
+}
+
 /**
  * 
  * @script{ignore}
@@ -144,6 +289,42 @@ private:
     bool _canWrite;
 };
 
+/**
+ * A stream for reading a file stored uncompressed in a mounted archive.
+ * 
+ * @script{ignore}
+ */
+class ArchiveStream : public Stream
+{
+public:
+    friend class FileSystem;
+    
+    ~ArchiveStream();
+    virtual bool canRead();
+    virtual bool canWrite();
+    virtual bool canSeek();
+    virtual void close();
+    virtual size_t read(void* ptr, size_t size, size_t count);
+    virtual char* readLine(char* str, int num);
+    virtual size_t write(const void* ptr, size_t size, size_t count);
+    virtual bool eof();
+    virtual size_t length();
+    virtual long int position();
+    virtual bool seek(long int offset, int origin);
+    virtual bool rewind();
+
+    static Stream* create(const Archive& archive, const ArchiveEntry& entry);
+
+private:
+    ArchiveStream(ArchiveFile* file, long int offset, size_t length);
+
+private:
+    ArchiveFile* _file;
+    long int _offset;
+    size_t _length;
+    size_t _position;
+};
+
 #ifdef __ANDROID__
 
 /**
@@ -225,6 +406,114 @@ void FileSystem::loadResourceAliases(Properties* properties)
     }
 }
 
+bool FileSystem::mountArchive(const char* archivePath, const char* mountPath)
+{
+    GP_ASSERT(archivePath);
+
+    // Files are read from the archive with fopen, so it must exist on the file system.
+    createFileFromAsset(archivePath);
+
+    Archive archive;
+    archive.file = NULL;
+    getFullPath(archivePath, archive.path);
+    std::auto_ptr<Stream> stream(FileStream::create(archive.path.c_str(), "rb"));
+    if (stream.get() == NULL)
+    {
+        GP_WARN("Failed to open archive '%s'.", archivePath);
+        return false;
+    }
+
+    // Read the archive header.
+    char sig[9];
+    if (stream->read(sig, 1, 9) != 9 || memcmp(sig, "\xABGPK\xBB\r\n\x1A\n", 9) != 0)
+    {
+        GP_WARN("Invalid archive header for archive '%s'.", archivePath);
+        return false;
+    }
+
+    unsigned char version[2];
+    if (stream->read(version, 1, 2) != 2)
+    {
+        GP_WARN("Failed to read archive version for archive '%s'.", archivePath);
+        return false;
+    }
+    if (version[0] != ARCHIVE_VERSION_MAJOR_REQUIRED || version[1] < ARCHIVE_VERSION_MINOR_REQUIRED)
+    {
+        GP_WARN("Unsupported version (%d.%d) for archive '%s' (expected %d.%d).", (int)version[0], (int)version[1], archivePath, ARCHIVE_VERSION_MAJOR_REQUIRED, ARCHIVE_VERSION_MINOR_REQUIRED);
+        return false;
+    }
+
+    unsigned int entryCount;
+    unsigned int namesSize;
+    if (stream->read(&entryCount, 4, 1) != 1 || stream->read(&namesSize, 4, 1) != 1)
+    {
+        GP_WARN("Failed to read directory size for archive '%s'.", archivePath);
+        return false;
+    }
+
+    // Read the directory and the names it refers to.
+    archive.entries.resize(entryCount);
+    archive.names.resize(namesSize + 1);
+    if ((entryCount > 0 && stream->read(&archive.entries[0], sizeof(ArchiveEntry), entryCount) != entryCount) ||
+        (namesSize > 0 && stream->read(&archive.names[0], 1, namesSize) != namesSize))
+    {
+        GP_WARN("Failed to read directory for archive '%s'.", archivePath);
+        return false;
+    }
+    archive.names[namesSize] = '\0';
+
+    size_t archiveLength = stream->length();
+    for (unsigned int i = 0; i < entryCount; ++i)
+    {
+        const ArchiveEntry& entry = archive.entries[i];
+        if (entry.nameOffset >= namesSize || entry.offset > archiveLength || entry.storedSize > archiveLength - entry.offset)
+        {
+            GP_WARN("Invalid directory entry %d in archive '%s'.", i, archivePath);
+            return false;
+        }
+    }
+
+    if (mountPath)
+    {
+        archive.mountPath = skipCurrentDirectory(mountPath);
+        if (!archive.mountPath.empty() && archive.mountPath[archive.mountPath.length() - 1] != '/')
+            archive.mountPath += '/';
+    }
+
+    // Keep the archive open while it is mounted, rather than opening it for each file.
+    FILE* file = fopen(archive.path.c_str(), "rb");
+    if (file == NULL)
+    {
+        GP_WARN("Failed to open archive '%s'.", archivePath);
+        return false;
+    }
+    archive.file = new ArchiveFile();
+    archive.file->file = file;
+    archive.file->lock = 0;
+    archive.file->refCount = 1;
+
+    __archives.push_front(archive);
+    return true;
+}
+
+void FileSystem::unmountArchive(const char* archivePath)
+{
+    GP_ASSERT(archivePath);
+
+    std::string fullPath;
+    getFullPath(archivePath, fullPath);
+    for (std::list<Archive>::iterator itr = __archives.begin(); itr != __archives.end(); ++itr)
+    {
+        if (itr->path == fullPath)
+        {
+            // The file stays open until the streams reading from it are closed.
+            releaseArchiveFile(itr->file);
+            __archives.erase(itr);
+            return;
+        }
+    }
+}
+
 std::string FileSystem::displayFileDialog(size_t dialogMode, const char* title, const char* filterDescription, const char* filterExtensions, const char* initialDirectory)
 {
     return Platform::displayFileDialog(dialogMode, title, filterDescription, filterExtensions, initialDirectory);
@@ -343,6 +632,12 @@ bool FileSystem::fileExists(const char* filePath)
 {
     GP_ASSERT(filePath);
 
+    const Archive* archive;
+    if (findArchiveEntry(resolvePath(filePath), &archive))
+    {
+        return true;
+    }
+
 #ifdef __ANDROID__
     if (androidFileExists(resolvePath(filePath)))
     {
@@ -363,6 +658,13 @@ Stream* FileSystem::open(const char* path, size_t streamMode)
     char modeStr[] = "rb";
     if ((streamMode & WRITE) != 0)
         modeStr[0] = 'w';
+    else
+    {
+        const Archive* archive;
+        const ArchiveEntry* entry = findArchiveEntry(resolvePath(path), &archive);
+        if (entry)
+            return ArchiveStream::create(*archive, *entry);
+    }
 #ifdef __ANDROID__
     if ((streamMode & WRITE) != 0)
     {
@@ -691,6 +993,152 @@ bool FileStream::rewind()
 
 ////////////////////////////////
 
+ArchiveStream::ArchiveStream(ArchiveFile* file, long int offset, size_t length)
+    : _file(file), _offset(offset), _length(length), _position(0)
+{
+}
+
+ArchiveStream::~ArchiveStream()
+{
+    close();
+}
+
+Stream* ArchiveStream::create(const Archive& archive, const ArchiveEntry& entry)
+{
+    GP_ASSERT(archive.file);
+
+    // Files stored uncompressed are read from the archive as needed.
+    if (entry.storedSize == entry.size)
+    {
+        atomicAdd(&archive.file->refCount, 1);
+        return new ArchiveStream(archive.file, entry.offset, entry.size);
+    }
+
+    // Compressed files are read and decompressed all at once, and then read from memory.
+    unsigned char* stored = new unsigned char[entry.storedSize];
+    size_t read = readArchiveFile(archive.file, entry.offset, stored, 1, entry.storedSize);
+
+    char* data = new char[entry.size];
+    uLongf length = entry.size;
+    int result = read == entry.storedSize ? uncompress((Bytef*)data, &length, stored, entry.storedSize) : Z_DATA_ERROR;
+    SAFE_DELETE_ARRAY(stored);
+    if (result != Z_OK || length != entry.size)
+    {
+        GP_WARN("Failed to decompress '%s' from archive '%s'.", &archive.names[entry.nameOffset], archive.path.c_str());
+        SAFE_DELETE_ARRAY(data);
+        return NULL;
+    }
+
+    return BufferedStream::create(data, entry.size);
+}
+
+bool ArchiveStream::canRead()
+{
+    return _file != NULL;
+}
+
+bool ArchiveStream::canWrite()
+{
+    return false;
+}
+
+bool ArchiveStream::canSeek()
+{
+    return _file != NULL;
+}
+
+void ArchiveStream::close()
+{
+    if (_file)
+        releaseArchiveFile(_file);
+    _file = NULL;
+}
+
+size_t ArchiveStream::read(void* ptr, size_t size, size_t count)
+{
+    if (!canRead() || size == 0)
+        return 0;
+
+    // Don't read past the end of the file into the rest of the archive.
+    count = readArchiveFile(_file, _offset + (long int)_position, ptr, size, std::min(count, (_length - _position) / size));
+    _position += size * count;
+    return count;
+}
+
+char* ArchiveStream::readLine(char* str, int num)
+{
+    if (!canRead() || num <= 0 || _position >= _length)
+        return NULL;
+
+    int max = (int)std::min((size_t)num, _length - _position + 1);
+    spinLock(&_file->lock);
+    char* result = NULL;
+    if (fseek(_file->file, _offset + (long int)_position, SEEK_SET) == 0)
+    {
+        result = fgets(str, max, _file->file);
+        _position = (size_t)(ftell(_file->file) - _offset);
+    }
+    spinUnlock(&_file->lock);
+    return result;
+}
+
+size_t ArchiveStream::write(const void* ptr, size_t size, size_t count)
+{
+    return 0;
+}
+
+bool ArchiveStream::eof()
+{
+    return !canRead() || _position >= _length;
+}
+
+size_t ArchiveStream::length()
+{
+    return _length;
+}
+
+long int ArchiveStream::position()
+{
+    if (!canRead())
+        return -1;
+    return (long int)_position;
+}
+
+bool ArchiveStream::seek(long int offset, int origin)
+{
+    if (!canSeek())
+        return false;
+
+    long int position;
+    switch (origin)
+    {
+    case SEEK_SET:
+        position = offset;
+        break;
+    case SEEK_CUR:
+        position = (long int)_position + offset;
+        break;
+    case SEEK_END:
+        position = (long int)_length + offset;
+        break;
+    default:
+        return false;
+    }
+    if (position < 0 || position > (long int)_length)
+        return false;
+
+    // The file is positioned when reading, since other streams share it.
+    _position = (size_t)position;
+    return true;
+}
+
+bool ArchiveStream::rewind()
+{
+    return seek(0, SEEK_SET);
+}
+
+////////////////////////////////
+
 #ifdef __ANDROID__
 
 FileStreamAndroid::FileStreamAndroid(AAsset* asset)
@@ -96,6 +96,36 @@ public:
      */
     static void loadResourceAliases(Properties* properties);
 
+    /**
+     * Mounts a resource archive created with the gameplay-encoder.
+     *
+     * Once mounted, the files in the archive can be read through open(), readAll()
+     * and fileExists() as if they were loose files under the mount path. Archives
+     * are searched before the file system, the most recently mounted first.
+     * openFile() and listFiles() only see loose files. The archive file is kept
+     * open until it is unmounted and the streams opened from it are closed.
+     *
+     * @param archivePath Path to the archive file, relative to the resource path.
+     * @param mountPath The path that the files in the archive appear under (Ex. "res/"),
+     *      relative to the resource path. May be NULL to mount at the resource path.
+     *
+     * @return True if the archive was mounted, false if it could not be read.
+     *
+     * @script{ignore}
+     */
+    static bool mountArchive(const char* archivePath, const char* mountPath = NULL);
+
+    /**
+     * Unmounts a resource archive that was mounted with mountArchive().
+     *
+     * Streams already opened from the archive remain valid.
+     *
+     * @param archivePath Path to the archive file, as passed to mountArchive().
+     *
+     * @script{ignore}
+     */
+    static void unmountArchive(const char* archivePath);
+
     /**
      * Displays an open or save dialog using the native platform dialog system.
      *
@@ -152,6 +182,8 @@ public:
      * If <code>path</code> is a file path, the file at the specified location is opened relative to the currently set
      * resource path.
      *
+     * When opening for reading, mounted archives are searched for the file before the file system.
+     *
      * @param path The path to the resource to be opened, relative to the currently set resource path.
      * @param streamMode The stream mode used to open the file.
      * 
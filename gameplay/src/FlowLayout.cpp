@@ -67,7 +67,7 @@ void FlowLayout::update(const Container* container)
     float rowY = 0;
     float tallestHeight = 0;
 
-    std::vector<Control*> controls = container->getControls();
+    const std::vector<Control*>& controls = container->getControls();
     for (size_t i = 0, controlsCount = controls.size(); i < controlsCount; i++)
     {
         Control* control = controls.at(i);
@@ -3,35 +3,348 @@
 #include "Game.h"
 #include "FileSystem.h"
 #include "Bundle.h"
+#include "ResourceCache.h"
 
 // Default font shaders
 #define FONT_VSH "res/shaders/font.vert"
 #define FONT_FSH "res/shaders/font.frag"
 
+// Longest string whose vertices can be indexed by a cached layout (4 vertices per glyph, 16-bit indices)
+#define TEXT_CACHE_MAX_LENGTH 16383
+
 namespace gameplay
 {
 
-static std::vector<Font*> __fontCache;
+// Cache of loaded fonts.
+static ResourceCache* __fontCache = NULL;
+
+static ResourceCache* getFontCache()
+{
+    return ResourceCache::get(&__fontCache, "Font");
+}
 
 static Effect* __fontEffect = NULL;
 
+static unsigned int __textCacheSize = 64;
+static unsigned int __textCacheHitCount = 0;
+static unsigned int __textCacheMissCount = 0;
+
+// Number of glyph atlas rows recycled by all fonts (see getGlyphAtlasGeneration).
+static unsigned int __glyphAtlasGeneration = 0;
+
+#ifdef GP_USE_FREETYPE
+
+// Padding between glyphs in a dynamic glyph atlas
+#define GLYPH_PADDING 1
+
+// Glyph atlas slot states for glyphs that don't occupy a shelf
+#define GLYPH_UNLOADED -1
+#define GLYPH_EMPTY -2
+
+// Number of character codes (32-255) whose glyphs are created with a dynamic font.
+// Glyphs for higher code points are added as they are first used.
+#define DYNAMIC_GLYPH_COUNT 224
+
+/**
+ * Rasterizes TrueType glyphs into a font texture as they are first used.
+ *
+ * The texture is divided into shelves one line of text high. Glyphs are packed
+ * left to right into the first shelf with enough room; once all shelves are full,
+ * the least recently used shelf is cleared and reused.
+ */
+class Font::GlyphAtlas
+{
+public:
+
+    struct Shelf
+    {
+        unsigned int y;
+        unsigned int x;
+        unsigned int lastUsed;
+        std::vector<int> glyphs;
+    };
+
+    GlyphAtlas();
+
+    ~GlyphAtlas();
+
+    int load(Font* font, int index);
+
+    int findShelf(Font* font, unsigned int width);
+
+    int findGlyph(unsigned int code);
+
+    Glyph& getGlyph(Font* font, int index);
+
+    FT_Library library;
+    FT_Face face;
+    char* fontData;
+    int baseline;
+    unsigned int rowSize;
+    unsigned int clock;
+    std::vector<Shelf> shelves;
+    std::vector<int> glyphShelves;
+    // Glyphs for code points above 255, indexed from DYNAMIC_GLYPH_COUNT.
+    // A deque keeps the glyphs in place as more are added.
+    std::deque<Glyph> extraGlyphs;
+    std::map<unsigned int, int> extraIndices;
+    unsigned char* buffer;
+};
+
+Font::GlyphAtlas::GlyphAtlas() :
+    library(NULL), face(NULL), fontData(NULL), baseline(0), rowSize(0), clock(0), buffer(NULL)
+{
+}
+
+Font::GlyphAtlas::~GlyphAtlas()
+{
+    if (face)
+        FT_Done_Face(face);
+    if (library)
+        FT_Done_FreeType(library);
+    SAFE_DELETE_ARRAY(fontData);
+    SAFE_DELETE_ARRAY(buffer);
+}
+
+int Font::GlyphAtlas::load(Font* font, int index)
+{
+    GP_ASSERT(font);
+    GP_ASSERT(font->_texture);
+
+    Glyph& glyph = getGlyph(font, index);
+    glyph.width = 0;
+    memset(glyph.uvs, 0, sizeof(glyph.uvs));
+
+    FT_Error error = FT_Load_Char(face, glyph.code, FT_LOAD_RENDER | FT_LOAD_FORCE_AUTOHINT);
+    if (error)
+    {
+        GP_WARN("Failed to rasterize character %u of font '%s' (error %d).", glyph.code, font->_path.c_str(), (int)error);
+        glyphShelves[index] = GLYPH_EMPTY;
+        return GLYPH_EMPTY;
+    }
+
+    FT_GlyphSlot slot = face->glyph;
+    const unsigned int width = slot->bitmap.width;
+    const unsigned int rows = slot->bitmap.rows;
+    const unsigned int textureWidth = font->_texture->getWidth();
+    if (width == 0 || rows == 0 || width + GLYPH_PADDING > textureWidth)
+    {
+        // Nothing to draw (e.g. whitespace), so don't take up space in the atlas.
+        glyphShelves[index] = GLYPH_EMPTY;
+        return GLYPH_EMPTY;
+    }
+
+    int shelfIndex = findShelf(font, width + GLYPH_PADDING);
+    Shelf& shelf = shelves[shelfIndex];
+
+    // Copy the glyph into a cell one line high, aligned to the font's baseline.
+    memset(buffer, 0, width * rowSize);
+    const int top = baseline - slot->bitmap_top;
+    for (unsigned int row = 0; row < rows; ++row)
+    {
+        const int y = top + (int)row;
+        if (y >= 0 && y < (int)rowSize)
+        {
+            memcpy(buffer + y * width, slot->bitmap.buffer + (int)row * slot->bitmap.pitch, width);
+        }
+    }
+    font->_texture->setData(shelf.x, shelf.y, width, rowSize, buffer);
+
+    const float textureHeight = (float)font->_texture->getHeight();
+    glyph.width = width;
+    glyph.uvs[0] = (float)shelf.x / (float)textureWidth;
+    glyph.uvs[1] = (float)shelf.y / textureHeight;
+    glyph.uvs[2] = (float)(shelf.x + width) / (float)textureWidth;
+    glyph.uvs[3] = (float)(shelf.y + rowSize) / textureHeight;
+
+    shelf.x += width + GLYPH_PADDING;
+    shelf.glyphs.push_back(index);
+    glyphShelves[index] = shelfIndex;
+
+    return shelfIndex;
+}
+
+int Font::GlyphAtlas::findShelf(Font* font, unsigned int width)
+{
+    const unsigned int textureWidth = font->_texture->getWidth();
+
+    int lru = 0;
+    for (size_t i = 0, count = shelves.size(); i < count; ++i)
+    {
+        if (shelves[i].x + width <= textureWidth)
+            return (int)i;
+
+        if (shelves[i].lastUsed < shelves[lru].lastUsed)
+            lru = (int)i;
+    }
+
+    // The atlas is full, so recycle the least recently used shelf.
+    Shelf& shelf = shelves[lru];
+    for (size_t i = 0, count = shelf.glyphs.size(); i < count; ++i)
+    {
+        glyphShelves[shelf.glyphs[i]] = GLYPH_UNLOADED;
+    }
+    shelf.glyphs.clear();
+    shelf.x = 0;
+
+    // Draw any queued text that still samples the old glyphs, and forget cached
+    // layouts that reference them. Forms check the generation to discard cached geometry.
+    if (font->_batch->isStarted())
+    {
+        font->_batch->finish();
+        font->lazyStart();
+    }
+    font->trimTextCache(0);
+    ++__glyphAtlasGeneration;
+
+    // Clear the shelf so no stale pixels bleed into the padding between new glyphs.
+    const unsigned int height = std::min(rowSize + GLYPH_PADDING, font->_texture->getHeight() - shelf.y);
+    memset(buffer, 0, textureWidth * height);
+    font->_texture->setData(0, shelf.y, textureWidth, height, buffer);
+
+    return lru;
+}
+
+int Font::GlyphAtlas::findGlyph(unsigned int code)
+{
+    std::map<unsigned int, int>::const_iterator itr = extraIndices.find(code);
+    if (itr != extraIndices.end())
+        return itr->second;
+
+    // Only add glyphs for characters the font has, so unsupported text doesn't grow the table.
+    if (FT_Get_Char_Index(face, code) == 0)
+        return -1;
+
+    Glyph glyph;
+    glyph.code = code;
+    glyph.width = 0;
+    memset(glyph.uvs, 0, sizeof(glyph.uvs));
+    extraGlyphs.push_back(glyph);
+    glyphShelves.push_back(GLYPH_UNLOADED);
+
+    int index = DYNAMIC_GLYPH_COUNT + (int)extraGlyphs.size() - 1;
+    extraIndices[code] = index;
+    return index;
+}
+
+Font::Glyph& Font::GlyphAtlas::getGlyph(Font* font, int index)
+{
+    GP_ASSERT(index >= 0 && index < (int)glyphShelves.size());
+    if (index < DYNAMIC_GLYPH_COUNT)
+        return font->_glyphs[index];
+    return extraGlyphs[index - DYNAMIC_GLYPH_COUNT];
+}
+
+#endif
+
+/**
+ * Decodes the UTF-8 character that contains the byte at the given index.
+ *
+ * Bytes that are not part of a valid UTF-8 sequence are decoded as the Latin-1
+ * character with the same value, so text in single byte encodings still draws.
+ *
+ * @param text The text.
+ * @param length The length of the text in bytes.
+ * @param index The index of the byte. Set to the first byte of the character when
+ *      iterating backwards, or its last byte when iterating forwards.
+ * @param iteration The direction of iteration (1 or -1).
+ * @param byteCount Set to the number of bytes in the character, if not NULL.
+ *
+ * @return The code point of the character.
+ */
+static unsigned int decodeCharacter(const char* text, int length, int* index, int iteration, int* byteCount = NULL)
+{
+    const unsigned char* bytes = (const unsigned char*)text;
+
+    // When iterating backwards, find the first byte of a sequence that covers the index.
+    int start = *index;
+    if (iteration < 0)
+    {
+        for (int i = *index; i > *index - 4 && i >= 0 && (bytes[*index] & 0xC0) == 0x80; --i)
+        {
+            if ((bytes[i] & 0xC0) != 0x80)
+            {
+                int last = i;
+                decodeCharacter(text, length, &last, 1);
+                if (last >= *index)
+                    start = i;
+                break;
+            }
+        }
+    }
+
+    unsigned int code = bytes[start];
+    int count = 0;
+    unsigned int minimum = 0;
+    if (code >= 0xC2 && code <= 0xDF)
+    {
+        count = 1;
+        code &= 0x1F;
+        minimum = 0x80;
+    }
+    else if (code >= 0xE0 && code <= 0xEF)
+    {
+        count = 2;
+        code &= 0x0F;
+        minimum = 0x800;
+    }
+    else if (code >= 0xF0 && code <= 0xF4)
+    {
+        count = 3;
+        code &= 0x07;
+        minimum = 0x10000;
+    }
+
+    if (count > 0 && start + count < length)
+    {
+        for (int i = 1; i <= count; ++i)
+        {
+            if ((bytes[start + i] & 0xC0) != 0x80)
+            {
+                count = 0;
+                break;
+            }
+            code = (code << 6) | (bytes[start + i] & 0x3F);
+        }
+
+        // Reject overlong forms, surrogates and code points beyond Unicode.
+        if (count > 0 && (code < minimum || (code >= 0xD800 && code <= 0xDFFF) || code > 0x10FFFF))
+            count = 0;
+    }
+    else
+    {
+        count = 0;
+    }
+
+    if (count == 0)
+        code = bytes[start];
+
+    *index = iteration < 0 ? start : start + count;
+    if (byteCount)
+        *byteCount = count + 1;
+    return code;
+}
+
 Font::Font() :
-    _format(BITMAP), _style(PLAIN), _size(0), _spacing(0.125f), _glyphs(NULL), _glyphCount(0), _texture(NULL), _batch(NULL), _cutoffParam(NULL)
+    _format(BITMAP), _style(PLAIN), _size(0), _spacing(0.125f), _glyphs(NULL), _glyphCount(0), _texture(NULL), _batch(NULL), _cutoffParam(NULL),
+    _atlas(NULL)
 {
 }
 
 Font::~Font()
 {
     // Remove this Font from the font cache.
-    std::vector<Font*>::iterator itr = std::find(__fontCache.begin(), __fontCache.end(), this);
-    if (itr != __fontCache.end())
-    {
-        __fontCache.erase(itr);
-    }
+    if (__fontCache)
+        __fontCache->remove(this);
+
+    trimTextCache(0);
 
     SAFE_DELETE(_batch);
     SAFE_DELETE_ARRAY(_glyphs);
     SAFE_RELEASE(_texture);
+#ifdef GP_USE_FREETYPE
+    SAFE_DELETE(_atlas);
+#endif
 
     // Free child fonts
     for (size_t i = 0, count = _sizes.size(); i < count; ++i)
@@ -45,13 +358,14 @@ Font* Font::create(const char* path, const char* id)
     GP_ASSERT(path);
 
     // Search the font cache for a font with the given path and ID.
-    for (size_t i = 0, count = __fontCache.size(); i < count; ++i)
+    std::string key = FileSystem::resolvePath(path);
+    Font* f;
+    for (unsigned int i = 0; (f = static_cast<Font*>(getFontCache()->find(key.c_str(), i))) != NULL; ++i)
     {
-        Font* f = __fontCache[i];
-        GP_ASSERT(f);
-        if (f->_path == path && (id == NULL || f->_id == id))
+        if (id == NULL || f->_id == id)
         {
             // Found a match.
+            getFontCache()->use(f);
             f->addRef();
             return f;
         }
@@ -87,8 +401,10 @@ Font* Font::create(const char* path, const char* id)
 
     if (font)
     {
-        // Add this font to the cache.
-        __fontCache.push_back(font);
+        // Add this font to the cache. Font textures hold 8-bit alpha.
+        GP_ASSERT(font->_texture);
+        size_t textureSize = font->_texture->getWidth() * font->_texture->getHeight();
+        getFontCache()->add(key.c_str(), font, textureSize, font->_glyphCount * sizeof(Glyph));
     }
 
     SAFE_RELEASE(bundle);
@@ -96,6 +412,133 @@ Font* Font::create(const char* path, const char* id)
     return font;
 }
 
+Font* Font::createFromTrueType(const char* path, unsigned int size, unsigned int atlasSize)
+{
+    GP_ASSERT(path);
+
+#ifdef GP_USE_FREETYPE
+    // Search the font cache for a dynamic font with the given path and size.
+    std::string key = FileSystem::resolvePath(path);
+    Font* f;
+    for (unsigned int i = 0; (f = static_cast<Font*>(getFontCache()->find(key.c_str(), i))) != NULL; ++i)
+    {
+        if (f->_atlas && f->_size == size)
+        {
+            // Found a match.
+            getFontCache()->use(f);
+            f->addRef();
+            return f;
+        }
+    }
+
+    if (size == 0 || atlasSize < size + GLYPH_PADDING)
+    {
+        GP_WARN("Invalid size %u (atlas size %u) for font '%s'.", size, atlasSize, path);
+        return NULL;
+    }
+
+    int length = 0;
+    char* data = FileSystem::readAll(path, &length);
+    if (data == NULL)
+    {
+        GP_WARN("Failed to read font file '%s'.", path);
+        return NULL;
+    }
+
+    GlyphAtlas* atlas = new GlyphAtlas();
+    atlas->fontData = data;
+    if (FT_Init_FreeType(&atlas->library) != 0 ||
+        FT_New_Memory_Face(atlas->library, (const FT_Byte*)atlas->fontData, length, 0, &atlas->face) != 0)
+    {
+        GP_WARN("Failed to load TrueType font '%s'.", path);
+        SAFE_DELETE(atlas);
+        return NULL;
+    }
+
+    // Use the largest character size whose line height fits within the requested pixel size.
+    FT_Face face = atlas->face;
+    for (unsigned int charSize = size; charSize > 0; --charSize)
+    {
+        if (FT_Set_Char_Size(face, 0, charSize * 64, 0, 0) != 0)
+        {
+            GP_WARN("Failed to set size %u for font '%s'.", charSize, path);
+            SAFE_DELETE(atlas);
+            return NULL;
+        }
+        if (((face->size->metrics.ascender - face->size->metrics.descender) >> 6) <= (FT_Pos)size)
+            break;
+    }
+    atlas->baseline = (int)(face->size->metrics.ascender >> 6);
+    atlas->rowSize = size;
+
+    // Split the atlas into shelves one line high.
+    const unsigned int shelfHeight = size + GLYPH_PADDING;
+    atlas->shelves.resize(atlasSize / shelfHeight);
+    for (size_t i = 0, count = atlas->shelves.size(); i < count; ++i)
+    {
+        GlyphAtlas::Shelf& shelf = atlas->shelves[i];
+        shelf.y = i * shelfHeight;
+        shelf.x = 0;
+        shelf.lastUsed = 0;
+    }
+    atlas->glyphShelves.assign(DYNAMIC_GLYPH_COUNT, GLYPH_UNLOADED);
+    atlas->buffer = new unsigned char[atlasSize * shelfHeight];
+
+    // Create an empty atlas texture; glyphs are rasterized into it on first use.
+    unsigned char* pixels = new unsigned char[atlasSize * atlasSize];
+    memset(pixels, 0, atlasSize * atlasSize);
+    Texture* texture = Texture::create(Texture::ALPHA, atlasSize, atlasSize, pixels, false);
+    SAFE_DELETE_ARRAY(pixels);
+
+    Glyph glyphs[DYNAMIC_GLYPH_COUNT];
+    for (unsigned int i = 0; i < DYNAMIC_GLYPH_COUNT; ++i)
+    {
+        glyphs[i].code = i + 32;
+        glyphs[i].width = 0;
+        memset(glyphs[i].uvs, 0, sizeof(glyphs[i].uvs));
+    }
+
+    Style style = PLAIN;
+    if ((face->style_flags & FT_STYLE_FLAG_BOLD) && (face->style_flags & FT_STYLE_FLAG_ITALIC))
+        style = BOLD_ITALIC;
+    else if (face->style_flags & FT_STYLE_FLAG_BOLD)
+        style = BOLD;
+    else if (face->style_flags & FT_STYLE_FLAG_ITALIC)
+        style = ITALIC;
+
+    Font* font = NULL;
+    if (texture)
+    {
+        font = create(face->family_name ? face->family_name : "", style, size, glyphs, DYNAMIC_GLYPH_COUNT, texture, BITMAP);
+
+        // Release the texture since the Font now owns it.
+        SAFE_RELEASE(texture);
+    }
+
+    if (font == NULL)
+    {
+        GP_WARN("Failed to create font '%s'.", path);
+        SAFE_DELETE(atlas);
+        return NULL;
+    }
+
+    font->_path = path;
+    font->_atlas = atlas;
+
+    // The atlas is updated at runtime and has no mipmaps.
+    font->_batch->getSampler()->setFilterMode(Texture::LINEAR, Texture::LINEAR);
+
+    // Add this font to the cache, counting its atlas texture, glyph staging buffer and font data.
+    size_t cpuMemoryUsage = atlasSize * shelfHeight + font->_glyphCount * sizeof(Glyph) + length;
+    getFontCache()->add(key.c_str(), font, atlasSize * atlasSize, cpuMemoryUsage);
+
+    return font;
+#else
+    GP_WARN("Failed to create font '%s'; runtime TrueType fonts require building with GP_USE_FREETYPE.", path);
+    return NULL;
+#endif
+}
+
 Font* Font::create(const char* family, Style style, unsigned int size, Glyph* glyphs, int glyphCount, Texture* texture, Font::Format format)
 {
     GP_ASSERT(family);
@@ -177,6 +620,13 @@ Font::Format Font::getFormat()
 
 bool Font::isCharacterSupported(int character) const
 {
+#ifdef GP_USE_FREETYPE
+    if (_atlas)
+    {
+        return character >= 32 && FT_Get_Char_Index(_atlas->face, character) != 0;
+    }
+#endif
+
     // TODO: Update this once we support unicode fonts
     int glyphIndex = character - 32; // HACK for ASCII
     return (glyphIndex >= 0 && glyphIndex < (int)_glyphCount);
@@ -253,6 +703,7 @@ Font::Text* Font::createText(const char* text, const Rectangle& area, const Vect
     Text* batch = new Text(text);
     batch->_font = this;
     batch->_font->addRef();
+    batch->_color = color;
 
     GP_ASSERT(batch->_vertices);
     GP_ASSERT(batch->_indices);
@@ -325,7 +776,7 @@ Font::Text* Font::createText(const char* text, const Rectangle& area, const Vect
         }
 
         bool draw = true;
-        if (yPos < static_cast<int>(area.y))
+        if (yPos < static_cast<int>(area.y - size))
         {
             // Skip drawing until line break or wrap.
             draw = false;
@@ -338,12 +789,10 @@ Font::Text* Font::createText(const char* text, const Rectangle& area, const Vect
 
         for (int i = startIndex; i < (int)tokenLength && i >= 0; i += iteration)
         {
-            char c = token[i];
-            int glyphIndex = c - 32; // HACK for ASCII
-        
-            if (glyphIndex >= 0 && glyphIndex < (int)_glyphCount)
+            Glyph* glyph = getGlyph(decodeCharacter(token, tokenLength, &i, iteration));
+            if (glyph)
             {
-                Glyph& g = _glyphs[glyphIndex];
+                Glyph& g = *glyph;
 
                 if (xPos + (int)(g.width*scale) > area.x + area.width)
                 {
@@ -354,16 +803,17 @@ Font::Text* Font::createText(const char* text, const Rectangle& area, const Vect
                 else if (xPos >= area.x)
                 {
                     // Draw this character.
-                    if (draw)
+                    float x = xPos;
+                    float y = yPos;
+                    float width = g.width * scale;
+                    float height = size;
+                    float u1 = g.uvs[0];
+                    float v1 = g.uvs[1];
+                    float u2 = g.uvs[2];
+                    float v2 = g.uvs[3];
+                    if (draw && (clip == NULL || _batch->clipSprite(*clip, x, y, width, height, u1, v1, u2, v2)))
                     {
-                        if (clip)
-                        {
-                            _batch->addSprite(xPos, yPos, g.width * scale, size, g.uvs[0], g.uvs[1], g.uvs[2], g.uvs[3], color, *clip, &batch->_vertices[batch->_vertexCount]);
-                        }
-                        else
-                        {
-                            _batch->addSprite(xPos, yPos, g.width * scale, size, g.uvs[0], g.uvs[1], g.uvs[2], g.uvs[3], color, &batch->_vertices[batch->_vertexCount]);
-                        }
+                        _batch->addSprite(x, y, width, height, u1, v1, u2, v2, color, &batch->_vertices[batch->_vertexCount]);
 
                         if (batch->_vertexCount == 0)
                         {
@@ -486,6 +936,35 @@ Font* Font::findClosestSize(int size)
     return closest;
 }
 
+Font::Glyph* Font::getGlyph(unsigned int code)
+{
+#ifdef GP_USE_FREETYPE
+    if (_atlas)
+    {
+        // Dynamic fonts cover all code points the font has, and rasterize glyphs on first use.
+        if (code < 32)
+            return NULL;
+        int index = code < 32 + DYNAMIC_GLYPH_COUNT ? (int)code - 32 : _atlas->findGlyph(code);
+        if (index < 0)
+            return NULL;
+
+        int shelf = _atlas->glyphShelves[index];
+        if (shelf == GLYPH_UNLOADED)
+            shelf = _atlas->load(this, index);
+        if (shelf >= 0)
+            _atlas->shelves[shelf].lastUsed = ++_atlas->clock;
+
+        return &_atlas->getGlyph(this, index);
+    }
+#endif
+
+    int index = (int)code - 32; // HACK for ASCII
+    if (index >= 0 && index < (int)_glyphCount)
+        return &_glyphs[index];
+
+    return NULL;
+}
+
 void Font::drawText(Text* text)
 {
     GP_ASSERT(text);
@@ -502,7 +981,16 @@ void Font::drawText(Text* text)
     GP_ASSERT(text->_vertices);
     GP_ASSERT(text->_indices);
 
+    if (text->_vertexCount == 0)
+        return;
+
     lazyStart();
+    if (getFormat() == DISTANCE_FIELD)
+    {
+        if (_cutoffParam == NULL)
+            _cutoffParam = _batch->getMaterial()->getParameter("u_cutoff");
+        _cutoffParam->setVector2(Vector2(1.0, 1.0));
+    }
     _batch->draw(text->_vertices, text->_vertexCount, text->_indices, text->_indexCount);
 }
 
@@ -595,15 +1083,9 @@ void Font::drawText(const char* text, int x, int y, const Vector4& color, unsign
         GP_ASSERT(_batch);
         for (size_t i = startIndex; i < length; i += (size_t)iteration)
         {
-            char c = 0;
-            if (rightToLeft)
-            {
-                c = cursor[i];
-            }
-            else
-            {
-                c = text[i];
-            }
+            int index = (int)i;
+            unsigned int c = decodeCharacter(rightToLeft ? cursor : text, (int)length, &index, iteration);
+            i = (size_t)index;
 
             // Draw this character.
             switch (c)
@@ -620,10 +1102,10 @@ void Font::drawText(const char* text, int x, int y, const Vector4& color, unsign
                 xPos += (size >> 1)*4;
                 break;
             default:
-                int index = c - 32; // HACK for ASCII
-                if (index >= 0 && index < (int)_glyphCount)
+                Glyph* glyph = getGlyph(c);
+                if (glyph)
                 {
-                    Glyph& g = _glyphs[index];
+                    Glyph& g = *glyph;
 
                     if (getFormat() == DISTANCE_FIELD )
                     {
@@ -676,6 +1158,14 @@ void Font::drawText(const char* text, const Rectangle& area, const Vector4& colo
         }
     }
 
+    // Reuse the vertices of a previously laid out string when possible.
+    Text* cached = getCachedText(text, area, color, size, justify, wrap, rightToLeft, clip);
+    if (cached)
+    {
+        drawText(cached);
+        return;
+    }
+
     lazyStart();
 
     float scale = (float)size / _size;
@@ -771,12 +1261,10 @@ void Font::drawText(const char* text, const Rectangle& area, const Vector4& colo
         GP_ASSERT(_batch);
         for (int i = startIndex; i < (int)tokenLength && i >= 0; i += iteration)
         {
-            char c = token[i];
-            int glyphIndex = c - 32; // HACK for ASCII
-        
-            if (glyphIndex >= 0 && glyphIndex < (int)_glyphCount)
+            Glyph* glyph = getGlyph(decodeCharacter(token, tokenLength, &i, iteration));
+            if (glyph)
             {
-                Glyph& g = _glyphs[glyphIndex];
+                Glyph& g = *glyph;
 
                 if (xPos + (int)(g.width*scale) > area.x + area.width)
                 {
@@ -1470,6 +1958,11 @@ float Font::getCharacterSpacing() const
 
 void Font::setCharacterSpacing(float spacing)
 {
+    if (_spacing != spacing)
+    {
+        // Cached layouts were computed with the old spacing.
+        trimTextCache(0);
+    }
     _spacing = spacing;
 }
 
@@ -1620,12 +2113,11 @@ int Font::getIndexOrLocation(const char* text, const Rectangle& area, unsigned i
         GP_ASSERT(_glyphs);
         for (int i = startIndex; i < (int)tokenLength && i >= 0; i += iteration)
         {
-            char c = token[i];
-            int glyphIndex = c - 32; // HACK for ASCII
-        
-            if (glyphIndex >= 0 && glyphIndex < (int)_glyphCount)
+            int byteCount;
+            Glyph* glyph = getGlyph(decodeCharacter(token, tokenLength, &i, iteration, &byteCount));
+            if (glyph)
             {
-                Glyph& g = _glyphs[glyphIndex];
+                Glyph& g = *glyph;
 
                 if (xPos + (int)(g.width*scale) > area.x + area.width)
                 {
@@ -1646,7 +2138,7 @@ int Font::getIndexOrLocation(const char* text, const Rectangle& area, unsigned i
                 }
 
                 xPos += floor(g.width*scale + spacing);
-                charIndex++;
+                charIndex += byteCount;
             }
         }
 
@@ -1742,9 +2234,9 @@ unsigned int Font::getTokenWidth(const char* token, unsigned int length, unsigne
 
     // Calculate width of word or line.
     unsigned int tokenWidth = 0;
-    for (unsigned int i = 0; i < length; ++i)
+    for (int i = 0; i < (int)length; ++i)
     {
-        char c = token[i];
+        unsigned int c = decodeCharacter(token, (int)length, &i, 1);
         switch (c)
         {
         case ' ':
@@ -1754,10 +2246,10 @@ unsigned int Font::getTokenWidth(const char* token, unsigned int length, unsigne
             tokenWidth += (size >> 1)*4;
             break;
         default:
-            int glyphIndex = c - 32;
-            if (glyphIndex >= 0 && glyphIndex < (int)_glyphCount)
+            Glyph* glyph = getGlyph(c);
+            if (glyph)
             {
-                Glyph& g = _glyphs[glyphIndex];
+                Glyph& g = *glyph;
                 tokenWidth += floor(g.width * scale + spacing);
             }
             break;
@@ -1981,6 +2473,174 @@ Font::Justify Font::getJustify(const char* justify)
     return Font::ALIGN_TOP_LEFT;
 }
 
+Font::Text* Font::getCachedText(const char* text, const Rectangle& area, const Vector4& color, unsigned int size,
+                               Justify justify, bool wrap, bool rightToLeft, const Rectangle* clip)
+{
+    GP_ASSERT(text);
+
+    const size_t length = strlen(text);
+    if (__textCacheSize == 0 || length == 0 || length > TEXT_CACHE_MAX_LENGTH)
+        return NULL;
+
+    TextLayoutKey key;
+    key.text = text;
+    key.size = size;
+    key.area = area;
+    key.justify = justify;
+    key.wrap = wrap;
+    key.rightToLeft = rightToLeft;
+    key.clipped = (clip != NULL);
+    if (clip)
+        key.clip = *clip;
+
+    TextLayoutMap::iterator itr = _textLayoutMap.find(key);
+    if (itr != _textLayoutMap.end())
+    {
+        ++__textCacheHitCount;
+
+        // Move the layout to the front of the list as the most recently used.
+        _textLayouts.splice(_textLayouts.begin(), _textLayouts, itr->second);
+
+        Text* t = itr->second->second;
+        GP_ASSERT(t);
+        if (!(t->_color == color))
+        {
+            // Same layout drawn in a different color, so only the vertex colors need updating.
+            for (unsigned int i = 0; i < t->_vertexCount; ++i)
+            {
+                SpriteBatch::SpriteVertex& v = t->_vertices[i];
+                v.r = color.x;
+                v.g = color.y;
+                v.b = color.z;
+                v.a = color.w;
+            }
+            t->_color = color;
+        }
+        return t;
+    }
+
+    ++__textCacheMissCount;
+
+    // Recycling a glyph atlas row part way through the layout leaves the glyphs laid out
+    // before it pointing at the cleared row, so lay the text out again with its glyphs loaded.
+    unsigned int generation = __glyphAtlasGeneration;
+    Text* t = createText(text, area, color, size, justify, wrap, rightToLeft, clip);
+    GP_ASSERT(t && t->_font == this);
+    if (generation != __glyphAtlasGeneration)
+    {
+        SAFE_DELETE(t);
+        generation = __glyphAtlasGeneration;
+        t = createText(text, area, color, size, justify, wrap, rightToLeft, clip);
+        GP_ASSERT(t && t->_font == this);
+        if (generation != __glyphAtlasGeneration)
+        {
+            // The text needs more glyphs than the atlas holds at once, so it can't be cached.
+            // Drawing it directly flushes the batch whenever a row is recycled.
+            SAFE_DELETE(t);
+            return NULL;
+        }
+    }
+
+    // The cache is owned by this font, so cached layouts must not keep it alive.
+    t->_font->release();
+
+    _textLayouts.push_front(TextLayout(key, t));
+    _textLayoutMap[key] = _textLayouts.begin();
+    trimTextCache(__textCacheSize);
+
+    return t;
+}
+
+void Font::trimTextCache(unsigned int size)
+{
+    while (_textLayouts.size() > size)
+    {
+        TextLayout& layout = _textLayouts.back();
+        _textLayoutMap.erase(layout.first);
+
+        // Cached layouts don't hold a reference to their font.
+        layout.second->_font = NULL;
+        SAFE_DELETE(layout.second);
+        _textLayouts.pop_back();
+    }
+}
+
+void Font::setTextCacheSize(unsigned int size)
+{
+    __textCacheSize = size;
+
+    std::vector<Ref*> fonts;
+    if (__fontCache)
+        __fontCache->getResources(fonts);
+    for (size_t i = 0, count = fonts.size(); i < count; ++i)
+    {
+        Font* f = static_cast<Font*>(fonts[i]);
+        GP_ASSERT(f);
+        f->trimTextCache(size);
+        for (size_t j = 0, sizeCount = f->_sizes.size(); j < sizeCount; ++j)
+        {
+            f->_sizes[j]->trimTextCache(size);
+        }
+    }
+}
+
+unsigned int Font::getTextCacheSize()
+{
+    return __textCacheSize;
+}
+
+unsigned int Font::getTextCacheHitCount()
+{
+    return __textCacheHitCount;
+}
+
+unsigned int Font::getTextCacheMissCount()
+{
+    return __textCacheMissCount;
+}
+
+unsigned int Font::getGlyphAtlasGeneration()
+{
+    return __glyphAtlasGeneration;
+}
+
+static int compareRectangles(const Rectangle& r1, const Rectangle& r2)
+{
+    if (r1.x != r2.x)
+        return r1.x < r2.x ? -1 : 1;
+    if (r1.y != r2.y)
+        return r1.y < r2.y ? -1 : 1;
+    if (r1.width != r2.width)
+        return r1.width < r2.width ? -1 : 1;
+    if (r1.height != r2.height)
+        return r1.height < r2.height ? -1 : 1;
+    return 0;
+}
+
+bool Font::TextLayoutKey::operator<(const TextLayoutKey& key) const
+{
+    if (size != key.size)
+        return size < key.size;
+    if (justify != key.justify)
+        return justify < key.justify;
+    if (wrap != key.wrap)
+        return !wrap;
+    if (rightToLeft != key.rightToLeft)
+        return !rightToLeft;
+    if (clipped != key.clipped)
+        return !clipped;
+    int c = compareRectangles(area, key.area);
+    if (c != 0)
+        return c < 0;
+    if (clipped)
+    {
+        c = compareRectangles(clip, key.clip);
+        if (c != 0)
+            return c < 0;
+    }
+    return text < key.text;
+}
+
 Font::Text::Text(const char* text) : _text(text ? text : ""), _vertexCount(0), _vertices(NULL), _indexCount(0), _indices(NULL), _font(NULL)
 {
     const size_t length = strlen(text);
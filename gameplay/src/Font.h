@@ -13,6 +13,7 @@ class Font : public Ref
 {
     friend class Bundle;
     friend class TextBox;
+    friend class Form;
 
 public:
 
@@ -122,6 +123,31 @@ public:
      */
     static Font* create(const char* path, const char* id = NULL);
 
+    /**
+     * Creates a font that rasterizes glyphs from a TrueType font file on demand.
+     *
+     * Unlike fonts loaded from a bundle, no glyphs are rendered up front. Each character is
+     * rasterized into a dynamic glyph atlas the first time it is measured or drawn, and the
+     * least recently used rows of the atlas are recycled once it fills up. Text objects
+     * created from such a font may therefore become stale if the atlas has to recycle a row.
+     * Text is decoded as UTF-8, so any character the font has can be drawn; bytes that are
+     * not valid UTF-8 are drawn as Latin-1 characters.
+     *
+     * Rasterizing fonts at runtime requires building with GP_USE_FREETYPE defined. Otherwise
+     * this method logs a warning and returns NULL.
+     *
+     * If a font for the given path and size has already been created, the existing font will
+     * be returned with its reference count increased.
+     *
+     * @param path The path to a TrueType font file.
+     * @param size The font size (line height in pixels).
+     * @param atlasSize The width and height of the glyph atlas texture (in pixels).
+     *
+     * @return The specified Font or NULL if there was an error.
+     * @script{create}
+     */
+    static Font* createFromTrueType(const char* path, unsigned int size, unsigned int atlasSize = 256);
+
     /**
      * Gets the font size (max height of glyphs) in pixels, at the specified index.
      *
@@ -309,8 +335,66 @@ public:
      */
     static Justify getJustify(const char* justify);
 
+    /**
+     * Sets the maximum number of text layouts each font keeps cached.
+     *
+     * Strings drawn within an area are laid out once and their vertices are kept in
+     * a least-recently-used cache, so labels that are redrawn every frame with the
+     * same text, size, area and justification skip measurement and glyph placement.
+     * Setting the size to zero disables the cache and clears all cached layouts.
+     *
+     * The default cache size is 64 layouts per font.
+     *
+     * @param size The maximum number of cached layouts per font.
+     */
+    static void setTextCacheSize(unsigned int size);
+
+    /**
+     * Gets the maximum number of text layouts each font keeps cached.
+     *
+     * @return The maximum number of cached layouts per font.
+     */
+    static unsigned int getTextCacheSize();
+
+    /**
+     * Gets the number of text draws that were served from a cached layout.
+     *
+     * @return The number of text layout cache hits since startup.
+     */
+    static unsigned int getTextCacheHitCount();
+
+    /**
+     * Gets the number of text draws that had to compute a new layout.
+     *
+     * @return The number of text layout cache misses since startup.
+     */
+    static unsigned int getTextCacheMissCount();
+
 private:
 
+    /**
+     * Identifies a cached text layout.
+     */
+    struct TextLayoutKey
+    {
+        std::string text;
+        unsigned int size;
+        Rectangle area;
+        Justify justify;
+        bool wrap;
+        bool rightToLeft;
+        bool clipped;
+        Rectangle clip;
+
+        bool operator<(const TextLayoutKey& key) const;
+    };
+
+    typedef std::pair<TextLayoutKey, Text*> TextLayout;
+    typedef std::list<TextLayout> TextLayoutList;
+    typedef std::map<TextLayoutKey, TextLayoutList::iterator> TextLayoutMap;
+
+    class GlyphAtlas;
+
     /**
      * Defines a font glyph within the texture map for a font.
      */
@@ -390,8 +474,21 @@ private:
 
     Font* findClosestSize(int size);
 
+    Glyph* getGlyph(unsigned int code);
+
+    /**
+     * Returns a count of the glyph atlas rows recycled by all fonts, which changes whenever
+     * geometry generated from a dynamic font may reference stale glyphs.
+     */
+    static unsigned int getGlyphAtlasGeneration();
+
     void lazyStart();
 
+    Text* getCachedText(const char* text, const Rectangle& area, const Vector4& color, unsigned int size,
+                        Justify justify, bool wrap, bool rightToLeft, const Rectangle* clip);
+
+    void trimTextCache(unsigned int size);
+
     Format _format;
     std::string _path;
     std::string _id;
@@ -406,6 +503,9 @@ private:
     SpriteBatch* _batch;
     Rectangle _viewport;
     MaterialParameter* _cutoffParam;
+    GlyphAtlas* _atlas;
+    TextLayoutList _textLayouts;
+    TextLayoutMap _textLayoutMap;
 };
 
 }
@@ -42,8 +42,9 @@ struct FormInit
 };
 static FormInit __init;
 
-Form::Form() : _node(NULL), _batched(true)
+Form::Form() : _node(NULL), _batched(true), _caching(false), _cacheValid(false), _cacheCapturable(true), _cacheGlyphGeneration(0)
 {
+    _form = this;
 }
 
 Form::~Form()
@@ -102,6 +103,7 @@ Form* Form::create(const char* url)
     }
 
     form->_batched = formProperties->getBool("batchingEnabled", true);
+    form->_caching = formProperties->getBool("cachingEnabled", false);
 
     // Initialize the form and all of its child controls
     form->initialize("Form", style, formProperties);
@@ -221,6 +223,11 @@ void Form::startBatch(SpriteBatch* batch)
         if (_batched)
             _batches.push_back(batch);
     }
+    else if (_caching && _batched && std::find(_batches.begin(), _batches.end(), batch) == _batches.end())
+    {
+        // Sprites drawn into a batch that was started elsewhere can't be cached for this form.
+        _cacheCapturable = false;
+    }
 }
 
 void Form::finishBatch(SpriteBatch* batch)
@@ -264,8 +271,47 @@ unsigned int Form::draw()
         Matrix::createOrthographicOffCenter(0, viewport.width, viewport.height, 0, 0, 1, &_projectionMatrix);
     }
 
+    // Glyphs of dynamic fonts move when their atlas recycles a row, so cached text may be stale.
+    if (_cacheValid && _cacheGlyphGeneration != Font::getGlyphAtlasGeneration())
+        invalidate();
+
     // Draw the form
-    unsigned int drawCalls = Container::draw(this, _absoluteClipBounds);
+    unsigned int drawCalls = 0;
+    bool drawnFromCache = _caching && _batched && _cacheValid;
+    if (drawnFromCache)
+    {
+        // Nothing has changed since the geometry was cached, so draw it again as is.
+        for (size_t i = 0, count = _cachedBatches.size(); i < count; ++i)
+        {
+            CachedBatch& cached = _cachedBatches[i];
+            startBatch(cached.batch);
+            if (!cached.vertices.empty())
+            {
+                cached.batch->draw(&cached.vertices[0], cached.vertices.size(), &cached.indices[0], cached.indices.size());
+                ++drawCalls;
+            }
+        }
+    }
+    else
+    {
+        _cacheCapturable = true;
+        _cacheGlyphGeneration = Font::getGlyphAtlasGeneration();
+        drawCalls = Container::draw(this, _absoluteClipBounds);
+
+        // Text drawn before an atlas row was recycled during this draw may be stale already.
+        if (_caching && _batched && _cacheCapturable && _cacheGlyphGeneration == Font::getGlyphAtlasGeneration())
+        {
+            // Keep the sprites drawn into each batch for following frames.
+            _cachedBatches.resize(_batches.size());
+            for (size_t i = 0, count = _batches.size(); i < count; ++i)
+            {
+                CachedBatch& cached = _cachedBatches[i];
+                cached.batch = _batches[i];
+                cached.batch->getSprites(&cached.vertices, &cached.indices);
+            }
+            _cacheValid = true;
+        }
+    }
 
     // Flush all batches that were queued during drawing and then empty the batch list
     if (_batched)
@@ -274,7 +320,10 @@ unsigned int Form::draw()
         for (unsigned int i = 0; i < batchCount; ++i)
             _batches[i]->finish();
         _batches.clear();
-        drawCalls = batchCount;
+
+        // Cached batches were counted as they were drawn, since empty ones are never submitted.
+        if (!drawnFromCache)
+            drawCalls = batchCount;
     }
 
     return drawCalls;
@@ -296,6 +345,24 @@ void Form::setBatchingEnabled(bool enabled)
     _batched = enabled;
 }
 
+bool Form::isCachingEnabled() const
+{
+    return _caching;
+}
+
+void Form::setCachingEnabled(bool enabled)
+{
+    _caching = enabled;
+    invalidate();
+}
+
+void Form::invalidate()
+{
+    _cacheValid = false;
+    if (!_caching)
+        _cachedBatches.clear();
+}
+
 void Form::updateInternal(float elapsedTime)
 {
     pollGamepads();
@@ -386,8 +453,9 @@ Control* Form::findInputControl(Control* control, int x, int y, bool focus, unsi
     }
 
     // If the control has children, search for an input control inside it that also
-    // supports the above conditions.
-    if (control->isContainer())
+    // supports the above conditions. Children are clipped to their container, so there
+    // is no need to search them when the coordinates are outside of it.
+    if (control->isContainer() && control->_absoluteClipBounds.contains(x, y))
     {
         Container* container = static_cast<Container*>(control);
         for (unsigned int i = 0, childCount = container->getControlCount(); i < childCount; ++i)
@@ -585,11 +653,12 @@ void Form::verifyRemovedControlState(Control* control)
 //   evt - Mouse::MouseEvent or Touch::TouchEvent
 //   x, y - Point of event
 //   param - wheelData for mouse events, contactIndex for touch events
-bool Form::pointerEventInternal(bool mouse, int evt, int x, int y, int param)
+// Returns the control that consumed the event, or NULL if it was not consumed.
+Control* Form::pointerEventInternal(bool mouse, int evt, int x, int y, int param)
 {
     // Do not process mouse input when mouse is captured
     if (mouse && Game::getInstance()->isMouseCaptured())
-        return false;
+        return NULL;
 
     // Is this a press event (TOUCH_PRESS has the same value as MOUSE_PRESS_LEFT_BUTTON)
     bool pressEvent = evt == Touch::TOUCH_PRESS || (mouse && (evt == Mouse::MOUSE_PRESS_MIDDLE_BUTTON || evt == Mouse::MOUSE_PRESS_RIGHT_BUTTON));
@@ -645,29 +714,29 @@ bool Form::pointerEventInternal(bool mouse, int evt, int x, int y, int param)
             if (mouse)
             {
                 if (ctrl->mouseEvent((Mouse::MouseEvent)evt, localX, localY, param))
-                    return true;
+                    return ctrl;
 
                 // Forward to touch event hanlder if unhandled by mouse handler
                 switch (evt)
                 {
                 case Mouse::MOUSE_PRESS_LEFT_BUTTON:
                     if (ctrl->touchEvent(Touch::TOUCH_PRESS, localX, localY, 0))
-                        return true;
+                        return ctrl;
                     break;
                 case Mouse::MOUSE_RELEASE_LEFT_BUTTON:
                     if (ctrl->touchEvent(Touch::TOUCH_RELEASE, localX, localY, 0))
-                        return true;
+                        return ctrl;
                     break;
                 case Mouse::MOUSE_MOVE:
                     if (ctrl->touchEvent(Touch::TOUCH_MOVE, localX, localY, 0))
-                        return true;
+                        return ctrl;
                     break;
                 }
             }
             else
             {
                 if (ctrl->touchEvent((Touch::TouchEvent)evt, localX, localY, contactIndex))
-                    return true;
+                    return ctrl;
             }
 
             // Handle container scrolling
@@ -682,12 +751,12 @@ bool Form::pointerEventInternal(bool mouse, int evt, int x, int y, int param)
                         if (mouse)
                         {
                             if (container->mouseEventScroll((Mouse::MouseEvent)evt, formX - tmp->_absoluteBounds.x, formY - tmp->_absoluteBounds.y, param))
-                                return true;
+                                return ctrl;
                         }
                         else
                         {
                             if (container->touchEventScroll((Touch::TouchEvent)evt, formX - tmp->_absoluteBounds.x, formY - tmp->_absoluteBounds.y, param))
-                                return true;
+                                return ctrl;
                         }
                         break; // scrollable parent container found
                     }
@@ -697,7 +766,7 @@ bool Form::pointerEventInternal(bool mouse, int evt, int x, int y, int param)
 
             // Consume all input events anyways?
             if (ctrl->getConsumeInputEvents())
-                return true;
+                return ctrl;
 
             ctrl = ctrl->getParent();
         }
@@ -711,17 +780,29 @@ bool Form::pointerEventInternal(bool mouse, int evt, int x, int y, int param)
         }
     }
 
-    return false;
+    return NULL;
 }
 
 bool Form::touchEventInternal(Touch::TouchEvent evt, int x, int y, unsigned int contactIndex)
 {
-    return pointerEventInternal(false, evt, x, y, (int)contactIndex);
+    Control* ctrl = pointerEventInternal(false, evt, x, y, (int)contactIndex);
+    if (!ctrl)
+        return false;
+
+    // Controls may change their appearance in response to input without dirtying themselves.
+    ctrl->invalidateForm();
+    return true;
 }
 
 bool Form::mouseEventInternal(Mouse::MouseEvent evt, int x, int y, int wheelDelta)
 {
-    return pointerEventInternal(true, evt, x, y, wheelDelta);
+    Control* ctrl = pointerEventInternal(true, evt, x, y, wheelDelta);
+    if (!ctrl)
+        return false;
+
+    // Controls may change their appearance in response to input without dirtying themselves.
+    ctrl->invalidateForm();
+    return true;
 }
 
 bool Form::keyEventInternal(Keyboard::KeyEvent evt, int key)
@@ -768,7 +849,10 @@ bool Form::keyEventInternal(Keyboard::KeyEvent evt, int key)
         if (ctrl->isEnabled() && ctrl->isVisible())
         {
             if (ctrl->keyEvent(evt, key))
+            {
+                ctrl->invalidateForm();
                 return true;
+            }
         }
 
         ctrl = ctrl->getParent();
@@ -954,7 +1038,10 @@ bool Form::gamepadEventInternal(Gamepad::GamepadEvent evt, Gamepad* gamepad, uns
         if (ctrl->isEnabled() && ctrl->isVisible())
         {
             if (ctrl->gamepadEvent(evt, gamepad, analogIndex))
+            {
+                ctrl->invalidateForm();
                 return true;
+            }
         }
 
         ctrl = ctrl->getParent();
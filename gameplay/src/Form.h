@@ -143,6 +143,35 @@ public:
      */
     void setBatchingEnabled(bool enabled);
 
+    /**
+     * Determines whether geometry caching is enabled for this form.
+     *
+     * @return True if geometry caching is enabled for this form, false otherwise.
+     */
+    bool isCachingEnabled() const;
+
+    /**
+     * Turns geometry caching on or off for this form.
+     *
+     * When caching is enabled, the sprites generated while drawing the form are kept and
+     * drawn again on following frames without walking the control hierarchy, until the
+     * form is invalidated. Control setters, input handled by the form, animated opacity
+     * and glyph atlas updates of dynamic fonts invalidate the form automatically. Call
+     * invalidate() after changing a shared Theme::Style directly.
+     *
+     * Caching only applies while batching is enabled. It is disabled by default.
+     *
+     * @param enabled True to enable geometry caching, false otherwise (default).
+     */
+    void setCachingEnabled(bool enabled);
+
+    /**
+     * Discards the cached geometry of this form so it is regenerated on the next draw.
+     *
+     * @see setCachingEnabled(bool)
+     */
+    void invalidate();
+
 private:
     
     /**
@@ -238,7 +267,7 @@ private:
 
     const Matrix& getProjectionMatrix() const;
 
-    static bool pointerEventInternal(bool mouse, int evt, int x, int y, int param);
+    static Control* pointerEventInternal(bool mouse, int evt, int x, int y, int param);
 
     static Control* findInputControl(int* x, int* y, bool focus, unsigned int contactIndex);
 
@@ -260,10 +289,25 @@ private:
 
     static bool pollGamepad(Gamepad* gamepad);
 
+    /**
+     * Sprites drawn into a batch while drawing the form, kept for geometry caching.
+     */
+    struct CachedBatch
+    {
+        SpriteBatch* batch;
+        std::vector<SpriteBatch::SpriteVertex> vertices;
+        std::vector<unsigned short> indices;
+    };
+
     Node* _node;                        // Node for transforming this Form in world-space.
     Matrix _projectionMatrix;           // Projection matrix to be set on SpriteBatch objects when rendering the form
     std::vector<SpriteBatch*> _batches;
     bool _batched;
+    bool _caching;                      // Whether geometry caching is enabled.
+    bool _cacheValid;                   // Whether _cachedBatches matches the current state of the form.
+    bool _cacheCapturable;              // Cleared if the form drew into a batch it did not start.
+    unsigned int _cacheGlyphGeneration; // Font::getGlyphAtlasGeneration() when the geometry was cached.
+    std::vector<CachedBatch> _cachedBatches;
 };
 
 }
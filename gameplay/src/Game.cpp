@@ -7,6 +7,8 @@
 #include "SceneLoader.h"
 #include "ControlFactory.h"
 #include "Theme.h"
+#include "ResourceCache.h"
+#include "PoolAllocator.h"
 
 /** @script{ignore} */
 GLenum __gl_error_code = GL_NO_ERROR;
@@ -30,7 +32,7 @@ Game::Game()
 {
     GP_ASSERT(__gameInstance == NULL);
     __gameInstance = this;
-    _timeEvents = new std::priority_queue<TimeEvent, std::vector<TimeEvent>, std::less<TimeEvent> >();
+    _timeEvents = new TimeEventWheel();
 }
 
 Game::~Game()
@@ -40,6 +42,14 @@ Game::~Game()
     // Do not call any virtual functions from the destructor.
     // Finalization is done from outside this class.
     SAFE_DELETE(_timeEvents);
+    if (_scriptListeners)
+    {
+        for (std::map<std::string, ScriptListener*>::iterator itr = _scriptListeners->begin(); itr != _scriptListeners->end(); ++itr)
+        {
+            SAFE_DELETE(itr->second);
+        }
+        SAFE_DELETE(_scriptListeners);
+    }
 #ifdef GP_USE_MEM_LEAK_DETECTION
     Ref::printLeaks();
     printMemoryLeaks();
@@ -100,6 +110,7 @@ bool Game::startup()
     setViewport(Rectangle(0.0f, 0.0f, (float)_width, (float)_height));
     RenderState::initialize();
     FrameBuffer::initialize();
+    ResourceCache::initialize();
 
     _animationController = new AnimationController();
     _animationController->initialize();
@@ -168,14 +179,6 @@ void Game::shutdown()
 
 		// Shutdown scripting system first so that any objects allocated in script are released before our subsystems are released
 		_scriptController->finalizeGame();
-		if (_scriptListeners)
-		{
-			for (size_t i = 0; i < _scriptListeners->size(); i++)
-			{
-				SAFE_DELETE((*_scriptListeners)[i]);
-			}
-			SAFE_DELETE(_scriptListeners);
-		}
 		_scriptController->finalize();
 
         unsigned int gamepadCount = Gamepad::getGamepadCount();
@@ -185,6 +188,11 @@ void Game::shutdown()
             SAFE_DELETE(gamepad);
         }
 
+        // Release resources that are only kept loaded by the resource caches
+        // while the audio and graphics contexts still exist, and destroy the caches
+        // before static destructors run.
+        ResourceCache::finalize();
+
         _animationController->finalize();
         SAFE_DELETE(_animationController);
 
@@ -208,6 +216,9 @@ void Game::shutdown()
         FrameBuffer::finalize();
         RenderState::finalize();
 
+        // Destroy the object pools before static destructors run.
+        PoolAllocator::finalize();
+
         SAFE_DELETE(_properties);
 
 		_state = UNINITIALIZED;
@@ -334,12 +345,18 @@ void Game::frame()
         // Audio Rendering.
         _audioController->update(elapsedTime);
 
+        // Keep loaded resources within the memory budget.
+        ResourceCache::updateInternal(elapsedTime);
+
         // Graphics Rendering.
         render(elapsedTime);
 
         // Run script render.
         _scriptController->render(elapsedTime);
 
+        // Run script garbage collection within the script time budget.
+        _scriptController->collectGarbage();
+
         // Update FPS.
         ++_frameCount;
         if ((Game::getGameTime() - _frameLastFPS) >= 1000)
@@ -368,6 +385,9 @@ void Game::frame()
 
         // Script render.
         _scriptController->render(0);
+
+        // Script garbage collection.
+        _scriptController->collectGarbage();
     }
 }
 
@@ -531,59 +551,58 @@ void Game::getArguments(int* argc, char*** argv) const
     Platform::getArguments(argc, argv);
 }
 
-void Game::schedule(float timeOffset, TimeListener* timeListener, void* cookie)
+unsigned int Game::schedule(float timeOffset, TimeListener* timeListener, void* cookie)
 {
     GP_ASSERT(_timeEvents);
-    TimeEvent timeEvent(getGameTime() + timeOffset, timeListener, cookie);
-    _timeEvents->push(timeEvent);
+    double now = getGameTime();
+    return _timeEvents->add(now, now + timeOffset, timeListener, cookie);
 }
 
-void Game::schedule(float timeOffset, const char* function)
+unsigned int Game::schedule(float timeOffset, const char* function)
 {
+    GP_ASSERT(function);
     if (!_scriptListeners)
-        _scriptListeners = new std::vector<ScriptListener*>();
+        _scriptListeners = new std::map<std::string, ScriptListener*>();
 
-    ScriptListener* listener = new ScriptListener(function);
-    _scriptListeners->push_back(listener);
-    schedule(timeOffset, listener, NULL);
+    // Script listeners only hold the function to call, so share one per function.
+    ScriptListener*& listener = (*_scriptListeners)[function];
+    if (!listener)
+        listener = new ScriptListener(function);
+    return schedule(timeOffset, listener, NULL);
 }
 
-void Game::fireTimeEvents(double frameTime)
+bool Game::cancelSchedule(unsigned int handle)
 {
-    while (_timeEvents->size() > 0)
-    {
-        const TimeEvent* timeEvent = &_timeEvents->top();
-        if (timeEvent->time > frameTime)
-        {
-            break;
-        }
-        if (timeEvent->listener)
-        {
-            timeEvent->listener->timeEvent(frameTime - timeEvent->time, timeEvent->cookie);
-        }
-        _timeEvents->pop();
-    }
+    GP_ASSERT(_timeEvents);
+    return _timeEvents->remove(handle);
 }
 
-Game::ScriptListener::ScriptListener(const char* url)
+void Game::clearSchedule()
 {
-    function = Game::getInstance()->getScriptController()->loadUrl(url);
+    GP_ASSERT(_timeEvents);
+    _timeEvents->clear();
 }
 
-void Game::ScriptListener::timeEvent(long timeDiff, void* cookie)
+void Game::fireTimeEvents(double frameTime)
 {
-    Game::getInstance()->getScriptController()->executeFunction<void>(function.c_str(), "l", timeDiff);
+    GP_ASSERT(_timeEvents);
+    _timeEvents->fire(frameTime);
+}
+
+Game::ScriptListener::ScriptListener(const char* url)
+{
+    ScriptController* sc = Game::getInstance()->getScriptController();
+    function = sc->createFunction(sc->loadUrl(url).c_str(), "l");
 }
 
-Game::TimeEvent::TimeEvent(double time, TimeListener* timeListener, void* cookie)
-    : time(time), listener(timeListener), cookie(cookie)
+Game::ScriptListener::~ScriptListener()
 {
+    SAFE_DELETE(function);
 }
 
-bool Game::TimeEvent::operator<(const TimeEvent& v) const
+void Game::ScriptListener::timeEvent(long timeDiff, void* cookie)
 {
-    // The first element of std::priority_queue is the greatest.
-    return time > v.time;
+    Game::getInstance()->getScriptController()->executeFunction<void>(function, timeDiff);
 }
 
 Properties* Game::getConfig() const
@@ -14,11 +14,13 @@
 #include "Rectangle.h"
 #include "Vector4.h"
 #include "TimeListener.h"
+#include "TimeEventWheel.h"
 
 namespace gameplay
 {
 
 class ScriptController;
+class ScriptFunction;
 
 /**
  * Defines the base class your game will extend for game initialization, logic and platform delegates.
@@ -582,9 +584,11 @@ public:
      * @param timeOffset The number of game milliseconds in the future to schedule the event to be fired.
      * @param timeListener The TimeListener that will receive the event.
      * @param cookie The cookie data that the time event will contain.
+     *
+     * @return A handle that can be passed to cancelSchedule to cancel the time event.
      * @script{ignore}
      */
-    void schedule(float timeOffset, TimeListener* timeListener, void* cookie = 0);
+    unsigned int schedule(float timeOffset, TimeListener* timeListener, void* cookie = 0);
 
     /**
      * Schedules a time event to be sent to the given TimeListener a given number of game milliseconds from now.
@@ -595,8 +599,24 @@ public:
      * 
      * @param timeOffset The number of game milliseconds in the future to schedule the event to be fired.
      * @param function The Lua script function that will receive the event.
+     *
+     * @return A handle that can be passed to cancelSchedule to cancel the time event.
+     */
+    unsigned int schedule(float timeOffset, const char* function);
+
+    /**
+     * Cancels a time event that was scheduled and has not fired yet.
+     *
+     * @param handle The handle returned by schedule.
+     *
+     * @return True if the time event was cancelled, false if it already fired or was cancelled.
+     */
+    bool cancelSchedule(unsigned int handle);
+
+    /**
+     * Cancels all time events that are scheduled and have not fired yet.
      */
-    void schedule(float timeOffset, const char* function);
+    void clearSchedule();
 
     /**
      * Opens an URL in an external browser, if available.
@@ -681,13 +701,18 @@ private:
          */
         ScriptListener(const char* url);
 
+        /**
+         * Destructor.
+         */
+        ~ScriptListener();
+
         /**
          * @see TimeListener#timeEvent(long, void*)
          */
         void timeEvent(long timeDiff, void* cookie);
 
-        /** Holds the name of the Lua script function to call back. */
-        std::string function;
+        /** Holds the handle of the Lua script function to call back. */
+        ScriptFunction* function;
     };
 
     struct ShutdownListener : public TimeListener
@@ -695,20 +720,6 @@ private:
         void timeEvent(long timeDiff, void* cookie);
     };
 
-    /**
-     * TimeEvent represents the event that is sent to TimeListeners as a result of calling Game::schedule().
-     */
-    class TimeEvent
-    {
-    public:
-
-        TimeEvent(double time, TimeListener* timeListener, void* cookie);
-        bool operator<(const TimeEvent& v) const;
-        double time;
-        TimeListener* listener;
-        void* cookie;
-    };
-
     /**
      * Constructor.
      *
@@ -763,9 +774,9 @@ private:
     PhysicsController* _physicsController;      // Controls the simulation of a physics scene and entities.
     AIController* _aiController;                // Controls AI simulation.
     AudioListener* _audioListener;              // The audio listener in 3D space.
-    std::priority_queue<TimeEvent, std::vector<TimeEvent>, std::less<TimeEvent> >* _timeEvents;     // Contains the scheduled time events.
+    TimeEventWheel* _timeEvents;                // Contains the scheduled time events.
     ScriptController* _scriptController;            // Controls the scripting engine.
-    std::vector<ScriptListener*>* _scriptListeners; // Lua script listeners.
+    std::map<std::string, ScriptListener*>* _scriptListeners; // Lua script listeners, shared per function.
 
     // Note: Do not add STL object member variables on the stack; this will cause false memory leaks to be reported.
 
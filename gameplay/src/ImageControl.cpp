@@ -79,6 +79,7 @@ void ImageControl::setRegionSrc(float x, float y, float width, float height)
     _uvs.u2 = (x + width) * _tw;
     _uvs.v1 = 1.0f - (y * _th);
     _uvs.v2 = 1.0f - ((y + height) * _th);
+    invalidateForm();
 }
 
 void ImageControl::setRegionSrc(const Rectangle& region)
@@ -94,6 +95,7 @@ const Rectangle& ImageControl::getRegionSrc() const
 void ImageControl::setRegionDst(float x, float y, float width, float height)
 {
     _dstRegion.set(x, y, width, height);
+    invalidateForm();
 }
 
 void ImageControl::setRegionDst(const Rectangle& region)
@@ -1,10 +1,16 @@
 #include "Base.h"
 #include "Joint.h"
 #include "MeshSkin.h"
+#include "PoolAllocator.h"
 
 namespace gameplay
 {
 
+#ifndef GP_USE_MEM_LEAK_DETECTION
+// Pool for joints, created on first use and destroyed by Game::shutdown.
+static PoolAllocator* __jointAllocator = NULL;
+#endif
+
 Joint::Joint(const char* id)
     : Node(id), _jointMatrixDirty(true)
 {
@@ -19,6 +25,19 @@ Joint* Joint::create(const char* id)
     return new Joint(id);
 }
 
+#ifndef GP_USE_MEM_LEAK_DETECTION
+void* Joint::operator new(size_t size)
+{
+    return PoolAllocator::get(&__jointAllocator, "Joint", sizeof(Joint))->allocate(size);
+}
+
+void Joint::operator delete(void* p, size_t size)
+{
+    GP_ASSERT(__jointAllocator);
+    __jointAllocator->deallocate(p, size);
+}
+#endif
+
 Node* Joint::cloneSingleNode(NodeCloneContext &context) const
 {
     Joint* copy = Joint::create(getId());
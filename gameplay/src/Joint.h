@@ -53,6 +53,18 @@ protected:
      */
     virtual ~Joint();
 
+#ifndef GP_USE_MEM_LEAK_DETECTION
+    /**
+     * Allocates joints from their own pool, since they are larger than nodes.
+     */
+    static void* operator new(size_t size);
+
+    /**
+     * Returns a joint to the pool it was allocated from.
+     */
+    static void operator delete(void* p, size_t size);
+#endif
+
     /**
      * Creates a new joint with the given id.
      * 
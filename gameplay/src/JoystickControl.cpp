@@ -40,6 +40,7 @@ void JoystickControl::setInnerRegionSize(const Vector2& size)
 {
     if (_innerSize)
         _innerSize->set(size);
+    invalidateForm();
 }
 
 const Vector2& JoystickControl::getInnerRegionSize() const
@@ -54,6 +55,7 @@ void JoystickControl::setOuterRegionSize(const Vector2& size)
 {
     if (_outerSize)
         _outerSize->set(size);
+    invalidateForm();
 }
 
 const Vector2& JoystickControl::getOuterRegionSize() const
@@ -4,12 +4,13 @@
 namespace gameplay
 {
 
-Label::Label() : _text(""), _font(NULL)
+Label::Label() : _text(""), _font(NULL), _measuredFont(NULL), _measuredFontSize(0), _measuredSpacing(0), _measuredWidth(0), _measuredHeight(0)
 {
 }
 
 Label::~Label()
 {
+    SAFE_RELEASE(_measuredFont);
 }
 
 Label* Label::create(const char* id, Theme::Style* style)
@@ -95,8 +96,24 @@ void Label::updateBounds()
         // Measure bounds based only on normal state so that bounds updates are not always required on state changes.
         // This is a trade-off for functionality vs performance, but changing the size of UI controls on hover/focus/etc
         // is a pretty bad practice so we'll prioritize performance here.
-        unsigned int w, h;
-        _font->measureText(_text.c_str(), getFontSize(NORMAL), &w, &h);
+        unsigned int fontSize = getFontSize(NORMAL);
+        float spacing = _font->getCharacterSpacing();
+        if (_font != _measuredFont || fontSize != _measuredFontSize || spacing != _measuredSpacing || _text != _measuredText)
+        {
+            _font->measureText(_text.c_str(), fontSize, &_measuredWidth, &_measuredHeight);
+            _measuredText = _text;
+            if (_measuredFont != _font)
+            {
+                // Hold the font so its address cannot be reused by another font while it is the cache key.
+                _font->addRef();
+                SAFE_RELEASE(_measuredFont);
+                _measuredFont = _font;
+            }
+            _measuredFontSize = fontSize;
+            _measuredSpacing = spacing;
+        }
+        unsigned int w = _measuredWidth;
+        unsigned int h = _measuredHeight;
         if (_autoSize & AUTO_SIZE_WIDTH)
         {
             setWidthInternal(w + getBorder(NORMAL).left + getBorder(NORMAL).right + getPadding().left + getPadding().right);
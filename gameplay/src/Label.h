@@ -142,6 +142,19 @@ private:
      * Constructor.
      */
     Label(const Label& copy);
+
+    /**
+     * The text, font, font size and character spacing last measured for auto-sizing,
+     * along with the measured size.
+     * Bounds updates are frequent (every scroll step dirties them), so measuring is skipped
+     * while these are unchanged. The measured font is referenced, so it stays a valid key.
+     */
+    std::string _measuredText;
+    Font* _measuredFont;
+    unsigned int _measuredFontSize;
+    float _measuredSpacing;
+    unsigned int _measuredWidth;
+    unsigned int _measuredHeight;
 };
 
 }
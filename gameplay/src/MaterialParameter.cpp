@@ -1,6 +1,7 @@
 #include "Base.h"
 #include "MaterialParameter.h"
 #include "Node.h"
+#include "ScriptController.h"
 
 namespace gameplay
 {
@@ -13,6 +14,9 @@ _type(MaterialParameter::NONE), _count(1), _dynamic(false), _name(name ? name :
 
 MaterialParameter::~MaterialParameter()
 {
+    // MaterialParameter does not start with its Ref base, so it is pushed to Lua at a different address.
+    ScriptController::removeUserdata(this);
+
     clearValue();
 }
 
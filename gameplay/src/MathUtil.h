@@ -1,6 +1,10 @@
 #ifndef MATHUTIL_H_
 #define MATHUTIL_H_
 
+#if !defined(USE_NEON) && defined(USE_SSE)
+#include <emmintrin.h>
+#endif
+
 namespace gameplay
 {
 /**
@@ -56,6 +60,8 @@ private:
 
     inline static void multiplyMatrix(const float* m1, const float* m2, float* dst);
 
+    inline static void multiplyMatrixArray(const float* m1, const float* m2, unsigned int count, float* dst);
+
     inline static void negateMatrix(const float* m, float* dst);
 
     inline static void transposeMatrix(const float* m, float* dst);
@@ -64,8 +70,14 @@ private:
 
     inline static void transformVector4(const float* m, const float* v, float* dst);
 
+    inline static void transformVector3Array(const float* m, const float* v, float w, unsigned int count, float* dst);
+
     inline static void crossVector3(const float* v1, const float* v2, float* dst);
 
+#if !defined(USE_NEON) && defined(USE_SSE)
+    inline static __m128 multiplyColumn(__m128 a0, __m128 a1, __m128 a2, __m128 a3, __m128 b);
+#endif
+
     MathUtil();
 };
 
@@ -75,6 +87,8 @@ private:
 
 #ifdef USE_NEON
 #include "MathUtilNeon.inl"
+#elif defined(USE_SSE)
+#include "MathUtilSSE.inl"
 #else
 #include "MathUtil.inl"
 #endif
@@ -123,6 +123,14 @@ inline void MathUtil::multiplyMatrix(const float* m1, const float* m2, float* ds
     );
 }
 
+inline void MathUtil::multiplyMatrixArray(const float* m1, const float* m2, unsigned int count, float* dst)
+{
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        multiplyMatrix(&m1[i * 16], &m2[i * 16], &dst[i * 16]);
+    }
+}
+
 inline void MathUtil::negateMatrix(const float* m, float* dst)
 {
     asm volatile(
@@ -201,6 +209,16 @@ inline void MathUtil::transformVector4(const float* m, const float* v, float* ds
     );
 }
 
+inline void MathUtil::transformVector3Array(const float* m, const float* v, float w, unsigned int count, float* dst)
+{
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        // The components are read before the call, so v may be the same array as dst.
+        const float* p = &v[i * 3];
+        transformVector4(m, p[0], p[1], p[2], w, &dst[i * 3]);
+    }
+}
+
 inline void MathUtil::crossVector3(const float* v1, const float* v2, float* dst)
 {
     asm volatile(
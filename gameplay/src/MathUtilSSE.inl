@@ -0,0 +1,192 @@
+namespace gameplay
+{
+
+// Matrices are not guaranteed to be 16-byte aligned, so all loads and stores are unaligned.
+// Products are summed in the same order as MathUtil.inl so that results match it exactly.
+
+// Returns the columns a0-a3 weighted by the components of b.
+inline __m128 MathUtil::multiplyColumn(__m128 a0, __m128 a1, __m128 a2, __m128 a3, __m128 b)
+{
+    __m128 col = _mm_mul_ps(a0, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 0, 0, 0)));
+    col = _mm_add_ps(col, _mm_mul_ps(a1, _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 1, 1, 1))));
+    col = _mm_add_ps(col, _mm_mul_ps(a2, _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 2, 2, 2))));
+    col = _mm_add_ps(col, _mm_mul_ps(a3, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 3, 3, 3))));
+    return col;
+}
+
+inline void MathUtil::addMatrix(const float* m, float scalar, float* dst)
+{
+    __m128 s = _mm_set1_ps(scalar);
+    __m128 col0 = _mm_add_ps(_mm_loadu_ps(&m[0]), s);
+    __m128 col1 = _mm_add_ps(_mm_loadu_ps(&m[4]), s);
+    __m128 col2 = _mm_add_ps(_mm_loadu_ps(&m[8]), s);
+    __m128 col3 = _mm_add_ps(_mm_loadu_ps(&m[12]), s);
+
+    _mm_storeu_ps(&dst[0], col0);
+    _mm_storeu_ps(&dst[4], col1);
+    _mm_storeu_ps(&dst[8], col2);
+    _mm_storeu_ps(&dst[12], col3);
+}
+
+inline void MathUtil::addMatrix(const float* m1, const float* m2, float* dst)
+{
+    __m128 col0 = _mm_add_ps(_mm_loadu_ps(&m1[0]), _mm_loadu_ps(&m2[0]));
+    __m128 col1 = _mm_add_ps(_mm_loadu_ps(&m1[4]), _mm_loadu_ps(&m2[4]));
+    __m128 col2 = _mm_add_ps(_mm_loadu_ps(&m1[8]), _mm_loadu_ps(&m2[8]));
+    __m128 col3 = _mm_add_ps(_mm_loadu_ps(&m1[12]), _mm_loadu_ps(&m2[12]));
+
+    _mm_storeu_ps(&dst[0], col0);
+    _mm_storeu_ps(&dst[4], col1);
+    _mm_storeu_ps(&dst[8], col2);
+    _mm_storeu_ps(&dst[12], col3);
+}
+
+inline void MathUtil::subtractMatrix(const float* m1, const float* m2, float* dst)
+{
+    __m128 col0 = _mm_sub_ps(_mm_loadu_ps(&m1[0]), _mm_loadu_ps(&m2[0]));
+    __m128 col1 = _mm_sub_ps(_mm_loadu_ps(&m1[4]), _mm_loadu_ps(&m2[4]));
+    __m128 col2 = _mm_sub_ps(_mm_loadu_ps(&m1[8]), _mm_loadu_ps(&m2[8]));
+    __m128 col3 = _mm_sub_ps(_mm_loadu_ps(&m1[12]), _mm_loadu_ps(&m2[12]));
+
+    _mm_storeu_ps(&dst[0], col0);
+    _mm_storeu_ps(&dst[4], col1);
+    _mm_storeu_ps(&dst[8], col2);
+    _mm_storeu_ps(&dst[12], col3);
+}
+
+inline void MathUtil::multiplyMatrix(const float* m, float scalar, float* dst)
+{
+    __m128 s = _mm_set1_ps(scalar);
+    __m128 col0 = _mm_mul_ps(_mm_loadu_ps(&m[0]), s);
+    __m128 col1 = _mm_mul_ps(_mm_loadu_ps(&m[4]), s);
+    __m128 col2 = _mm_mul_ps(_mm_loadu_ps(&m[8]), s);
+    __m128 col3 = _mm_mul_ps(_mm_loadu_ps(&m[12]), s);
+
+    _mm_storeu_ps(&dst[0], col0);
+    _mm_storeu_ps(&dst[4], col1);
+    _mm_storeu_ps(&dst[8], col2);
+    _mm_storeu_ps(&dst[12], col3);
+}
+
+inline void MathUtil::multiplyMatrix(const float* m1, const float* m2, float* dst)
+{
+    __m128 a0 = _mm_loadu_ps(&m1[0]);
+    __m128 a1 = _mm_loadu_ps(&m1[4]);
+    __m128 a2 = _mm_loadu_ps(&m1[8]);
+    __m128 a3 = _mm_loadu_ps(&m1[12]);
+
+    __m128 b0 = _mm_loadu_ps(&m2[0]);
+    __m128 b1 = _mm_loadu_ps(&m2[4]);
+    __m128 b2 = _mm_loadu_ps(&m2[8]);
+    __m128 b3 = _mm_loadu_ps(&m2[12]);
+
+    // Each column of the product is the columns of m1 weighted by a column of m2.
+    // Everything is loaded before storing to support m1 or m2 being the same array as dst.
+    _mm_storeu_ps(&dst[0], multiplyColumn(a0, a1, a2, a3, b0));
+    _mm_storeu_ps(&dst[4], multiplyColumn(a0, a1, a2, a3, b1));
+    _mm_storeu_ps(&dst[8], multiplyColumn(a0, a1, a2, a3, b2));
+    _mm_storeu_ps(&dst[12], multiplyColumn(a0, a1, a2, a3, b3));
+}
+
+inline void MathUtil::multiplyMatrixArray(const float* m1, const float* m2, unsigned int count, float* dst)
+{
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        multiplyMatrix(&m1[i * 16], &m2[i * 16], &dst[i * 16]);
+    }
+}
+
+inline void MathUtil::negateMatrix(const float* m, float* dst)
+{
+    // Flip the sign bits, which matches scalar negation for all values including zero and NaN.
+    __m128 sign = _mm_set1_ps(-0.0f);
+    __m128 col0 = _mm_xor_ps(_mm_loadu_ps(&m[0]), sign);
+    __m128 col1 = _mm_xor_ps(_mm_loadu_ps(&m[4]), sign);
+    __m128 col2 = _mm_xor_ps(_mm_loadu_ps(&m[8]), sign);
+    __m128 col3 = _mm_xor_ps(_mm_loadu_ps(&m[12]), sign);
+
+    _mm_storeu_ps(&dst[0], col0);
+    _mm_storeu_ps(&dst[4], col1);
+    _mm_storeu_ps(&dst[8], col2);
+    _mm_storeu_ps(&dst[12], col3);
+}
+
+inline void MathUtil::transposeMatrix(const float* m, float* dst)
+{
+    __m128 col0 = _mm_loadu_ps(&m[0]);
+    __m128 col1 = _mm_loadu_ps(&m[4]);
+    __m128 col2 = _mm_loadu_ps(&m[8]);
+    __m128 col3 = _mm_loadu_ps(&m[12]);
+
+    _MM_TRANSPOSE4_PS(col0, col1, col2, col3);
+
+    _mm_storeu_ps(&dst[0], col0);
+    _mm_storeu_ps(&dst[4], col1);
+    _mm_storeu_ps(&dst[8], col2);
+    _mm_storeu_ps(&dst[12], col3);
+}
+
+inline void MathUtil::transformVector4(const float* m, float x, float y, float z, float w, float* dst)
+{
+    __m128 v = _mm_mul_ps(_mm_loadu_ps(&m[0]), _mm_set1_ps(x));
+    v = _mm_add_ps(v, _mm_mul_ps(_mm_loadu_ps(&m[4]), _mm_set1_ps(y)));
+    v = _mm_add_ps(v, _mm_mul_ps(_mm_loadu_ps(&m[8]), _mm_set1_ps(z)));
+    v = _mm_add_ps(v, _mm_mul_ps(_mm_loadu_ps(&m[12]), _mm_set1_ps(w)));
+
+    // Only three components are written, since dst may be a Vector3.
+    float result[4];
+    _mm_storeu_ps(result, v);
+    dst[0] = result[0];
+    dst[1] = result[1];
+    dst[2] = result[2];
+}
+
+inline void MathUtil::transformVector4(const float* m, const float* v, float* dst)
+{
+    // Handle case where v == dst.
+    __m128 result = _mm_mul_ps(_mm_loadu_ps(&m[0]), _mm_set1_ps(v[0]));
+    result = _mm_add_ps(result, _mm_mul_ps(_mm_loadu_ps(&m[4]), _mm_set1_ps(v[1])));
+    result = _mm_add_ps(result, _mm_mul_ps(_mm_loadu_ps(&m[8]), _mm_set1_ps(v[2])));
+    result = _mm_add_ps(result, _mm_mul_ps(_mm_loadu_ps(&m[12]), _mm_set1_ps(v[3])));
+
+    _mm_storeu_ps(dst, result);
+}
+
+inline void MathUtil::transformVector3Array(const float* m, const float* v, float w, unsigned int count, float* dst)
+{
+    // The matrix columns and the w term are loaded once for the whole array.
+    __m128 col0 = _mm_loadu_ps(&m[0]);
+    __m128 col1 = _mm_loadu_ps(&m[4]);
+    __m128 col2 = _mm_loadu_ps(&m[8]);
+    __m128 col3 = _mm_mul_ps(_mm_loadu_ps(&m[12]), _mm_set1_ps(w));
+
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        // Vector3 holds only three floats, so each component is loaded and stored separately
+        // to avoid touching the neighbouring element, which also allows v to be the same array as dst.
+        const float* p = &v[i * 3];
+        __m128 result = _mm_mul_ps(col0, _mm_set1_ps(p[0]));
+        result = _mm_add_ps(result, _mm_mul_ps(col1, _mm_set1_ps(p[1])));
+        result = _mm_add_ps(result, _mm_mul_ps(col2, _mm_set1_ps(p[2])));
+        result = _mm_add_ps(result, col3);
+
+        float* d = &dst[i * 3];
+        _mm_storel_pi((__m64*)d, result);
+        _mm_store_ss(&d[2], _mm_movehl_ps(result, result));
+    }
+}
+
+inline void MathUtil::crossVector3(const float* v1, const float* v2, float* dst)
+{
+    // Vector3 holds only three floats, so a four-wide load would read past its end.
+    // Loading each component separately costs more than the scalar version saves.
+    float x = (v1[1] * v2[2]) - (v1[2] * v2[1]);
+    float y = (v1[2] * v2[0]) - (v1[0] * v2[2]);
+    float z = (v1[0] * v2[1]) - (v1[1] * v2[0]);
+
+    dst[0] = x;
+    dst[1] = y;
+    dst[2] = z;
+}
+
+}
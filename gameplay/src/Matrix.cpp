@@ -723,6 +723,15 @@ void Matrix::multiply(const Matrix& m1, const Matrix& m2, Matrix* dst)
     MathUtil::multiplyMatrix(m1.m, m2.m, dst->m);
 }
 
+void Matrix::multiply(const Matrix* m1, const Matrix* m2, unsigned int count, Matrix* dst)
+{
+    GP_ASSERT(m1);
+    GP_ASSERT(m2);
+    GP_ASSERT(dst);
+
+    MathUtil::multiplyMatrixArray((const float*)m1, (const float*)m2, count, (float*)dst);
+}
+
 void Matrix::negate()
 {
     negate(this);
@@ -892,6 +901,14 @@ void Matrix::transformPoint(const Vector3& point, Vector3* dst) const
     transformVector(point.x, point.y, point.z, 1.0f, dst);
 }
 
+void Matrix::transformPoints(const Vector3* points, unsigned int count, Vector3* dst) const
+{
+    GP_ASSERT(points);
+    GP_ASSERT(dst);
+
+    MathUtil::transformVector3Array(m, (const float*)points, 1.0f, count, (float*)dst);
+}
+
 void Matrix::transformVector(Vector3* vector) const
 {
     GP_ASSERT(vector);
@@ -903,6 +920,14 @@ void Matrix::transformVector(const Vector3& vector, Vector3* dst) const
     transformVector(vector.x, vector.y, vector.z, 0.0f, dst);
 }
 
+void Matrix::transformVectors(const Vector3* vectors, unsigned int count, Vector3* dst) const
+{
+    GP_ASSERT(vectors);
+    GP_ASSERT(dst);
+
+    MathUtil::transformVector3Array(m, (const float*)vectors, 0.0f, count, (float*)dst);
+}
+
 void Matrix::transformVector(float x, float y, float z, float w, Vector3* dst) const
 {
     GP_ASSERT(dst);
@@ -515,6 +515,19 @@ public:
      */
     static void multiply(const Matrix& m1, const Matrix& m2, Matrix* dst);
 
+    /**
+     * Multiplies each matrix in m1 by the matrix at the same index in m2
+     * and stores the results in dst.
+     *
+     * @param m1 The array of first matrices to multiply.
+     * @param m2 The array of second matrices to multiply.
+     * @param count The number of matrix pairs to multiply.
+     * @param dst An array of at least count matrices to store the results in.
+     *
+     * @script{ignore}
+     */
+    static void multiply(const Matrix* m1, const Matrix* m2, unsigned int count, Matrix* dst);
+
     /**
      * Negates this matrix.
      */
@@ -750,6 +763,20 @@ public:
      */
     void transformPoint(const Vector3& point, Vector3* dst) const;
 
+    /**
+     * Transforms the specified array of points by this matrix, and stores
+     * the results in dst.
+     *
+     * The points may be transformed in place by passing the same array as dst.
+     *
+     * @param points The points to transform.
+     * @param count The number of points to transform.
+     * @param dst An array of at least count vectors to store the transformed points in.
+     *
+     * @script{ignore}
+     */
+    void transformPoints(const Vector3* points, unsigned int count, Vector3* dst) const;
+
     /**
      * Transforms the specified vector by this matrix by
      * treating the fourth (w) coordinate as zero.
@@ -770,6 +797,21 @@ public:
      */
     void transformVector(const Vector3& vector, Vector3* dst) const;
 
+    /**
+     * Transforms the specified array of vectors by this matrix by
+     * treating the fourth (w) coordinate as zero, and stores the
+     * results in dst.
+     *
+     * The vectors may be transformed in place by passing the same array as dst.
+     *
+     * @param vectors The vectors to transform.
+     * @param count The number of vectors to transform.
+     * @param dst An array of at least count vectors to store the transformed vectors in.
+     *
+     * @script{ignore}
+     */
+    void transformVectors(const Vector3* vectors, unsigned int count, Vector3* dst) const;
+
     /**
      * Transforms the specified vector by this matrix.
      *
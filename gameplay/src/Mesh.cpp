@@ -4,10 +4,19 @@
 #include "Effect.h"
 #include "Model.h"
 #include "Material.h"
+#include "ResourceCache.h"
 
 namespace gameplay
 {
 
+// Cache of meshes loaded from bundles.
+static ResourceCache* __meshCache = NULL;
+
+ResourceCache* getMeshCache()
+{
+    return ResourceCache::get(&__meshCache, "Mesh");
+}
+
 Mesh::Mesh(const VertexFormat& vertexFormat) 
     : _vertexFormat(vertexFormat), _vertexCount(0), _vertexBuffer(0), _primitiveType(TRIANGLES), 
       _partCount(0), _parts(NULL), _dynamic(false)
@@ -16,6 +25,9 @@ Mesh::Mesh(const VertexFormat& vertexFormat)
 
 Mesh::~Mesh()
 {
+    if (__meshCache)
+        __meshCache->remove(this);
+
     if (_parts)
     {
         for (unsigned int i = 0; i < _partCount; ++i)
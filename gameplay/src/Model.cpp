@@ -5,10 +5,16 @@
 #include "Technique.h"
 #include "Pass.h"
 #include "Node.h"
+#include "PoolAllocator.h"
 
 namespace gameplay
 {
 
+#ifndef GP_USE_MEM_LEAK_DETECTION
+// Pool for models, created on first use and destroyed by Game::shutdown.
+static PoolAllocator* __modelAllocator = NULL;
+#endif
+
 Model::Model(Mesh* mesh) :
     _mesh(mesh), _material(NULL), _partCount(0), _partMaterials(NULL), _node(NULL), _skin(NULL)
 {
@@ -41,6 +47,19 @@ Model* Model::create(Mesh* mesh)
     return new Model(mesh);
 }
 
+#ifndef GP_USE_MEM_LEAK_DETECTION
+void* Model::operator new(size_t size)
+{
+    return PoolAllocator::get(&__modelAllocator, "Model", sizeof(Model))->allocate(size);
+}
+
+void Model::operator delete(void* p, size_t size)
+{
+    GP_ASSERT(__modelAllocator);
+    __modelAllocator->deallocate(p, size);
+}
+#endif
+
 Mesh* Model::getMesh() const
 {
     return _mesh;
@@ -172,6 +172,18 @@ private:
      */
     ~Model();
 
+#ifndef GP_USE_MEM_LEAK_DETECTION
+    /**
+     * Allocates models from a pool, since scenes create and destroy them in large numbers.
+     */
+    static void* operator new(size_t size);
+
+    /**
+     * Returns a model to the pool it was allocated from.
+     */
+    static void operator delete(void* p, size_t size);
+#endif
+
     /**
      * Hidden copy assignment operator.
      */
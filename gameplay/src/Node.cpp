@@ -10,6 +10,7 @@
 #include "PhysicsCharacter.h"
 #include "Game.h"
 #include "Terrain.h"
+#include "PoolAllocator.h"
 
 // Node dirty flags
 #define NODE_DIRTY_WORLD 1
@@ -19,6 +20,11 @@
 namespace gameplay
 {
 
+#ifndef GP_USE_MEM_LEAK_DETECTION
+// Pool for nodes, created on first use and destroyed by Game::shutdown.
+static PoolAllocator* __nodeAllocator = NULL;
+#endif
+
 Node::Node(const char* id)
     : _scene(NULL), _firstChild(NULL), _nextSibling(NULL), _prevSibling(NULL), _parent(NULL), _childCount(0), _active(true),
     _tags(NULL), _camera(NULL), _light(NULL), _model(NULL), _terrain(NULL), _form(NULL), _audioSource(NULL), _particleEmitter(NULL),
@@ -32,6 +38,9 @@ Node::Node(const char* id)
 
 Node::~Node()
 {
+    // Node does not start with its Ref base, so it is pushed to Lua at a different address.
+    ScriptController::removeUserdata(this);
+
     removeAllChildren();
 
     if (_model)
@@ -70,6 +79,19 @@ Node* Node::create(const char* id)
     return new Node(id);
 }
 
+#ifndef GP_USE_MEM_LEAK_DETECTION
+void* Node::operator new(size_t size)
+{
+    return PoolAllocator::get(&__nodeAllocator, "Node", sizeof(Node))->allocate(size);
+}
+
+void Node::operator delete(void* p, size_t size)
+{
+    GP_ASSERT(__nodeAllocator);
+    __nodeAllocator->deallocate(p, size);
+}
+#endif
+
 const char* Node::getId() const
 {
     return _id.c_str();
@@ -80,6 +102,10 @@ void Node::setId(const char* id)
     if (id)
     {
         _id = id;
+
+        // The agent's interned ID is looked up again the next time it is needed.
+        if (_agent)
+            _agent->_internedId = NULL;
     }
 }
 
@@ -1286,6 +1312,7 @@ void Node::setAgent(AIAgent* agent)
         {
             Game::getInstance()->getAIController()->removeAgent(_agent);
             _agent->_node = NULL;
+            _agent->_internedId = NULL;
             SAFE_RELEASE(_agent);
         }
 
@@ -1295,6 +1322,7 @@ void Node::setAgent(AIAgent* agent)
         {
             _agent->addRef();
             _agent->_node = this;
+            _agent->_internedId = NULL;
             Game::getInstance()->getAIController()->addAgent(_agent);
         }
     }
@@ -659,6 +659,21 @@ protected:
      */
     virtual ~Node();
 
+#ifndef GP_USE_MEM_LEAK_DETECTION
+    /**
+     * Allocates nodes from a pool, since scenes create and destroy them in large numbers.
+     *
+     * Nodes are allocated from the heap when memory leak detection is enabled, so that
+     * each node is tracked.
+     */
+    static void* operator new(size_t size);
+
+    /**
+     * Returns a node to the pool it was allocated from.
+     */
+    static void operator delete(void* p, size_t size);
+#endif
+
     /**
      * Clones a single node and its data but not its children.
      *
@@ -262,12 +262,27 @@ void PhysicsCollisionObject::PhysicsMotionState::setWorldTransform(const btTrans
     GP_ASSERT(_node);
 
     _worldTransform = transform * _centerOfMassOffset;
-        
+
     const btQuaternion& rot = _worldTransform.getRotation();
     const btVector3& pos = _worldTransform.getOrigin();
 
-    _node->setRotation(rot.x(), rot.y(), rot.z(), rot.w());
-    _node->setTranslation(pos.x(), pos.y(), pos.z());
+    // Skip nodes that are already at the body's transform so they don't dispatch transform changes.
+    // This compares against the node rather than the last synchronized transform, so a node that
+    // was moved by other code while its body is active is still moved back to the body.
+    const Quaternion& rotation = _node->getRotation();
+    const Vector3& translation = _node->getTranslation();
+    if (rotation.x == rot.x() && rotation.y == rot.y() && rotation.z == rot.z() && rotation.w == rot.w() &&
+        translation.x == pos.x() && translation.y == pos.y() && translation.z == pos.z())
+    {
+        return;
+    }
+
+    // Set the rotation and translation together so listeners are notified once.
+    _node->set(_node->getScale(), Quaternion(rot.x(), rot.y(), rot.z(), rot.w()), Vector3(pos.x(), pos.y(), pos.z()));
+
+    PhysicsController* controller = Game::getInstance()->getPhysicsController();
+    GP_ASSERT(controller);
+    ++controller->_syncedBodyCount;
 }
 
 void PhysicsCollisionObject::PhysicsMotionState::updateTransformFromNode() const
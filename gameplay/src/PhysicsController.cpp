@@ -31,7 +31,10 @@ PhysicsController::PhysicsController()
   : _isUpdating(false), _collisionConfiguration(NULL), _dispatcher(NULL),
     _overlappingPairCache(NULL), _solver(NULL), _world(NULL), _ghostPairCallback(NULL),
     _debugDrawer(NULL), _status(PhysicsController::Listener::DEACTIVATED), _listeners(NULL),
-    _gravity(btScalar(0.0), btScalar(-9.8), btScalar(0.0)), _collisionCallback(NULL)
+    _gravity(btScalar(0.0), btScalar(-9.8), btScalar(0.0)), _fixedTimeStep(1.0f / 60.0f), _maxSubSteps(10),
+    _subStepBudget(0.0f), _subStepCost(0.0f), _subStepCount(0), _stepTime(0.0f), _droppedTime(0.0f),
+    _rigidBodyCount(0), _syncedBodyCount(0),
+    _collisionCallback(NULL)
 {
     // Default gravity is 9.8 along the negative Y axis.
     _collisionCallback = new CollisionCallback(this);
@@ -155,6 +158,64 @@ void PhysicsController::setGravity(const Vector3& gravity)
         _world->setGravity(BV(_gravity));
 }
 
+float PhysicsController::getFixedTimeStep() const
+{
+    return _fixedTimeStep;
+}
+
+void PhysicsController::setFixedTimeStep(float timeStep)
+{
+    GP_ASSERT(timeStep >= 0.0f);
+    _fixedTimeStep = timeStep;
+    _subStepCost = 0.0f;
+}
+
+unsigned int PhysicsController::getMaxSubSteps() const
+{
+    return _maxSubSteps;
+}
+
+void PhysicsController::setMaxSubSteps(unsigned int maxSubSteps)
+{
+    GP_ASSERT(maxSubSteps > 0);
+    _maxSubSteps = maxSubSteps > 0 ? maxSubSteps : 1;
+}
+
+float PhysicsController::getSubStepBudget() const
+{
+    return _subStepBudget;
+}
+
+void PhysicsController::setSubStepBudget(float budget)
+{
+    _subStepBudget = budget > 0.0f ? budget : 0.0f;
+}
+
+unsigned int PhysicsController::getSubStepCount() const
+{
+    return _subStepCount;
+}
+
+float PhysicsController::getStepTime() const
+{
+    return _stepTime;
+}
+
+float PhysicsController::getDroppedTime() const
+{
+    return _droppedTime;
+}
+
+unsigned int PhysicsController::getSyncedBodyCount() const
+{
+    return _syncedBodyCount;
+}
+
+unsigned int PhysicsController::getSkippedBodyCount() const
+{
+    return _rigidBodyCount > _syncedBodyCount ? _rigidBodyCount - _syncedBodyCount : 0;
+}
+
 void PhysicsController::drawDebug(const Matrix& viewProjection)
 {
     GP_ASSERT(_debugDrawer);
@@ -476,12 +537,40 @@ void PhysicsController::update(float elapsedTime)
     GP_ASSERT(_world);
     _isUpdating = true;
 
-    // Update the physics simulation, with a maximum
-    // of 10 simulation steps being performed in a given frame.
-    //
+    // Bullet only synchronizes active bodies; the motion states count the ones that moved.
+    _syncedBodyCount = 0;
+
     // Note that stepSimulation takes elapsed time in seconds
     // so we divide by 1000 to convert from milliseconds.
-    _world->stepSimulation(elapsedTime * 0.001f, 10);
+    double stepStart = Game::getAbsoluteTime();
+    if (_fixedTimeStep > 0.0f)
+    {
+        // Limit the number of sub steps to what fits in the time budget, based
+        // on the cost of previous sub steps, so frame spikes can't feed themselves.
+        int maxSubSteps = (int)_maxSubSteps;
+        if (_subStepBudget > 0.0f && _subStepCost > 0.0f)
+            maxSubSteps = std::max(1, std::min(maxSubSteps, (int)(_subStepBudget / _subStepCost)));
+
+        // Bullet accumulates the elapsed time, performs whole fixed steps (dropping any
+        // beyond maxSubSteps) and writes interpolated transforms through the motion states.
+        int subSteps = _world->stepSimulation(elapsedTime * 0.001f, maxSubSteps, _fixedTimeStep);
+        _subStepCount = (unsigned int)std::min(subSteps, maxSubSteps);
+        _droppedTime = subSteps > maxSubSteps ? (subSteps - maxSubSteps) * _fixedTimeStep * 1000.0f : 0.0f;
+    }
+    else
+    {
+        _world->stepSimulation(elapsedTime * 0.001f, 0);
+        _subStepCount = elapsedTime > 0.0f ? 1 : 0;
+        _droppedTime = 0.0f;
+    }
+    _stepTime = (float)(Game::getAbsoluteTime() - stepStart);
+
+    // Track a running average of the cost of a single sub step for the budget.
+    if (_subStepCount > 0)
+    {
+        float cost = _stepTime / _subStepCount;
+        _subStepCost = _subStepCost > 0.0f ? _subStepCost + (cost - _subStepCost) * 0.1f : cost;
+    }
 
     // If we have status listeners, then check if our status has changed.
     if (_listeners || _callbacks["statusEvent"])
@@ -648,6 +737,7 @@ void PhysicsController::addCollisionObject(PhysicsCollisionObject* object)
     {
     case PhysicsCollisionObject::RIGID_BODY:
         _world->addRigidBody(static_cast<btRigidBody*>(object->getCollisionObject()), group, mask);
+        ++_rigidBodyCount;
         break;
 
     case PhysicsCollisionObject::CHARACTER:
@@ -677,6 +767,8 @@ void PhysicsController::removeCollisionObject(PhysicsCollisionObject* object, bo
         {
         case PhysicsCollisionObject::RIGID_BODY:
             _world->removeRigidBody(static_cast<btRigidBody*>(object->getCollisionObject()));
+            GP_ASSERT(_rigidBodyCount > 0);
+            --_rigidBodyCount;
             break;
 
         case PhysicsCollisionObject::CHARACTER:
@@ -30,6 +30,7 @@ class PhysicsController : public ScriptTarget
     friend class PhysicsCharacter;
     friend class PhysicsVehicle;
     friend class PhysicsCollisionObject;
+    friend class PhysicsCollisionObject::PhysicsMotionState;
     friend class PhysicsGhostObject;
 
 public:
@@ -289,6 +290,102 @@ public:
      */
     void setGravity(const Vector3& gravity);
 
+    /**
+     * Gets the fixed time step used to advance the simulation, in seconds.
+     *
+     * @return The fixed time step, or zero if the simulation is advanced with variable time steps.
+     */
+    float getFixedTimeStep() const;
+
+    /**
+     * Sets the fixed time step used to advance the simulation, in seconds (default is 1/60).
+     *
+     * Frame time is accumulated and the simulation is advanced in whole steps of this size.
+     * The transforms written to the nodes of active rigid bodies are interpolated over the
+     * remaining fraction of a step, so motion stays smooth when the frame rate differs
+     * from the simulation rate.
+     *
+     * Passing zero advances the simulation once per frame by the frame's elapsed time.
+     *
+     * @param timeStep The fixed time step, in seconds.
+     */
+    void setFixedTimeStep(float timeStep);
+
+    /**
+     * Gets the maximum number of simulation sub steps performed in a single frame.
+     *
+     * @return The maximum number of sub steps.
+     */
+    unsigned int getMaxSubSteps() const;
+
+    /**
+     * Sets the maximum number of simulation sub steps performed in a single frame (default is 10).
+     *
+     * Any simulation time beyond this number of steps is dropped, which slows
+     * the simulation down during frame spikes instead of compounding them.
+     *
+     * @param maxSubSteps The maximum number of sub steps (must be at least one).
+     */
+    void setMaxSubSteps(unsigned int maxSubSteps);
+
+    /**
+     * Gets the time budget for simulation sub steps in a single frame, in milliseconds.
+     *
+     * @return The sub step time budget, or zero if there is no budget.
+     */
+    float getSubStepBudget() const;
+
+    /**
+     * Sets the time budget for simulation sub steps in a single frame, in milliseconds.
+     *
+     * When a budget is set, the number of sub steps performed each frame is limited to
+     * the number that fit in the budget, based on the measured cost of recent sub steps.
+     * At least one sub step is always performed when a full step of time has accumulated.
+     * Zero (the default) disables the budget.
+     *
+     * @param budget The sub step time budget, in milliseconds.
+     */
+    void setSubStepBudget(float budget);
+
+    /**
+     * Gets the number of simulation sub steps performed during the last frame.
+     *
+     * @return The number of sub steps.
+     */
+    unsigned int getSubStepCount() const;
+
+    /**
+     * Gets the time spent advancing the simulation during the last frame, in milliseconds.
+     *
+     * @return The simulation time.
+     */
+    float getStepTime() const;
+
+    /**
+     * Gets the simulation time that was dropped during the last frame because the
+     * sub step limit or budget was reached, in milliseconds.
+     *
+     * @return The dropped simulation time.
+     */
+    float getDroppedTime() const;
+
+    /**
+     * Gets the number of rigid bodies whose transforms were written to their nodes during the last frame.
+     *
+     * Only bodies that are active and whose nodes are not already at their transform are synchronized.
+     *
+     * @return The number of synchronized rigid bodies.
+     */
+    unsigned int getSyncedBodyCount() const;
+
+    /**
+     * Gets the number of rigid bodies that were not synchronized to their nodes
+     * during the last frame because they are sleeping, static or did not move.
+     *
+     * @return The number of skipped rigid bodies.
+     */
+    unsigned int getSkippedBodyCount() const;
+
     /**
      * Draws debugging information (rigid body outlines, etc.) using the given view projection matrix.
      * 
@@ -547,6 +644,15 @@ private:
     Listener::EventType _status;
     std::vector<Listener*>* _listeners;
     Vector3 _gravity;
+    float _fixedTimeStep;
+    unsigned int _maxSubSteps;
+    float _subStepBudget;
+    float _subStepCost;
+    unsigned int _subStepCount;
+    float _stepTime;
+    float _droppedTime;
+    unsigned int _rigidBodyCount;
+    unsigned int _syncedBodyCount;
     std::map<PhysicsCollisionObject::CollisionPair, CollisionInfo> _collisionStatus;
     CollisionCallback* _collisionCallback;
 };
@@ -0,0 +1,206 @@
+#include "Base.h"
+#include "PoolAllocator.h"
+#include "Atomic.h"
+
+// Elements are aligned to this many bytes, which is enough for SIMD math types.
+#define POOL_ALIGNMENT 16
+
+namespace gameplay
+{
+
+// Linked list of all pool allocators, and the lock guarding it.
+static PoolAllocator* __allocators = NULL;
+static volatile long __allocatorsLock = 0;
+
+PoolAllocator::PoolAllocator(const char* name, size_t elementSize, unsigned int chunkSize)
+    : _name(name ? name : ""), _elementSize(0), _chunkSize(std::max(chunkSize, 1u)), _free(NULL),
+      _allocationCount(0), _totalAllocationCount(0), _next(NULL), _owner(NULL), _lock(0)
+{
+    // Free elements hold the pointer to the next free element.
+    _elementSize = std::max(elementSize, sizeof(void*));
+    _elementSize = (_elementSize + POOL_ALIGNMENT - 1) & ~(size_t)(POOL_ALIGNMENT - 1);
+
+    spinLock(&__allocatorsLock);
+    _next = __allocators;
+    __allocators = this;
+    spinUnlock(&__allocatorsLock);
+}
+
+PoolAllocator::~PoolAllocator()
+{
+    spinLock(&__allocatorsLock);
+    for (PoolAllocator** allocator = &__allocators; *allocator; allocator = &(*allocator)->_next)
+    {
+        if (*allocator == this)
+        {
+            *allocator = _next;
+            break;
+        }
+    }
+    spinUnlock(&__allocatorsLock);
+
+    // Objects that are still alive (such as those leaked at exit) keep their memory.
+    if (_allocationCount == 0)
+    {
+        for (size_t i = 0, count = _chunks.size(); i < count; ++i)
+        {
+            SAFE_DELETE_ARRAY(_chunks[i]);
+        }
+        _chunks.clear();
+        _free = NULL;
+    }
+}
+
+PoolAllocator* PoolAllocator::get(PoolAllocator** allocator, const char* name, size_t elementSize, unsigned int chunkSize)
+{
+    GP_ASSERT(allocator);
+
+    if (*allocator == NULL)
+    {
+        // Objects may be created on several threads, so the first ones must not race to create the allocator.
+        static volatile long createLock = 0;
+        spinLock(&createLock);
+        if (*allocator == NULL)
+        {
+            PoolAllocator* created = new PoolAllocator(name, elementSize, chunkSize);
+            created->_owner = allocator;
+            atomicExchangePointer((void* volatile*)allocator, created);
+        }
+        spinUnlock(&createLock);
+    }
+    return *allocator;
+}
+
+void PoolAllocator::finalize()
+{
+    spinLock(&__allocatorsLock);
+    PoolAllocator* allocators = __allocators;
+    spinUnlock(&__allocatorsLock);
+
+    PoolAllocator* allocator = allocators;
+    while (allocator)
+    {
+        PoolAllocator* next = allocator->_next;
+        if (allocator->_owner)
+        {
+            // Allocators of objects that are still alive are kept so the objects can still be deleted.
+            if (allocator->_allocationCount == 0)
+            {
+                *allocator->_owner = NULL;
+                delete allocator;
+            }
+            else
+            {
+                GP_WARN("%u %s objects are still allocated at shutdown.", allocator->_allocationCount, allocator->_name);
+            }
+        }
+        allocator = next;
+    }
+}
+
+void PoolAllocator::grow()
+{
+    char* chunk = new char[_elementSize * _chunkSize];
+    _chunks.push_back(chunk);
+
+    // Link the elements so they are handed out in address order.
+    for (unsigned int i = _chunkSize; i > 0; --i)
+    {
+        void* element = chunk + (i - 1) * _elementSize;
+        *(void**)element = _free;
+        _free = element;
+    }
+}
+
+void* PoolAllocator::allocate(size_t size)
+{
+    spinLock(&_lock);
+    ++_totalAllocationCount;
+    if (size > _elementSize)
+    {
+        spinUnlock(&_lock);
+        void* p = malloc(size);
+        GP_ASSERT(p);
+        return p;
+    }
+
+    if (_free == NULL)
+        grow();
+
+    void* p = _free;
+    _free = *(void**)p;
+    ++_allocationCount;
+    spinUnlock(&_lock);
+    return p;
+}
+
+void PoolAllocator::deallocate(void* p, size_t size)
+{
+    if (p == NULL)
+        return;
+
+    if (size > _elementSize)
+    {
+        free(p);
+        return;
+    }
+
+    spinLock(&_lock);
+    GP_ASSERT(_allocationCount > 0);
+    *(void**)p = _free;
+    _free = p;
+    --_allocationCount;
+    spinUnlock(&_lock);
+}
+
+const char* PoolAllocator::getName() const
+{
+    return _name;
+}
+
+size_t PoolAllocator::getElementSize() const
+{
+    return _elementSize;
+}
+
+unsigned int PoolAllocator::getAllocationCount() const
+{
+    return _allocationCount;
+}
+
+unsigned int PoolAllocator::getTotalAllocationCount() const
+{
+    return _totalAllocationCount;
+}
+
+unsigned int PoolAllocator::getCapacity() const
+{
+    return (unsigned int)_chunks.size() * _chunkSize;
+}
+
+unsigned int PoolAllocator::getAllocatorCount()
+{
+    unsigned int count = 0;
+    spinLock(&__allocatorsLock);
+    for (PoolAllocator* allocator = __allocators; allocator; allocator = allocator->_next)
+    {
+        ++count;
+    }
+    spinUnlock(&__allocatorsLock);
+    return count;
+}
+
+PoolAllocator* PoolAllocator::getAllocator(unsigned int index)
+{
+    PoolAllocator* allocator;
+    spinLock(&__allocatorsLock);
+    for (allocator = __allocators; allocator; allocator = allocator->_next)
+    {
+        if (index-- == 0)
+            break;
+    }
+    spinUnlock(&__allocatorsLock);
+    return allocator;
+}
+
+}
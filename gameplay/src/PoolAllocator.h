@@ -0,0 +1,165 @@
+#ifndef POOLALLOCATOR_H_
+#define POOLALLOCATOR_H_
+
+namespace gameplay
+{
+
+/**
+ * Defines an allocator for many small objects of the same size.
+ *
+ * Memory is allocated from the heap in chunks that each hold a fixed number of
+ * elements. Freed elements are kept on a free list and reused by later allocations,
+ * so creating and destroying objects rarely calls the heap, and objects of the same
+ * type stay close together in memory. Chunks are kept until the allocator is destroyed.
+ *
+ * Allocations larger than the element size, such as those made for a derived class
+ * through an inherited operator new, are passed on to the heap.
+ *
+ * Allocating and freeing take a spin lock, so elements may be allocated and freed
+ * on any thread.
+ *
+ * @script{ignore}
+ */
+class PoolAllocator
+{
+    friend class Game;
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param name The name of the allocator, usually the type it allocates.
+     * @param elementSize The size of each element in bytes.
+     * @param chunkSize The number of elements in each chunk.
+     */
+    PoolAllocator(const char* name, size_t elementSize, unsigned int chunkSize = 256);
+
+    /**
+     * Destructor.
+     *
+     * Chunks that still hold allocated elements are not freed.
+     */
+    ~PoolAllocator();
+
+    /**
+     * Returns the allocator stored in the given pointer, creating it the first time.
+     *
+     * Allocators created this way are destroyed when the game shuts down if none of
+     * their elements are still allocated, which sets the pointer back to NULL. This
+     * avoids depending on the order in which file statics are destroyed.
+     *
+     * @param allocator The pointer to the allocator, usually a file static of the allocated type.
+     * @param name The name of the allocator, usually the type it allocates.
+     * @param elementSize The size of each element in bytes.
+     * @param chunkSize The number of elements in each chunk.
+     *
+     * @return The allocator.
+     */
+    static PoolAllocator* get(PoolAllocator** allocator, const char* name, size_t elementSize, unsigned int chunkSize = 256);
+
+    /**
+     * Allocates memory for one element.
+     *
+     * @param size The size of the allocation in bytes.
+     *
+     * @return The allocated memory.
+     */
+    void* allocate(size_t size);
+
+    /**
+     * Frees memory allocated with allocate().
+     *
+     * @param p The memory to free. May be NULL.
+     * @param size The size that was passed to allocate().
+     */
+    void deallocate(void* p, size_t size);
+
+    /**
+     * Returns the name of the allocator.
+     *
+     * @return The name of the allocator.
+     */
+    const char* getName() const;
+
+    /**
+     * Returns the size of each element in bytes.
+     *
+     * @return The element size.
+     */
+    size_t getElementSize() const;
+
+    /**
+     * Returns the number of elements that are currently allocated.
+     *
+     * @return The number of allocated elements.
+     */
+    unsigned int getAllocationCount() const;
+
+    /**
+     * Returns the total number of allocations made, including those passed on to the heap.
+     *
+     * @return The total number of allocations.
+     */
+    unsigned int getTotalAllocationCount() const;
+
+    /**
+     * Returns the number of elements that fit in the chunks allocated so far.
+     *
+     * @return The capacity in elements.
+     */
+    unsigned int getCapacity() const;
+
+    /**
+     * Returns the number of pool allocators.
+     *
+     * @return The number of pool allocators.
+     */
+    static unsigned int getAllocatorCount();
+
+    /**
+     * Returns the pool allocator at the given index.
+     *
+     * @param index The index of the allocator.
+     *
+     * @return The pool allocator, or NULL if index is out of range.
+     */
+    static PoolAllocator* getAllocator(unsigned int index);
+
+private:
+
+    /**
+     * Hidden copy constructor.
+     */
+    PoolAllocator(const PoolAllocator& copy);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    PoolAllocator& operator=(const PoolAllocator&);
+
+    /**
+     * Allocates a new chunk and adds its elements to the free list.
+     */
+    void grow();
+
+    /**
+     * Destroys the allocators created with get() that have no allocated elements.
+     */
+    static void finalize();
+
+    const char* _name;
+    size_t _elementSize;
+    unsigned int _chunkSize;
+    std::vector<char*> _chunks;
+    void* _free;
+    unsigned int _allocationCount;
+    unsigned int _totalAllocationCount;
+    PoolAllocator* _next;
+    PoolAllocator** _owner;
+    volatile long _lock;
+};
+
+}
+
+#endif
@@ -1,11 +1,36 @@
 #include "Base.h"
 #include "Properties.h"
 #include "FileSystem.h"
+#include "BufferedStream.h"
 #include "Quaternion.h"
 
+// Minimum version of the compiled properties format that can be loaded.
+#define PROPERTIES_VERSION_MAJOR_REQUIRED 1
+#define PROPERTIES_VERSION_MINOR_REQUIRED 0
+
+// Number count stored for values that are not parsed ahead of time, such as variable references.
+#define PROPERTIES_NUMBERS_UNPARSED 0xFF
+
+// Maximum number of numbers stored for a value (a matrix).
+#define PROPERTIES_NUMBERS_MAX 16
+
 namespace gameplay
 {
 
+/**
+ * Hashes a property name (32-bit FNV-1a).
+ */
+static unsigned int hashName(const char* name)
+{
+    unsigned int hash = 2166136261u;
+    while (*name)
+    {
+        hash ^= (unsigned char)*name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
 /**
  * Reads the next character from the stream. Returns EOF if the end of the stream is reached.
  */
@@ -25,13 +50,18 @@ void calculateNamespacePath(const std::string& urlString, std::string& fileStrin
 /** @script{ignore} */
 Properties* getPropertiesFromNamespacePath(Properties* properties, const std::vector<std::string>& namespacePath);
 
+Properties::Property::Property(const char* name, const char* value)
+    : name(name), value(value), hash(hashName(name)), parsed(false)
+{
+}
+
 Properties::Properties()
-    : _variables(NULL), _dirPath(NULL), _parent(NULL)
+    : _variables(NULL), _dirPath(NULL), _parent(NULL), _namespaceIndex(NULL)
 {
 }
 
 Properties::Properties(const Properties& copy)
-    : _namespace(copy._namespace), _id(copy._id), _parentID(copy._parentID), _properties(copy._properties), _variables(NULL), _dirPath(NULL), _parent(copy._parent)
+    : _namespace(copy._namespace), _id(copy._id), _parentID(copy._parentID), _properties(copy._properties), _variables(NULL), _dirPath(NULL), _parent(copy._parent), _namespaceIndex(NULL)
 {
     setDirectoryPath(copy._dirPath);
     _namespaces = std::vector<Properties*>();
@@ -45,14 +75,14 @@ Properties::Properties(const Properties& copy)
 }
 
 Properties::Properties(Stream* stream)
-    : _variables(NULL), _dirPath(NULL), _parent(NULL)
+    : _variables(NULL), _dirPath(NULL), _parent(NULL), _namespaceIndex(NULL)
 {
     readProperties(stream);
     rewind();
 }
 
 Properties::Properties(Stream* stream, const char* name, const char* id, const char* parentID, Properties* parent)
-    : _namespace(name), _variables(NULL), _dirPath(NULL), _parent(parent)
+    : _namespace(name), _variables(NULL), _dirPath(NULL), _parent(parent), _namespaceIndex(NULL)
 {
     if (id)
     {
@@ -80,15 +110,37 @@ Properties* Properties::create(const char* url)
     std::vector<std::string> namespacePath;
     calculateNamespacePath(urlString, fileString, namespacePath);
 
-    std::auto_ptr<Stream> stream(FileSystem::open(fileString.c_str()));
+    // The parser reads a character at a time and seeks back often, so it reads through a buffer.
+    std::auto_ptr<Stream> stream(BufferedStream::create(FileSystem::open(fileString.c_str())));
     if (stream.get() == NULL)
     {
         GP_WARN("Failed to open file '%s'.", fileString.c_str());
         return NULL;
     }
 
-    Properties* properties = new Properties(stream.get());
-    properties->resolveInheritance();
+    Properties* properties;
+    char sig[9];
+    if (stream->read(sig, 1, 9) == 9 && memcmp(sig, "\xABGPP\xBB\r\n\x1A\n", 9) == 0)
+    {
+        // Compiled files are written with their inheritance already resolved.
+        properties = new Properties();
+        if (!properties->readCompiledProperties(stream.get()))
+        {
+            GP_WARN("Failed to load compiled properties file '%s'.", fileString.c_str());
+            SAFE_DELETE(properties);
+            return NULL;
+        }
+    }
+    else
+    {
+        if (stream->rewind() == false)
+        {
+            GP_WARN("Failed to rewind properties file '%s'.", fileString.c_str());
+            return NULL;
+        }
+        properties = new Properties(stream.get());
+        properties->resolveInheritance();
+    }
     stream->close();
 
     // Get the specified properties object.
@@ -378,6 +430,160 @@ void Properties::readProperties(Stream* stream)
     }
 }
 
+static bool readCompiledString(Stream* stream, const std::vector<std::string>& strings, const std::string** str)
+{
+    unsigned int index;
+    if (stream->read(&index, 4, 1) != 1 || index >= strings.size())
+        return false;
+    *str = &strings[index];
+    return true;
+}
+
+bool Properties::readCompiledProperties(Stream* stream)
+{
+    GP_ASSERT(stream);
+
+    unsigned char version[2];
+    if (stream->read(version, 1, 2) != 2)
+    {
+        GP_WARN("Failed to read compiled properties version.");
+        return false;
+    }
+    if (version[0] != PROPERTIES_VERSION_MAJOR_REQUIRED || version[1] < PROPERTIES_VERSION_MINOR_REQUIRED)
+    {
+        GP_WARN("Unsupported compiled properties version (%d.%d) (expected %d.%d).", (int)version[0], (int)version[1], PROPERTIES_VERSION_MAJOR_REQUIRED, PROPERTIES_VERSION_MINOR_REQUIRED);
+        return false;
+    }
+
+    // Read the string table, which holds every name, ID and value in the file.
+    unsigned int stringCount;
+    if (stream->read(&stringCount, 4, 1) != 1)
+    {
+        GP_WARN("Failed to read compiled properties string table.");
+        return false;
+    }
+    std::vector<std::string> strings(stringCount);
+    for (unsigned int i = 0; i < stringCount; ++i)
+    {
+        unsigned int length;
+        if (stream->read(&length, 4, 1) != 1)
+        {
+            GP_WARN("Failed to read compiled properties string table.");
+            return false;
+        }
+        if (length > 0)
+        {
+            strings[i].resize(length);
+            if (stream->read(&strings[i][0], 1, length) != length)
+            {
+                GP_WARN("Failed to read compiled properties string table.");
+                return false;
+            }
+        }
+    }
+
+    return readCompiledNamespace(stream, strings);
+}
+
+bool Properties::readCompiledNamespace(Stream* stream, const std::vector<std::string>& strings)
+{
+    GP_ASSERT(stream);
+
+    const std::string* name;
+    const std::string* id;
+    const std::string* parentID;
+    if (!readCompiledString(stream, strings, &name) ||
+        !readCompiledString(stream, strings, &id) ||
+        !readCompiledString(stream, strings, &parentID))
+    {
+        GP_WARN("Failed to read compiled properties namespace.");
+        return false;
+    }
+    _namespace = *name;
+    _id = *id;
+    _parentID = *parentID;
+
+    // Read variables.
+    unsigned int count;
+    if (stream->read(&count, 4, 1) != 1)
+    {
+        GP_WARN("Failed to read compiled properties variables in namespace '%s'.", _namespace.c_str());
+        return false;
+    }
+    if (count > 0)
+    {
+        _variables = new std::vector<Property>();
+        _variables->reserve(count);
+    }
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        const std::string* value;
+        if (!readCompiledString(stream, strings, &name) || !readCompiledString(stream, strings, &value))
+        {
+            GP_WARN("Failed to read compiled properties variables in namespace '%s'.", _namespace.c_str());
+            return false;
+        }
+        _variables->push_back(Property(name->c_str(), value->c_str()));
+    }
+
+    // Read properties along with their pre-parsed numbers.
+    if (stream->read(&count, 4, 1) != 1)
+    {
+        GP_WARN("Failed to read compiled properties in namespace '%s'.", _namespace.c_str());
+        return false;
+    }
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        const std::string* value;
+        unsigned char numberCount;
+        if (!readCompiledString(stream, strings, &name) || !readCompiledString(stream, strings, &value) ||
+            stream->read(&numberCount, 1, 1) != 1)
+        {
+            GP_WARN("Failed to read compiled properties in namespace '%s'.", _namespace.c_str());
+            return false;
+        }
+        _properties.push_back(Property(name->c_str(), value->c_str()));
+        if (numberCount != PROPERTIES_NUMBERS_UNPARSED)
+        {
+            Property& prop = _properties.back();
+            prop.parsed = true;
+            if (numberCount > 0)
+            {
+                if (numberCount > PROPERTIES_NUMBERS_MAX)
+                {
+                    GP_WARN("Invalid number count (%d) for compiled property '%s'.", (int)numberCount, name->c_str());
+                    return false;
+                }
+                prop.numbers.resize(numberCount);
+                if (stream->read(&prop.numbers[0], 4, numberCount) != numberCount)
+                {
+                    GP_WARN("Failed to read compiled property '%s'.", name->c_str());
+                    return false;
+                }
+            }
+        }
+    }
+
+    // Read nested namespaces.
+    if (stream->read(&count, 4, 1) != 1)
+    {
+        GP_WARN("Failed to read compiled properties namespaces in namespace '%s'.", _namespace.c_str());
+        return false;
+    }
+    _namespaces.reserve(count);
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        Properties* space = new Properties();
+        space->_parent = this;
+        _namespaces.push_back(space);
+        if (!space->readCompiledNamespace(stream, strings))
+            return false;
+    }
+
+    rewind();
+    return true;
+}
+
 Properties::~Properties()
 {
     SAFE_DELETE(_dirPath);
@@ -387,6 +593,7 @@ Properties::~Properties()
     }
 
     SAFE_DELETE(_variables);
+    SAFE_DELETE(_namespaceIndex);
 }
 
 void Properties::skipWhiteSpace(Stream* stream)
@@ -448,7 +655,7 @@ void Properties::resolveInheritance(const char* id)
     Properties* derived;
     if (id)
     {
-        derived = getNamespace(id);
+        derived = findNamespace(id, false, true);
     }
     else
     {
@@ -459,7 +666,7 @@ void Properties::resolveInheritance(const char* id)
         // If the namespace has a parent ID, find the parent.
         if (!derived->_parentID.empty())
         {
-            Properties* parent = getNamespace(derived->_parentID.c_str());
+            Properties* parent = findNamespace(derived->_parentID.c_str(), false, true);
             if (parent)
             {
                 resolveInheritance(parent->getId());
@@ -601,6 +808,25 @@ Properties* Properties::getNamespace(const char* id, bool searchNames, bool recu
 {
     GP_ASSERT(id);
 
+    // Namespaces don't change once loaded, so recursive searches by ID use an index built on first use.
+    if (!searchNames && recurse)
+    {
+        if (_namespaceIndex == NULL)
+        {
+            _namespaceIndex = new std::map<std::string, Properties*>();
+            buildNamespaceIndex(_namespaceIndex);
+        }
+        std::map<std::string, Properties*>::const_iterator itr = _namespaceIndex->find(id);
+        return itr != _namespaceIndex->end() ? itr->second : NULL;
+    }
+
+    return findNamespace(id, searchNames, recurse);
+}
+
+Properties* Properties::findNamespace(const char* id, bool searchNames, bool recurse) const
+{
+    GP_ASSERT(id);
+
     for (std::vector<Properties*>::const_iterator it = _namespaces.begin(); it < _namespaces.end(); ++it)
     {
         Properties* p = *it;
@@ -610,7 +836,7 @@ Properties* Properties::getNamespace(const char* id, bool searchNames, bool recu
         if (recurse)
         {
             // Search recursively.
-            p = p->getNamespace(id, searchNames, true);
+            p = p->findNamespace(id, searchNames, true);
             if (p)
                 return p;
         }
@@ -619,6 +845,20 @@ Properties* Properties::getNamespace(const char* id, bool searchNames, bool recu
     return NULL;
 }
 
+void Properties::buildNamespaceIndex(std::map<std::string, Properties*>* index) const
+{
+    GP_ASSERT(index);
+
+    // Namespaces are added in the same depth-first order that findNamespace() searches,
+    // and insert() keeps the first namespace added for each ID.
+    for (std::vector<Properties*>::const_iterator it = _namespaces.begin(); it < _namespaces.end(); ++it)
+    {
+        Properties* p = *it;
+        index->insert(std::make_pair(p->_id, p));
+        p->buildNamespaceIndex(index);
+    }
+}
+
 const char* Properties::getNamespace() const
 {
     return _namespace.c_str();
@@ -634,13 +874,7 @@ bool Properties::exists(const char* name) const
     if (name == NULL)
         return false;
 
-    for (std::list<Property>::const_iterator itr = _properties.begin(); itr != _properties.end(); ++itr)
-    {
-        if (itr->name == name)
-            return true;
-    }
-
-    return false;
+    return findProperty(name) != NULL;
 }
 
 static const bool isStringNumeric(const char* str)
@@ -724,13 +958,10 @@ const char* Properties::getString(const char* name, const char* defaultValue) co
             return getVariable(variable, defaultValue);
         }
 
-        for (std::list<Property>::const_iterator itr = _properties.begin(); itr != _properties.end(); ++itr)
+        const Property* prop = findProperty(name);
+        if (prop)
         {
-            if (itr->name == name)
-            {
-                value = itr->value.c_str();
-                break;
-            }
+            value = prop->value.c_str();
         }
     }
     else
@@ -758,12 +989,15 @@ bool Properties::setString(const char* name, const char* value)
 {
     if (name)
     {
+        unsigned int hash = hashName(name);
         for (std::list<Property>::iterator itr = _properties.begin(); itr != _properties.end(); ++itr)
         {
-            if (itr->name == name)
+            if (itr->hash == hash && itr->name == name)
             {
                 // Update the first property that matches this name
                 itr->value = value ? value : "";
+                itr->numbers.clear();
+                itr->parsed = false;
                 return true;
             }
         }
@@ -778,6 +1012,8 @@ bool Properties::setString(const char* name, const char* value)
             return false;
 
         _propertiesItr->value = value ? value : "";
+        _propertiesItr->numbers.clear();
+        _propertiesItr->parsed = false;
     }
 
     return true;
@@ -815,6 +1051,12 @@ int Properties::getInt(const char* name) const
 
 float Properties::getFloat(const char* name) const
 {
+    const float* numbers = getNumbers(name, 1);
+    if (numbers)
+    {
+        return numbers[0];
+    }
+
     const char* valueString = getString(name);
     if (valueString)
     {
@@ -855,6 +1097,13 @@ bool Properties::getMatrix(const char* name, Matrix* out) const
 {
     GP_ASSERT(out);
 
+    const float* numbers = getNumbers(name, 16);
+    if (numbers)
+    {
+        out->set(numbers);
+        return true;
+    }
+
     const char* valueString = getString(name);
     if (valueString)
     {
@@ -881,21 +1130,53 @@ bool Properties::getMatrix(const char* name, Matrix* out) const
 
 bool Properties::getVector2(const char* name, Vector2* out) const
 {
+    const float* numbers = getNumbers(name, 2);
+    if (numbers)
+    {
+        if (out)
+            out->set(numbers);
+        return true;
+    }
+
     return parseVector2(getString(name), out);
 }
 
 bool Properties::getVector3(const char* name, Vector3* out) const
 {
+    const float* numbers = getNumbers(name, 3);
+    if (numbers)
+    {
+        if (out)
+            out->set(numbers);
+        return true;
+    }
+
     return parseVector3(getString(name), out);
 }
 
 bool Properties::getVector4(const char* name, Vector4* out) const
 {
+    const float* numbers = getNumbers(name, 4);
+    if (numbers)
+    {
+        if (out)
+            out->set(numbers);
+        return true;
+    }
+
     return parseVector4(getString(name), out);
 }
 
 bool Properties::getQuaternionFromAxisAngle(const char* name, Quaternion* out) const
 {
+    const float* numbers = getNumbers(name, 4);
+    if (numbers)
+    {
+        if (out)
+            out->set(Vector3(numbers[0], numbers[1], numbers[2]), MATH_DEG_TO_RAD(numbers[3]));
+        return true;
+    }
+
     return parseAxisAngle(getString(name), out);
 }
 
@@ -1050,6 +1331,74 @@ void Properties::setDirectoryPath(const std::string& path)
     }
 }
 
+const Properties::Property* Properties::getProperty(const char* name) const
+{
+    if (name)
+    {
+        // Variables are not stored as properties.
+        char variable[256];
+        if (isVariable(name, variable, 256))
+            return NULL;
+
+        return findProperty(name);
+    }
+
+    // No name provided - get the property at the current iterator position
+    return _propertiesItr != _properties.end() ? &(*_propertiesItr) : NULL;
+}
+
+const Properties::Property* Properties::findProperty(const char* name) const
+{
+    GP_ASSERT(name);
+
+    // Namespaces hold few properties, so a scan that compares hashes first beats maintaining a table.
+    unsigned int hash = hashName(name);
+    for (std::list<Property>::const_iterator itr = _properties.begin(); itr != _properties.end(); ++itr)
+    {
+        if (itr->hash == hash && itr->name == name)
+            return &(*itr);
+    }
+    return NULL;
+}
+
+/**
+ * Parses the comma-separated numbers at the start of a value, accepting the same
+ * input as the sscanf("%f,%f,...") calls in the parse functions below.
+ */
+static void parseNumbers(const char* str, std::vector<float>* numbers)
+{
+    float value;
+    int length;
+    while (numbers->size() < PROPERTIES_NUMBERS_MAX && sscanf(str, "%f%n", &value, &length) == 1)
+    {
+        numbers->push_back(value);
+        str += length;
+        if (*str != ',')
+            break;
+        ++str;
+    }
+}
+
+const float* Properties::getNumbers(const char* name, unsigned int count) const
+{
+    const Property* prop = getProperty(name);
+    if (prop == NULL)
+        return NULL;
+
+    if (!prop->parsed)
+    {
+        // Values that reference a variable are looked up on every get, so they are not cached.
+        char variable[256];
+        if (isVariable(prop->value.c_str(), variable, 256))
+            return NULL;
+
+        parseNumbers(prop->value.c_str(), &prop->numbers);
+        prop->parsed = true;
+    }
+
+    return prop->numbers.size() >= count ? &prop->numbers[0] : NULL;
+}
+
 void calculateNamespacePath(const std::string& urlString, std::string& fileString, std::vector<std::string>& namespacePath)
 {
     // If the url references a specific namespace within the file,
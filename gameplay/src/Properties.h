@@ -122,6 +122,12 @@ class Properties;
  * modified to do so.  Also note that nothing in a properties file indicates the type
  * of a property. If the type is unknown, its string can be retrieved and interpreted
  * as necessary.
+ *
+ * Properties files can also be compiled to a binary format with gameplay-encoder.
+ * A compiled file stores its strings in a single table, its numeric values already
+ * parsed and its namespace inheritance already resolved, so it loads without any text
+ * parsing. Properties::create() detects compiled files by their header, so a compiled
+ * file can replace its text version under the same name.
  */
 class Properties
 {
@@ -515,7 +521,12 @@ private:
     {
         std::string name;
         std::string value;
-        Property(const char* name, const char* value) : name(name), value(value) { }
+        // Hash of the name, compared before the name itself during lookups.
+        unsigned int hash;
+        // The comma-separated numbers at the start of the value, parsed on first use.
+        mutable std::vector<float> numbers;
+        mutable bool parsed;
+        Property(const char* name, const char* value);
     };
 
     /**
@@ -538,6 +549,11 @@ private:
 
     void readProperties(Stream* stream);
 
+    // Reads a compiled properties file, starting after its identifier.
+    bool readCompiledProperties(Stream* stream);
+
+    bool readCompiledNamespace(Stream* stream, const std::vector<std::string>& strings);
+
     void skipWhiteSpace(Stream* stream);
 
     char* trimWhiteSpace(char* str);
@@ -554,6 +570,20 @@ private:
     void setDirectoryPath(const std::string* path);
     void setDirectoryPath(const std::string& path);
 
+    // Gets the property with the given name, or the current property if name is NULL.
+    const Property* getProperty(const char* name) const;
+
+    // Gets the first property with the given name.
+    const Property* findProperty(const char* name) const;
+
+    // Gets at least count numbers from the start of a property's value, parsing and caching them on first use.
+    const float* getNumbers(const char* name, unsigned int count) const;
+
+    // Searches for a namespace without using the namespace index, which is only valid once loading is complete.
+    Properties* findNamespace(const char* id, bool searchNames, bool recurse) const;
+
+    void buildNamespaceIndex(std::map<std::string, Properties*>* index) const;
+
     std::string _namespace;
     std::string _id;
     std::string _parentID;
@@ -564,6 +594,7 @@ private:
     std::vector<Property>* _variables;
     std::string* _dirPath;
     Properties* _parent;
+    mutable std::map<std::string, Properties*>* _namespaceIndex;
 };
 
 }
@@ -1,6 +1,8 @@
 #include "Base.h"
 #include "Ref.h"
 #include "Game.h"
+#include "ScriptController.h"
+#include "Atomic.h"
 
 namespace gameplay
 {
@@ -28,6 +30,7 @@ Ref::Ref(const Ref& copy) :
 
 Ref::~Ref()
 {
+    ScriptController::removeUserdata(this);
 }
 
 void Ref::addRef()
@@ -62,6 +65,7 @@ struct RefAllocationRecord
 
 RefAllocationRecord* __refAllocations = 0;
 int __refAllocationCount = 0;
+static volatile long __refAllocationLock = 0;
 
 void Ref::printLeaks()
 {
@@ -90,6 +94,8 @@ void* trackRef(Ref* ref)
     // Create memory allocation record.
     RefAllocationRecord* rec = (RefAllocationRecord*)malloc(sizeof(RefAllocationRecord));
     rec->ref = ref;
+
+    spinLock(&__refAllocationLock);
     rec->next = __refAllocations;
     rec->prev = 0;
 
@@ -97,6 +103,7 @@ void* trackRef(Ref* ref)
         __refAllocations->prev = rec;
     __refAllocations = rec;
     ++__refAllocationCount;
+    spinUnlock(&__refAllocationLock);
 
     return rec;
 }
@@ -117,14 +124,16 @@ void untrackRef(Ref* ref, void* record)
     }
 
     // Link this item out.
+    spinLock(&__refAllocationLock);
     if (__refAllocations == rec)
         __refAllocations = rec->next;
     if (rec->prev)
         rec->prev->next = rec->next;
     if (rec->next)
         rec->next->prev = rec->prev;
-    free((void*)rec);
     --__refAllocationCount;
+    spinUnlock(&__refAllocationLock);
+    free((void*)rec);
 }
 
 #endif
@@ -33,6 +33,9 @@ public:
      * Calling addRef() will increment the reference and calling release()
      * will decrement the reference count. When an object reaches a
      * reference count of zero, the object is destroyed.
+     *
+     * Destroying an object removes it from the script userdata cache, so the
+     * last reference must be released on the main thread while scripting is active.
      */
     void release();
 
@@ -0,0 +1,348 @@
+#include "Base.h"
+#include "ResourceCache.h"
+#include "Game.h"
+
+namespace gameplay
+{
+
+// Linked list of all resource caches. This is a plain pointer, so it is initialized
+// before any cache is constructed.
+static ResourceCache* __caches = NULL;
+
+static size_t __memoryBudget = 0;
+static unsigned int __useCount = 0;
+static float __logInterval = 0.0f;
+static float __logTime = 0.0f;
+
+/**
+ * Hashes a resource key (32-bit FNV-1a).
+ */
+static unsigned int hashKey(const char* key)
+{
+    unsigned int hash = 2166136261u;
+    while (*key)
+    {
+        hash ^= (unsigned char)*key++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+ResourceCache::ResourceCache(const char* type)
+    : _type(type ? type : ""), _gpuMemoryUsage(0), _cpuMemoryUsage(0), _next(__caches), _owner(NULL)
+{
+    __caches = this;
+}
+
+ResourceCache::~ResourceCache()
+{
+    for (ResourceCache** cache = &__caches; *cache; cache = &(*cache)->_next)
+    {
+        if (*cache == this)
+        {
+            *cache = _next;
+            break;
+        }
+    }
+}
+
+ResourceCache* ResourceCache::get(ResourceCache** cache, const char* type)
+{
+    GP_ASSERT(cache);
+
+    if (*cache == NULL)
+    {
+        *cache = new ResourceCache(type);
+        (*cache)->_owner = cache;
+    }
+    return *cache;
+}
+
+Ref* ResourceCache::find(const char* key, unsigned int index)
+{
+    GP_ASSERT(key);
+
+    std::pair<EntryMap::iterator, EntryMap::iterator> range = _entries.equal_range(hashKey(key));
+    for (EntryMap::iterator itr = range.first; itr != range.second; ++itr)
+    {
+        if (itr->second.key == key && index-- == 0)
+            return itr->second.resource;
+    }
+    return NULL;
+}
+
+void ResourceCache::add(const char* key, Ref* resource, size_t gpuMemoryUsage, size_t cpuMemoryUsage)
+{
+    GP_ASSERT(key);
+    GP_ASSERT(resource);
+
+    if (_resources.find(resource) != _resources.end())
+    {
+        GP_WARN("Resource '%s' is already in the %s cache.", key, _type.c_str());
+        return;
+    }
+
+    Entry entry;
+    entry.key = key;
+    entry.resource = resource;
+    entry.gpuMemoryUsage = gpuMemoryUsage;
+    entry.cpuMemoryUsage = cpuMemoryUsage;
+    entry.lastUsed = 0;
+    entry.retained = false;
+    EntryMap::iterator itr = _entries.insert(std::make_pair(hashKey(key), entry));
+    _resources[resource] = itr;
+    _gpuMemoryUsage += gpuMemoryUsage;
+    _cpuMemoryUsage += cpuMemoryUsage;
+
+    use(itr->second);
+    trim();
+}
+
+void ResourceCache::remove(Ref* resource)
+{
+    std::map<Ref*, EntryMap::iterator>::iterator itr = _resources.find(resource);
+    if (itr != _resources.end())
+    {
+        const Entry& entry = itr->second->second;
+        _gpuMemoryUsage -= entry.gpuMemoryUsage;
+        _cpuMemoryUsage -= entry.cpuMemoryUsage;
+        _entries.erase(itr->second);
+        _resources.erase(itr);
+    }
+}
+
+void ResourceCache::use(Ref* resource)
+{
+    GP_ASSERT(resource);
+
+    std::map<Ref*, EntryMap::iterator>::iterator itr = _resources.find(resource);
+    GP_ASSERT(itr != _resources.end());
+    if (itr != _resources.end())
+        use(itr->second->second);
+}
+
+void ResourceCache::use(Entry& entry)
+{
+    entry.lastUsed = ++__useCount;
+    if (__memoryBudget != 0 && !entry.retained)
+    {
+        entry.resource->addRef();
+        entry.retained = true;
+    }
+}
+
+void ResourceCache::getResources(std::vector<Ref*>& resources) const
+{
+    resources.reserve(resources.size() + _resources.size());
+    for (std::map<Ref*, EntryMap::iterator>::const_iterator itr = _resources.begin(); itr != _resources.end(); ++itr)
+    {
+        resources.push_back(itr->first);
+    }
+}
+
+const char* ResourceCache::getType() const
+{
+    return _type.c_str();
+}
+
+unsigned int ResourceCache::getResourceCount() const
+{
+    return (unsigned int)_resources.size();
+}
+
+unsigned int ResourceCache::getUnusedResourceCount() const
+{
+    unsigned int count = 0;
+    for (EntryMap::const_iterator itr = _entries.begin(); itr != _entries.end(); ++itr)
+    {
+        if (itr->second.retained && itr->second.resource->getRefCount() == 1)
+            ++count;
+    }
+    return count;
+}
+
+size_t ResourceCache::getMemoryUsage() const
+{
+    return _gpuMemoryUsage + _cpuMemoryUsage;
+}
+
+size_t ResourceCache::getGPUMemoryUsage() const
+{
+    return _gpuMemoryUsage;
+}
+
+size_t ResourceCache::getCPUMemoryUsage() const
+{
+    return _cpuMemoryUsage;
+}
+
+unsigned int ResourceCache::getCacheCount()
+{
+    unsigned int count = 0;
+    for (ResourceCache* cache = __caches; cache; cache = cache->_next)
+    {
+        ++count;
+    }
+    return count;
+}
+
+ResourceCache* ResourceCache::getCache(unsigned int index)
+{
+    for (ResourceCache* cache = __caches; cache; cache = cache->_next)
+    {
+        if (index-- == 0)
+            return cache;
+    }
+    return NULL;
+}
+
+size_t ResourceCache::getTotalMemoryUsage()
+{
+    size_t memoryUsage = 0;
+    for (ResourceCache* cache = __caches; cache; cache = cache->_next)
+    {
+        memoryUsage += cache->getMemoryUsage();
+    }
+    return memoryUsage;
+}
+
+void ResourceCache::setMemoryBudget(size_t budget)
+{
+    __memoryBudget = budget;
+    if (budget != 0)
+    {
+        trim();
+        return;
+    }
+
+    // Stop keeping resources loaded. Releasing a resource that is still in use
+    // only drops the reference held by its cache.
+    std::vector<Entry*> retained;
+    for (ResourceCache* cache = __caches; cache; cache = cache->_next)
+    {
+        for (EntryMap::iterator itr = cache->_entries.begin(); itr != cache->_entries.end(); ++itr)
+        {
+            if (itr->second.retained)
+                retained.push_back(&itr->second);
+        }
+    }
+    for (size_t i = 0, count = retained.size(); i < count; ++i)
+    {
+        Entry* entry = retained[i];
+        entry->retained = false;
+        entry->resource->release();
+    }
+}
+
+size_t ResourceCache::getMemoryBudget()
+{
+    return __memoryBudget;
+}
+
+void ResourceCache::trim()
+{
+    if (__memoryBudget != 0 && getTotalMemoryUsage() > __memoryBudget)
+    {
+        releaseUnused(__memoryBudget);
+    }
+}
+
+void ResourceCache::releaseUnused()
+{
+    releaseUnused((size_t)0);
+}
+
+void ResourceCache::releaseUnused(size_t budget)
+{
+    // Releasing a resource can leave another unused, such as the texture of a theme,
+    // so keep looking until nothing more is released.
+    bool released = true;
+    while (released)
+    {
+        released = false;
+
+        // An unused resource is one whose only reference is held by its cache.
+        std::vector<std::pair<unsigned int, Entry*> > unused;
+        for (ResourceCache* cache = __caches; cache; cache = cache->_next)
+        {
+            for (EntryMap::iterator itr = cache->_entries.begin(); itr != cache->_entries.end(); ++itr)
+            {
+                Entry& entry = itr->second;
+                if (entry.retained && entry.resource->getRefCount() == 1)
+                    unused.push_back(std::make_pair(entry.lastUsed, &entry));
+            }
+        }
+        std::sort(unused.begin(), unused.end());
+
+        for (size_t i = 0, count = unused.size(); i < count; ++i)
+        {
+            if (budget != 0 && getTotalMemoryUsage() <= budget)
+                return;
+
+            // Releasing the last reference destroys the resource, which removes its entry.
+            Entry* entry = unused[i].second;
+            entry->retained = false;
+            entry->resource->release();
+            released = true;
+        }
+    }
+}
+
+void ResourceCache::logMemoryUsage()
+{
+    Logger::log(Logger::LEVEL_INFO, "Resource memory usage: %u KB (budget %u KB)\n",
+        (unsigned int)(getTotalMemoryUsage() / 1024), (unsigned int)(__memoryBudget / 1024));
+    for (ResourceCache* cache = __caches; cache; cache = cache->_next)
+    {
+        Logger::log(Logger::LEVEL_INFO, "  %s: %u resources (%u unused), %u KB GPU, %u KB CPU\n",
+            cache->getType(), cache->getResourceCount(), cache->getUnusedResourceCount(),
+            (unsigned int)(cache->_gpuMemoryUsage / 1024), (unsigned int)(cache->_cpuMemoryUsage / 1024));
+    }
+}
+
+void ResourceCache::initialize()
+{
+    Properties* config = Game::getInstance()->getConfig()->getNamespace("resources", true);
+    if (config)
+    {
+        setMemoryBudget((size_t)(config->getFloat("memoryBudget") * 1048576.0f));
+        __logInterval = config->getFloat("logInterval") * 1000.0f;
+        __logTime = 0.0f;
+    }
+}
+
+void ResourceCache::finalize()
+{
+    setMemoryBudget(0);
+    __logInterval = 0.0f;
+
+    // Resources that are still loaded are no longer cached once their cache is destroyed.
+    ResourceCache* cache = __caches;
+    while (cache)
+    {
+        ResourceCache* next = cache->_next;
+        if (cache->_owner)
+        {
+            *cache->_owner = NULL;
+            delete cache;
+        }
+        cache = next;
+    }
+}
+
+void ResourceCache::updateInternal(float elapsedTime)
+{
+    trim();
+
+    if (__logInterval > 0.0f)
+    {
+        __logTime += elapsedTime;
+        if (__logTime >= __logInterval)
+        {
+            __logTime = 0.0f;
+            logMemoryUsage();
+        }
+    }
+}
+
+}
@@ -0,0 +1,291 @@
+#ifndef RESOURCECACHE_H_
+#define RESOURCECACHE_H_
+
+#include "Ref.h"
+
+namespace gameplay
+{
+
+/**
+ * Defines a cache of loaded resources of one type, keyed by the path they were loaded from.
+ *
+ * Keys are hashed, so a lookup only compares strings against resources whose key has
+ * the same hash, and each key is stored once in the cache no matter how often it is
+ * looked up. A resource removes itself from the cache when it is destroyed.
+ *
+ * Every cache keeps a count of its resources and an estimate of the GPU and CPU memory
+ * they use. The caches of all resource types can be enumerated with getCache() to report
+ * them, and logMemoryUsage() writes a summary to the log.
+ *
+ * By default a resource is destroyed as soon as its last reference is released. When a
+ * memory budget is set, the caches also hold a reference to each of their resources, so
+ * that resources which are no longer in use stay loaded and can be reused without being
+ * loaded again. Whenever the memory used by all caches exceeds the budget, unused resources
+ * are released, least recently used first, until it fits within the budget again.
+ *
+ * The budget and logging can be set in the game config:
+ *
+ * @verbatim
+    resources
+    {
+        // Memory budget in megabytes (0 releases resources as soon as they are unused)
+        memoryBudget = 128
+        // Seconds between logging the memory used by each resource type (0 to disable)
+        logInterval = 10
+    }
+   @endverbatim
+ *
+ * @script{ignore}
+ */
+class ResourceCache
+{
+    friend class Game;
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param type The name of the type of resource held by the cache, such as "Texture".
+     */
+    ResourceCache(const char* type);
+
+    /**
+     * Destructor.
+     */
+    ~ResourceCache();
+
+    /**
+     * Returns the cache stored in the given pointer, creating it the first time.
+     *
+     * Caches created this way are destroyed when the game shuts down, which sets the
+     * pointer back to NULL. Resources should check the pointer before removing themselves,
+     * since they can outlive their cache when they are held by static objects.
+     *
+     * @param cache The pointer to the cache, usually a file static of the resource type.
+     * @param type The name of the type of resource held by the cache, such as "Texture".
+     *
+     * @return The cache.
+     */
+    static ResourceCache* get(ResourceCache** cache, const char* type);
+
+    /**
+     * Returns a resource with the given key.
+     *
+     * Several resources may share a key, for example fonts of different sizes loaded
+     * from the same file. These are returned for increasing values of index.
+     *
+     * The resource is not marked as used, so that callers can search for a suitable
+     * resource; call use() on the resource that is returned to the application.
+     * The reference count of the returned resource is not incremented.
+     *
+     * @param key The key, usually the resolved path of the resource.
+     * @param index The index of the resource among those with the same key.
+     *
+     * @return The resource, or NULL if there are no more resources with the key.
+     */
+    Ref* find(const char* key, unsigned int index = 0);
+
+    /**
+     * Marks a resource as recently used.
+     *
+     * If there is a memory budget, the cache also holds a reference to the resource
+     * so that it stays loaded once it is no longer in use.
+     *
+     * @param resource The resource, which must be in the cache.
+     */
+    void use(Ref* resource);
+
+    /**
+     * Adds a resource to the cache.
+     *
+     * The resource must call remove() from its destructor.
+     *
+     * @param key The key, usually the resolved path of the resource.
+     * @param resource The resource to add.
+     * @param gpuMemoryUsage An estimate of the GPU memory used by the resource, in bytes.
+     * @param cpuMemoryUsage An estimate of the CPU memory used by the resource, in bytes.
+     */
+    void add(const char* key, Ref* resource, size_t gpuMemoryUsage = 0, size_t cpuMemoryUsage = 0);
+
+    /**
+     * Removes a resource from the cache, if it is in the cache.
+     *
+     * @param resource The resource to remove.
+     */
+    void remove(Ref* resource);
+
+    /**
+     * Gets all the resources in the cache.
+     *
+     * @param resources The vector to add the resources to.
+     */
+    void getResources(std::vector<Ref*>& resources) const;
+
+    /**
+     * Returns the name of the type of resource held by the cache.
+     *
+     * @return The type name.
+     */
+    const char* getType() const;
+
+    /**
+     * Returns the number of resources in the cache.
+     *
+     * @return The number of resources.
+     */
+    unsigned int getResourceCount() const;
+
+    /**
+     * Returns the number of resources that are only kept loaded by the cache.
+     *
+     * @return The number of unused resources.
+     */
+    unsigned int getUnusedResourceCount() const;
+
+    /**
+     * Returns the estimated GPU and CPU memory used by the resources in the cache.
+     *
+     * @return The memory usage in bytes.
+     */
+    size_t getMemoryUsage() const;
+
+    /**
+     * Returns the estimated GPU memory used by the resources in the cache.
+     *
+     * @return The GPU memory usage in bytes.
+     */
+    size_t getGPUMemoryUsage() const;
+
+    /**
+     * Returns the estimated CPU memory used by the resources in the cache.
+     *
+     * @return The CPU memory usage in bytes.
+     */
+    size_t getCPUMemoryUsage() const;
+
+    /**
+     * Returns the number of resource caches.
+     *
+     * @return The number of resource caches.
+     */
+    static unsigned int getCacheCount();
+
+    /**
+     * Returns the resource cache at the given index.
+     *
+     * @param index The index of the cache.
+     *
+     * @return The resource cache, or NULL if index is out of range.
+     */
+    static ResourceCache* getCache(unsigned int index);
+
+    /**
+     * Returns the estimated memory used by the resources in all caches.
+     *
+     * @return The memory usage in bytes.
+     */
+    static size_t getTotalMemoryUsage();
+
+    /**
+     * Sets the memory budget for all caches.
+     *
+     * Setting a budget of zero releases all unused resources and stops the caches
+     * from keeping resources loaded.
+     *
+     * @param budget The memory budget in bytes, or zero for no budget.
+     */
+    static void setMemoryBudget(size_t budget);
+
+    /**
+     * Returns the memory budget for all caches.
+     *
+     * @return The memory budget in bytes, or zero if there is no budget.
+     */
+    static size_t getMemoryBudget();
+
+    /**
+     * Releases unused resources, least recently used first, until the memory used
+     * by all caches fits within the memory budget.
+     */
+    static void trim();
+
+    /**
+     * Releases all unused resources.
+     *
+     * Resources that are still in use are not affected.
+     */
+    static void releaseUnused();
+
+    /**
+     * Logs the number of resources and the memory used by each cache.
+     */
+    static void logMemoryUsage();
+
+private:
+
+    struct Entry
+    {
+        std::string key;
+        Ref* resource;
+        size_t gpuMemoryUsage;
+        size_t cpuMemoryUsage;
+        unsigned int lastUsed;
+        bool retained;
+    };
+
+    typedef std::multimap<unsigned int, Entry> EntryMap;
+
+    /**
+     * Hidden copy constructor.
+     */
+    ResourceCache(const ResourceCache& copy);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    ResourceCache& operator=(const ResourceCache&);
+
+    /**
+     * Marks an entry as used and holds a reference to its resource if there is a memory budget.
+     */
+    void use(Entry& entry);
+
+    /**
+     * Releases the references held by the caches to unused resources until the memory used
+     * fits within the given budget.
+     *
+     * @param budget The memory to fit within, in bytes.
+     */
+    static void releaseUnused(size_t budget);
+
+    /**
+     * Reads the memory budget and log interval from the game config.
+     */
+    static void initialize();
+
+    /**
+     * Releases all unused resources, stops keeping resources loaded and destroys
+     * the caches created with get().
+     */
+    static void finalize();
+
+    /**
+     * Trims the caches to the memory budget and logs their memory usage at the log interval.
+     *
+     * @param elapsedTime The elapsed game time in milliseconds.
+     */
+    static void updateInternal(float elapsedTime);
+
+    std::string _type;
+    EntryMap _entries;
+    std::map<Ref*, EntryMap::iterator> _resources;
+    size_t _gpuMemoryUsage;
+    size_t _cpuMemoryUsage;
+    ResourceCache* _next;
+    ResourceCache** _owner;
+};
+
+}
+
+#endif
@@ -195,12 +195,72 @@ unsigned int Scene::findNodes(const char* id, std::vector<Node*>& nodes, bool re
     return count;
 }
 
-void Scene::visitNode(Node* node, const char* visitMethod)
+void Scene::visit(const char* visitMethod)
+{
+    // Resolve the function once for the whole traversal instead of once per node.
+    ScriptFunction* function = Game::getInstance()->getScriptController()->createFunction(visitMethod, "<Node>");
+    for (Node* node = getFirstNode(); node != NULL; node = node->getNextSibling())
+    {
+        visitNode(node, function);
+    }
+    SAFE_DELETE(function);
+}
+
+unsigned int Scene::gatherNodes(std::vector<Node*>& nodes, unsigned int filter, const char* tag) const
+{
+    unsigned int count = 0;
+    for (Node* node = getFirstNode(); node != NULL; node = node->getNextSibling())
+    {
+        count += gatherNode(node, nodes, filter, tag);
+    }
+    return count;
+}
+
+unsigned int Scene::gatherNode(Node* node, std::vector<Node*>& nodes, unsigned int filter, const char* tag)
+{
+    unsigned int count = 0;
+
+    bool matches = filter == 0 ||
+        ((filter & FILTER_MODEL) && node->_model) ||
+        ((filter & FILTER_LIGHT) && node->_light) ||
+        ((filter & FILTER_CAMERA) && node->_camera) ||
+        ((filter & FILTER_PARTICLE_EMITTER) && node->_particleEmitter);
+    if (matches && (tag == NULL || node->hasTag(tag)))
+    {
+        nodes.push_back(node);
+        ++count;
+    }
+
+    // Gather the joint hierarchy of skinned models, as visitNode does.
+    if (node->_model && node->_model->_skin && node->_model->_skin->_rootNode)
+    {
+        count += gatherNode(node->_model->_skin->_rootNode, nodes, filter, tag);
+    }
+
+    for (Node* child = node->getFirstChild(); child != NULL; child = child->getNextSibling())
+    {
+        count += gatherNode(child, nodes, filter, tag);
+    }
+
+    return count;
+}
+
+void Scene::visitNodes(const char* visitMethod, unsigned int filter, const char* tag)
+{
+    // The list is kept between calls so its storage is reused; Lua receives a copy as a table.
+    _visitNodes.clear();
+    gatherNodes(_visitNodes, filter, tag);
+
+    Node** nodes = _visitNodes.empty() ? NULL : &_visitNodes[0];
+    Game::getInstance()->getScriptController()->executeFunction<void>(visitMethod, "{Node}", nodes, (unsigned int)_visitNodes.size());
+}
+
+void Scene::visitNode(Node* node, ScriptFunction* visitMethod)
 {
     ScriptController* sc = Game::getInstance()->getScriptController();
 
     // Invoke the visit method for this node.
-    if (!sc->executeFunction<bool>(visitMethod, "<Node>", node))
+    if (!sc->executeFunction<bool>(visitMethod, node))
         return;
 
     // If this node has a model with a mesh skin, visit the joint hierarchy within it
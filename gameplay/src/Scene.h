@@ -18,6 +18,26 @@ class Scene : public Ref
 {
 public:
 
+    /**
+     * Filter flag for gathering nodes that have a model.
+     */
+    static const unsigned int FILTER_MODEL = 0x01;
+
+    /**
+     * Filter flag for gathering nodes that have a light.
+     */
+    static const unsigned int FILTER_LIGHT = 0x02;
+
+    /**
+     * Filter flag for gathering nodes that have a camera.
+     */
+    static const unsigned int FILTER_CAMERA = 0x04;
+
+    /**
+     * Filter flag for gathering nodes that have a particle emitter.
+     */
+    static const unsigned int FILTER_PARTICLE_EMITTER = 0x08;
+
     /**
      * Creates a new empty scene.
      *
@@ -232,7 +252,39 @@ public:
      *
      * @param visitMethod The name of the Lua function to call for each node in the scene.
      */
-    inline void visit(const char* visitMethod);
+    void visit(const char* visitMethod);
+
+    /**
+     * Gathers the nodes in the scene that match the given filter into a flat list.
+     *
+     * The scene is traversed depth-first (including the joint hierarchies of skinned
+     * models, as visit does). A node matches if it has any of the components given
+     * by the filter flags (or the filter is zero) and it has the given tag (or the
+     * tag is NULL).
+     *
+     * @param nodes The list the matching nodes are appended to.
+     * @param filter A combination of the FILTER_ flags, or zero to match any node.
+     * @param tag The tag the nodes must have, or NULL to match any node.
+     *
+     * @return The number of nodes gathered.
+     * @script{ignore}
+     */
+    unsigned int gatherNodes(std::vector<Node*>& nodes, unsigned int filter = 0, const char* tag = NULL) const;
+
+    /**
+     * Calls the specified Lua function once with all the nodes in the scene that match
+     * the given filter.
+     *
+     * The visitMethod parameter must be a string containing the name of a valid Lua
+     * function that accepts a single table parameter, which holds the matching nodes
+     * in depth-first order (see gatherNodes). Unlike visit, this calls into Lua only
+     * once per traversal rather than once per node.
+     *
+     * @param visitMethod The name of the Lua function to call with the nodes.
+     * @param filter A combination of the FILTER_ flags, or zero to match any node.
+     * @param tag The tag the nodes must have, or NULL to match any node.
+     */
+    void visitNodes(const char* visitMethod, unsigned int filter = 0, const char* tag = NULL);
 
     /**
      * Updates all the active nodes in the scene.
@@ -286,7 +338,12 @@ private:
     /**
      * Visits the given node and all of its children recursively.
      */
-    void visitNode(Node* node, const char* visitMethod);
+    void visitNode(Node* node, ScriptFunction* visitMethod);
+
+    /**
+     * Gathers the given node and all of its children recursively.
+     */
+    static unsigned int gatherNode(Node* node, std::vector<Node*>& nodes, unsigned int filter, const char* tag);
 
     Node* findNextVisibleSibling(Node* node);
 
@@ -301,6 +358,7 @@ private:
     bool _bindAudioListenerToCamera;
     Node* _nextItr;
     bool _nextReset;
+    std::vector<Node*> _visitNodes;
 };
 
 template <class T>
@@ -321,14 +379,6 @@ void Scene::visit(T* instance, bool (T::*visitMethod)(Node*,C), C cookie)
     }
 }
 
-inline void Scene::visit(const char* visitMethod)
-{
-    for (Node* node = getFirstNode(); node != NULL; node = node->getNextSibling())
-    {
-        visitNode(node, visitMethod);
-    }
-}
-
 template <class T>
 void Scene::visitNode(Node* node, T* instance, bool (T::*visitMethod)(Node*))
 {
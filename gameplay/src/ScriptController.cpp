@@ -1,6 +1,7 @@
 #include "Base.h"
 #include "FileSystem.h"
 #include "ScriptController.h"
+#include "Atomic.h"
 
 #ifndef NO_LUA_BINDINGS
 #include "lua/lua_all_bindings.h"
@@ -133,6 +134,17 @@ namespace gameplay
 
 extern void splitURL(const std::string& url, std::string* file, std::string* id);
 
+// Addresses used as unique light userdata keys for the userdata cache and the
+// garbage collection sentinel metatable (both stored in the registry).
+static char __userdataCacheKey;
+static char __collectSentinelKey;
+
+// The state holding the userdata cache, or NULL if there is no state to remove objects from.
+static lua_State* __userdataCacheState = NULL;
+
+// Whether the current thread is the one that created the Lua state and runs scripts.
+static GP_THREAD_LOCAL bool __scriptThread = false;
+
 void ScriptUtil::registerLibrary(const char* name, const luaL_Reg* functions)
 {
     ScriptController* sc = Game::getInstance()->getScriptController();
@@ -291,6 +303,7 @@ void ScriptUtil::registerClass(const char* name, const luaL_Reg* members, lua_CF
     luaL_newmetatable(sc->_lua, name);
     if (members)
         luaL_setfuncs(sc->_lua, members, 0);
+
     lua_pushstring(sc->_lua, "__index");
     lua_pushvalue(sc->_lua, -2);
     lua_settable(sc->_lua, -3);
@@ -424,6 +437,18 @@ bool ScriptUtil::luaCheckBool(lua_State* state, int n)
     return (lua_toboolean(state, n) != 0);
 }
 
+void ScriptUtil::pushObject(lua_State* state, void* instance, const char* type, bool owns)
+{
+    if (instance == NULL)
+    {
+        lua_pushnil(state);
+        return;
+    }
+
+    luaL_getmetatable(state, type);
+    ScriptController::pushUserdata(state, instance, owns);
+}
+
 
 void ScriptController::loadScript(const char* path, bool forceReload)
 {
@@ -431,6 +456,9 @@ void ScriptController::loadScript(const char* path, bool forceReload)
     std::set<std::string>::iterator iter = _loadedScripts.find(path);
     if (iter == _loadedScripts.end() || forceReload)
     {
+        // Scripts may (re)define functions, so function handles need to look them up again.
+        ++_scriptGeneration;
+
         bool success = false;
         if (iter == _loadedScripts.end())
             _loadedScripts.insert(path); // insert before loading script to prevent load recursion
@@ -668,12 +696,65 @@ void ScriptController::print(const char* str1, const char* str2)
     gameplay::print("%s%s", str1, str2);
 }
 
-ScriptController::ScriptController() : _lua(NULL)
+ScriptController::ScriptController() : _lua(NULL), _scriptGeneration(0), _collectionCount(0),
+    _createdUserdataCount(0), _reusedUserdataCount(0), _garbageCollectionMode(GC_INCREMENTAL),
+    _garbageCollectionStepSize(0), _timeBudget(0.0f), _collectionTime(0.0f), _allocationCount(0),
+    _allocationPageCount(0), _pooledMemoryUsage(0)
 {
+    for (unsigned int i = 0; i < CALLBACK_COUNT; i++)
+    {
+        _callbackTime[i] = 0.0f;
+        _callbackAllocationCount[i] = 0;
+        _frameCallbackTime[i] = 0.0f;
+        _frameCallbackAllocationCount[i] = 0;
+    }
 }
 
 ScriptController::~ScriptController()
 {
+    // Handles that outlive the controller can no longer be called.
+    for (std::set<ScriptFunction*>::iterator itr = _functions.begin(); itr != _functions.end(); ++itr)
+    {
+        (*itr)->_controller = NULL;
+    }
+}
+
+// Small blocks allocated by Lua are pooled by size class (in steps of the granularity).
+static const size_t SCRIPT_ALLOCATOR_GRANULARITY = 16;
+static const size_t SCRIPT_ALLOCATOR_MAX_BLOCK_SIZE = 256;
+static const size_t SCRIPT_ALLOCATOR_PAGE_SIZE = 16 * 1024;
+
+/**
+ * Allocates memory aligned to the allocator page size.
+ */
+static void* allocatePage()
+{
+#ifdef WIN32
+    return _aligned_malloc(SCRIPT_ALLOCATOR_PAGE_SIZE, SCRIPT_ALLOCATOR_PAGE_SIZE);
+#else
+    void* page = NULL;
+    if (posix_memalign(&page, SCRIPT_ALLOCATOR_PAGE_SIZE, SCRIPT_ALLOCATOR_PAGE_SIZE) != 0)
+        return NULL;
+    return page;
+#endif
+}
+
+/**
+ * Frees memory allocated with allocatePage.
+ */
+static void freePage(void* page)
+{
+#ifdef WIN32
+    _aligned_free(page);
+#else
+    free(page);
+#endif
+}
+
+static int panic(lua_State* state)
+{
+    GP_ERROR("Unprotected error in call to Lua API (%s).", lua_tostring(state, -1));
+    return 0;
 }
 
 static const char* lua_print_function = 
@@ -730,16 +811,40 @@ void appendLuaPath(lua_State* state, const char* path)
 
 void ScriptController::initialize()
 {
-    _lua = luaL_newstate();
+    _allocationPages.assign(SCRIPT_ALLOCATOR_MAX_BLOCK_SIZE / SCRIPT_ALLOCATOR_GRANULARITY, (AllocationPage*)NULL);
+    _lua = lua_newstate(ScriptController::allocate, this);
     if (!_lua)
         GP_ERROR("Failed to initialize Lua scripting engine.");
+    lua_atpanic(_lua, panic);
     luaL_openlibs(_lua);
+    applyGarbageCollectionMode();
+
+    // Create the cache of userdata for objects pushed to Lua, keyed by object address.
+    // The cache has weak values, so it never keeps userdata from being collected.
+    lua_newtable(_lua);
+    lua_newtable(_lua);
+    lua_pushliteral(_lua, "v");
+    lua_setfield(_lua, -2, "__mode");
+    lua_setmetatable(_lua, -2);
+    lua_rawsetp(_lua, LUA_REGISTRYINDEX, &__userdataCacheKey);
+    __userdataCacheState = _lua;
+    __scriptThread = true;
 
 #ifndef NO_LUA_BINDINGS
     lua_RegisterAllBindings();
     ScriptUtil::registerFunction("convert", ScriptController::convert);
 #endif
 
+    // Create the sentinel that counts garbage collection cycles (see collectSentinel).
+    lua_newuserdata(_lua, 1);
+    lua_newtable(_lua);
+    lua_pushcfunction(_lua, ScriptController::collectSentinel);
+    lua_setfield(_lua, -2, "__gc");
+    lua_pushvalue(_lua, -1);
+    lua_rawsetp(_lua, LUA_REGISTRYINDEX, &__collectSentinelKey);
+    lua_setmetatable(_lua, -2);
+    lua_pop(_lua, 1);
+
     // Append to the LUA_PATH to allow scripts to be found in the resource folder on all platforms
     appendLuaPath(_lua, FileSystem::getResourcePath());
 
@@ -780,11 +885,50 @@ void ScriptController::initializeGame()
 
 void ScriptController::finalize()
 {
+    // Free the cached signatures (closing the state releases their references).
+    for (std::map<const char*, Signature*>::iterator itr = _signatures.begin(); itr != _signatures.end(); ++itr)
+    {
+        SAFE_DELETE(itr->second);
+    }
+    _signatures.clear();
+
+    // Release the references held by function handles while the state is still open.
+    for (std::set<ScriptFunction*>::iterator itr = _functions.begin(); itr != _functions.end(); ++itr)
+    {
+        (*itr)->release();
+    }
+
     if (_lua)
 	{
+        // Stop the garbage collection sentinel from recreating itself while the state closes.
+        lua_rawgetp(_lua, LUA_REGISTRYINDEX, &__collectSentinelKey);
+        lua_pushnil(_lua);
+        lua_setfield(_lua, -2, "__gc");
+        lua_pop(_lua, 1);
+
+        // Objects deleted while the state closes have no cache to be removed from.
+        __userdataCacheState = NULL;
+        __scriptThread = false;
         lua_close(_lua);
 		_lua = NULL;
 	}
+
+    // Free the pages kept for each size class now that Lua has released all of its blocks.
+    for (size_t i = 0; i < _allocationPages.size(); i++)
+    {
+        AllocationPage* page = _allocationPages[i];
+        while (page)
+        {
+            AllocationPage* next = page->next;
+            GP_ASSERT(page->blockCount == 0);
+            freePage(page);
+            _allocationPageCount--;
+            page = next;
+        }
+    }
+    _allocationPages.clear();
+    GP_ASSERT(_allocationPageCount == 0);
+    _pooledMemoryUsage = 0;
 }
 
 void ScriptController::finalizeGame()
@@ -809,68 +953,122 @@ void ScriptController::finalizeGame()
 void ScriptController::update(float elapsedTime)
 {
     std::vector<std::string>& list = _callbacks[UPDATE];
+    if (list.empty())
+        return;
+
+    double startTime = Game::getAbsoluteTime();
+    unsigned int startAllocationCount = _allocationCount;
     for (size_t i = 0; i < list.size(); ++i)
         executeFunction<void>(list[i].c_str(), "f", elapsedTime);
+    recordCallback(UPDATE, startTime, startAllocationCount);
 }
 
 void ScriptController::render(float elapsedTime)
 {
     std::vector<std::string>& list = _callbacks[RENDER];
+    if (list.empty())
+        return;
+
+    double startTime = Game::getAbsoluteTime();
+    unsigned int startAllocationCount = _allocationCount;
     for (size_t i = 0; i < list.size(); ++i)
         executeFunction<void>(list[i].c_str(), "f", elapsedTime);
+    recordCallback(RENDER, startTime, startAllocationCount);
 }
 
 void ScriptController::resizeEvent(unsigned int width, unsigned int height)
 {
     std::vector<std::string>& list = _callbacks[RESIZE_EVENT];
+    if (list.empty())
+        return;
+
+    double startTime = Game::getAbsoluteTime();
+    unsigned int startAllocationCount = _allocationCount;
     for (size_t i = 0; i < list.size(); ++i)
         executeFunction<void>(list[i].c_str(), "uiui", width, height);
+    recordCallback(RESIZE_EVENT, startTime, startAllocationCount);
 }
 
 void ScriptController::keyEvent(Keyboard::KeyEvent evt, int key)
 {
     std::vector<std::string>& list = _callbacks[KEY_EVENT];
+    if (list.empty())
+        return;
+
+    double startTime = Game::getAbsoluteTime();
+    unsigned int startAllocationCount = _allocationCount;
     for (size_t i = 0; i < list.size(); ++i)
         executeFunction<void>(list[i].c_str(), "[Keyboard::KeyEvent][Keyboard::Key]", evt, key);
+    recordCallback(KEY_EVENT, startTime, startAllocationCount);
 }
 
 void ScriptController::touchEvent(Touch::TouchEvent evt, int x, int y, unsigned int contactIndex)
 {
     std::vector<std::string>& list = _callbacks[TOUCH_EVENT];
+    if (list.empty())
+        return;
+
+    double startTime = Game::getAbsoluteTime();
+    unsigned int startAllocationCount = _allocationCount;
     for (size_t i = 0; i < list.size(); ++i)
         executeFunction<void>(list[i].c_str(), "[Touch::TouchEvent]iiui", evt, x, y, contactIndex);
+    recordCallback(TOUCH_EVENT, startTime, startAllocationCount);
 }
 
 bool ScriptController::mouseEvent(Mouse::MouseEvent evt, int x, int y, int wheelDelta)
 {
     std::vector<std::string>& list = _callbacks[MOUSE_EVENT];
-    for (size_t i = 0; i < list.size(); ++i)
+    if (list.empty())
+        return false;
+
+    double startTime = Game::getAbsoluteTime();
+    unsigned int startAllocationCount = _allocationCount;
+    bool consumed = false;
+    for (size_t i = 0; i < list.size() && !consumed; ++i)
     {
-        if (executeFunction<bool>(list[i].c_str(), "[Mouse::MouseEvent]iii", evt, x, y, wheelDelta))
-            return true;
+        consumed = executeFunction<bool>(list[i].c_str(), "[Mouse::MouseEvent]iii", evt, x, y, wheelDelta);
     }
-    return false;
+    recordCallback(MOUSE_EVENT, startTime, startAllocationCount);
+    return consumed;
 }
 
 void ScriptController::gestureSwipeEvent(int x, int y, int direction)
 {
     std::vector<std::string>& list = _callbacks[GESTURE_SWIPE_EVENT];
+    if (list.empty())
+        return;
+
+    double startTime = Game::getAbsoluteTime();
+    unsigned int startAllocationCount = _allocationCount;
     for (size_t i = 0; i < list.size(); ++i)
         executeFunction<void>(list[i].c_str(), "iii", x, y, direction);
+    recordCallback(GESTURE_SWIPE_EVENT, startTime, startAllocationCount);
 }
 
 void ScriptController::gesturePinchEvent(int x, int y, float scale)
 {
     std::vector<std::string>& list = _callbacks[GESTURE_PINCH_EVENT];
+    if (list.empty())
+        return;
+
+    double startTime = Game::getAbsoluteTime();
+    unsigned int startAllocationCount = _allocationCount;
     for (size_t i = 0; i < list.size(); ++i)
         executeFunction<void>(list[i].c_str(), "iif", x, y, scale);
+    recordCallback(GESTURE_PINCH_EVENT, startTime, startAllocationCount);
 }
 
 void ScriptController::gestureTapEvent(int x, int y)
 {
     std::vector<std::string>& list = _callbacks[GESTURE_TAP_EVENT];
+    if (list.empty())
+        return;
+
+    double startTime = Game::getAbsoluteTime();
+    unsigned int startAllocationCount = _allocationCount;
     for (size_t i = 0; i < list.size(); ++i)
         executeFunction<void>(list[i].c_str(), "ii", x, y);
+    recordCallback(GESTURE_TAP_EVENT, startTime, startAllocationCount);
 }
 
 void ScriptController::gestureLongTapEvent(int x, int y, float duration)
@@ -888,8 +1086,14 @@ void ScriptController::gestureDropEvent(int x, int y)
 void ScriptController::gamepadEvent(Gamepad::GamepadEvent evt, Gamepad* gamepad, unsigned int analogIndex)
 {
     std::vector<std::string>& list = _callbacks[GAMEPAD_EVENT];
+    if (list.empty())
+        return;
+
+    double startTime = Game::getAbsoluteTime();
+    unsigned int startAllocationCount = _allocationCount;
     for (size_t i = 0; i < list.size(); ++i)
         executeFunction<void>(list[i].c_str(), "[Gamepad::GamepadEvent]<Gamepad>", evt, gamepad);
+    recordCallback(GAMEPAD_EVENT, startTime, startAllocationCount);
 }
 
 void ScriptController::executeFunctionHelper(int resultCount, const char* func, const char* args, va_list* list)
@@ -909,115 +1113,625 @@ void ScriptController::executeFunctionHelper(int resultCount, const char* func,
         return;
     }
 
-    const char* sig = args;
-    int argumentCount = 0;
-
     // Push the arguments to the Lua stack if there are any.
-    if (sig)
+    int argumentCount = args ? pushArguments(getSignature(args), list) : 0;
+
+    // Perform the function call.
+    if (lua_pcall(_lua, argumentCount, resultCount, 0) != 0)
+        GP_WARN("Failed to call function '%s' with error '%s'.", func, lua_tostring(_lua, -1));
+}
+
+void ScriptController::executeFunctionHelper(int resultCount, ScriptFunction* function, va_list* list)
+{
+	if (!_lua)
+		return; // handles calling this method after script is finalized
+
+    GP_ASSERT(function);
+    if (!function->push())
     {
-        while (true)
+        GP_WARN("Failed to call function '%s'", function->_name.c_str());
+        return;
+    }
+
+    int argumentCount = pushArguments(&function->_signature, list);
+
+    // Perform the function call.
+    if (lua_pcall(_lua, argumentCount, resultCount, 0) != 0)
+        GP_WARN("Failed to call function '%s' with error '%s'.", function->_name.c_str(), lua_tostring(_lua, -1));
+}
+
+unsigned int ScriptController::getMemoryUsage() const
+{
+    if (!_lua)
+        return 0;
+
+    // Lua only counts the blocks it is using, so add the space free in the pages.
+    size_t pooledFree = _allocationPageCount * SCRIPT_ALLOCATOR_PAGE_SIZE - _pooledMemoryUsage;
+    return (unsigned int)lua_gc(_lua, LUA_GCCOUNT, 0) * 1024 + (unsigned int)lua_gc(_lua, LUA_GCCOUNTB, 0) + (unsigned int)pooledFree;
+}
+
+unsigned int ScriptController::getCollectionCount() const
+{
+    return _collectionCount;
+}
+
+unsigned int ScriptController::getCreatedUserdataCount() const
+{
+    return _createdUserdataCount;
+}
+
+unsigned int ScriptController::getReusedUserdataCount() const
+{
+    return _reusedUserdataCount;
+}
+
+void ScriptController::setGarbageCollectionMode(GarbageCollectionMode mode)
+{
+    _garbageCollectionMode = mode;
+    applyGarbageCollectionMode();
+}
+
+ScriptController::GarbageCollectionMode ScriptController::getGarbageCollectionMode() const
+{
+    return _garbageCollectionMode;
+}
+
+void ScriptController::setGarbageCollectionStepSize(int size)
+{
+    _garbageCollectionStepSize = max(size, 0);
+}
+
+int ScriptController::getGarbageCollectionStepSize() const
+{
+    return _garbageCollectionStepSize;
+}
+
+void ScriptController::setTimeBudget(float budget)
+{
+    _timeBudget = max(budget, 0.0f);
+}
+
+float ScriptController::getTimeBudget() const
+{
+    return _timeBudget;
+}
+
+float ScriptController::getCollectionTime() const
+{
+    return _collectionTime;
+}
+
+unsigned int ScriptController::getAllocationCount() const
+{
+    return _allocationCount;
+}
+
+float ScriptController::getCallbackTime(const char* callback) const
+{
+    ScriptCallback index = toCallback(callback);
+    return index != INVALID_CALLBACK ? _callbackTime[index] : 0.0f;
+}
+
+unsigned int ScriptController::getCallbackAllocationCount(const char* callback) const
+{
+    ScriptCallback index = toCallback(callback);
+    return index != INVALID_CALLBACK ? _callbackAllocationCount[index] : 0;
+}
+
+void ScriptController::applyGarbageCollectionMode()
+{
+    if (!_lua)
+        return;
+
+    switch (_garbageCollectionMode)
+    {
+    case GC_GENERATIONAL:
+        lua_gc(_lua, LUA_GCGEN, 0);
+        lua_gc(_lua, LUA_GCRESTART, 0);
+        break;
+    case GC_MANUAL:
+        lua_gc(_lua, LUA_GCINC, 0);
+        lua_gc(_lua, LUA_GCSTOP, 0);
+        break;
+    case GC_INCREMENTAL:
+    default:
+        lua_gc(_lua, LUA_GCINC, 0);
+        lua_gc(_lua, LUA_GCRESTART, 0);
+        break;
+    }
+}
+
+void ScriptController::collectGarbage()
+{
+    _collectionTime = 0.0f;
+    // The manual mode relies on these steps, so it always takes at least one.
+    if (_lua && (_timeBudget > 0.0f || _garbageCollectionMode == GC_MANUAL) && _garbageCollectionMode != GC_GENERATIONAL)
+    {
+        // Collection gets whatever the script callbacks of this frame left of the budget.
+        double budget = _timeBudget;
+        for (unsigned int i = 0; i < CALLBACK_COUNT; i++)
+            budget -= _frameCallbackTime[i];
+
+        double startTime = Game::getAbsoluteTime();
+        double elapsedTime = 0.0;
+        do
         {
-            if (!(*sig))
+            // Stop at the end of a cycle rather than starting the next one straight away.
+            if (lua_gc(_lua, LUA_GCSTEP, _garbageCollectionStepSize))
                 break;
+            elapsedTime = Game::getAbsoluteTime() - startTime;
+        }
+        while (elapsedTime < budget);
 
-            switch(*sig++)
-            {
-            // Signed integers.
-            case 'c':
-            case 'h':
-            case 'i':
-            case 'l':
-                lua_pushinteger(_lua, va_arg(*list, int));
-                break;
-            // Unsigned integers.
-            case 'u':
-                // Skip past the actual type (long, int, short, char).
-                sig++;
-                lua_pushunsigned(_lua, va_arg(*list, int));
-                break;
-            // Booleans.
-            case 'b':
-                lua_pushboolean(_lua, va_arg(*list, int));
-                break;
-            // Floating point numbers.
-            case 'f':
-            case 'd':
-                lua_pushnumber(_lua, va_arg(*list, double));
-                break;
-            // Strings.
-            case 's':
-                lua_pushstring(_lua, va_arg(*list, char*));
-                break;
-            // Pointers.
-            case 'p':
-                lua_pushlightuserdata(_lua, va_arg(*list, void*));
-                break;
-            // Enums.
-            case '[':
-            {
-                std::string type = sig;
-                type = type.substr(0, type.find("]"));
+        _collectionTime = (float)(Game::getAbsoluteTime() - startTime);
+    }
 
-                // Skip past the closing ']' (the semi-colon here is intentional-do not remove).
-                while (*sig++ != ']');
+    // Publish the callback statistics of the frame.
+    for (unsigned int i = 0; i < CALLBACK_COUNT; i++)
+    {
+        _callbackTime[i] = _frameCallbackTime[i];
+        _callbackAllocationCount[i] = _frameCallbackAllocationCount[i];
+        _frameCallbackTime[i] = 0.0f;
+        _frameCallbackAllocationCount[i] = 0;
+    }
+}
 
-                unsigned int value = va_arg(*list, int);
-                std::string enumStr = "";
-                for (unsigned int i = 0; enumStr.size() == 0 && i < _stringFromEnum.size(); i++)
-                {
-                    enumStr = (*_stringFromEnum[i])(type, value);
-                }
+void ScriptController::recordCallback(ScriptCallback callback, double startTime, unsigned int startAllocationCount)
+{
+    _frameCallbackTime[callback] += (float)(Game::getAbsoluteTime() - startTime);
+    _frameCallbackAllocationCount[callback] += _allocationCount - startAllocationCount;
+}
 
-                lua_pushstring(_lua, enumStr.c_str());
-                break;
-            }
-            // Object references/pointers (Lua userdata).
-            case '<':
+void* ScriptController::allocate(void* ud, void* ptr, size_t osize, size_t nsize)
+{
+    ScriptController* sc = (ScriptController*)ud;
+    GP_ASSERT(sc);
+
+    if (nsize == 0)
+    {
+        sc->freeBlock(ptr, osize);
+        return NULL;
+    }
+
+    // Lua passes the type of object being created as the old size of new blocks.
+    if (ptr == NULL)
+    {
+        sc->_allocationCount++;
+        return sc->allocateBlock(nsize);
+    }
+
+    // Blocks that stay within their size class (or stay too large to pool) are resized in place.
+    if (osize <= SCRIPT_ALLOCATOR_MAX_BLOCK_SIZE && nsize <= SCRIPT_ALLOCATOR_MAX_BLOCK_SIZE &&
+        (osize - 1) / SCRIPT_ALLOCATOR_GRANULARITY == (nsize - 1) / SCRIPT_ALLOCATOR_GRANULARITY)
+        return ptr;
+    if (osize > SCRIPT_ALLOCATOR_MAX_BLOCK_SIZE && nsize > SCRIPT_ALLOCATOR_MAX_BLOCK_SIZE)
+        return realloc(ptr, nsize);
+
+    // Move the block between a pool and the heap (Lua expects the old block intact on failure).
+    void* block = sc->allocateBlock(nsize);
+    if (block)
+    {
+        memcpy(block, ptr, min(osize, nsize));
+        sc->freeBlock(ptr, osize);
+    }
+    return block;
+}
+
+void* ScriptController::allocateBlock(size_t size)
+{
+    if (size > SCRIPT_ALLOCATOR_MAX_BLOCK_SIZE)
+        return malloc(size);
+
+    // The pages of a size class that have free blocks are linked, so take the first.
+    size_t sizeClass = (size - 1) / SCRIPT_ALLOCATOR_GRANULARITY;
+    size_t blockSize = (sizeClass + 1) * SCRIPT_ALLOCATOR_GRANULARITY;
+    AllocationPage* page = _allocationPages[sizeClass];
+    if (!page)
+    {
+        page = (AllocationPage*)allocatePage();
+        if (!page)
+            return NULL;
+        page->prev = NULL;
+        page->next = NULL;
+        page->freeBlocks = NULL;
+        // Blocks follow the page header, rounded up to keep them aligned.
+        page->cursor = (char*)page + ((sizeof(AllocationPage) + SCRIPT_ALLOCATOR_GRANULARITY - 1) & ~(SCRIPT_ALLOCATOR_GRANULARITY - 1));
+        page->blockSize = blockSize;
+        page->blockCount = 0;
+        _allocationPages[sizeClass] = page;
+        _allocationPageCount++;
+    }
+
+    // Reuse a freed block (free blocks store the next free block of their page),
+    // or carve a new one from the unused end of the page.
+    void* block = page->freeBlocks;
+    if (block)
+    {
+        page->freeBlocks = *(void**)block;
+    }
+    else
+    {
+        block = page->cursor;
+        page->cursor += blockSize;
+    }
+    page->blockCount++;
+    _pooledMemoryUsage += blockSize;
+
+    // Unlink the page once it is full.
+    if (!page->freeBlocks && page->cursor + blockSize > (char*)page + SCRIPT_ALLOCATOR_PAGE_SIZE)
+    {
+        _allocationPages[sizeClass] = page->next;
+        if (page->next)
+            page->next->prev = NULL;
+        page->next = NULL;
+    }
+    return block;
+}
+
+void ScriptController::freeBlock(void* block, size_t size)
+{
+    if (block == NULL || size == 0)
+        return;
+
+    if (size > SCRIPT_ALLOCATOR_MAX_BLOCK_SIZE)
+    {
+        free(block);
+        return;
+    }
+
+    size_t sizeClass = (size - 1) / SCRIPT_ALLOCATOR_GRANULARITY;
+    AllocationPage* page = (AllocationPage*)((size_t)block & ~(SCRIPT_ALLOCATOR_PAGE_SIZE - 1));
+    GP_ASSERT(page->blockSize == (sizeClass + 1) * SCRIPT_ALLOCATOR_GRANULARITY);
+    GP_ASSERT(page->blockCount > 0);
+
+    bool full = !page->freeBlocks && page->cursor + page->blockSize > (char*)page + SCRIPT_ALLOCATOR_PAGE_SIZE;
+    *(void**)block = page->freeBlocks;
+    page->freeBlocks = block;
+    page->blockCount--;
+    _pooledMemoryUsage -= page->blockSize;
+
+    // A full page has free blocks again, so link it back in.
+    if (full)
+    {
+        page->prev = NULL;
+        page->next = _allocationPages[sizeClass];
+        if (page->next)
+            page->next->prev = page;
+        _allocationPages[sizeClass] = page;
+    }
+
+    // Return an empty page to the system, unless it is the only page left with free blocks
+    // (so allocating and freeing a single block doesn't allocate and free a page each time).
+    if (page->blockCount == 0 && (page->prev || page->next))
+    {
+        if (page->prev)
+            page->prev->next = page->next;
+        else
+            _allocationPages[sizeClass] = page->next;
+        if (page->next)
+            page->next->prev = page->prev;
+        freePage(page);
+        _allocationPageCount--;
+    }
+}
+
+ScriptFunction* ScriptController::createFunction(const char* func, const char* args)
+{
+    GP_ASSERT(func);
+    ScriptFunction* function = new ScriptFunction(this, func, args);
+    _functions.insert(function);
+    return function;
+}
+
+// Maximum number of argument signatures cached for executeFunction calls by name.
+static const size_t SCRIPT_SIGNATURE_CACHE_MAX_SIZE = 256;
+
+ScriptController::Signature* ScriptController::getSignature(const char* args)
+{
+    GP_ASSERT(args);
+
+    // Signatures are almost always string literals, so they are cached by address and
+    // the contents are only compared to catch a different string reusing the address.
+    std::map<const char*, Signature*>::iterator itr = _signatures.find(args);
+    if (itr != _signatures.end())
+    {
+        if (itr->second->args == args)
+            return itr->second;
+
+        releaseSignature(itr->second);
+        SAFE_DELETE(itr->second);
+        _signatures.erase(itr);
+    }
+
+    if (_signatures.size() >= SCRIPT_SIGNATURE_CACHE_MAX_SIZE)
+    {
+        for (itr = _signatures.begin(); itr != _signatures.end(); ++itr)
+        {
+            releaseSignature(itr->second);
+            SAFE_DELETE(itr->second);
+        }
+        _signatures.clear();
+    }
+
+    Signature* signature = new Signature();
+    parseSignature(args, signature);
+    _signatures[args] = signature;
+    return signature;
+}
+
+void ScriptController::parseSignature(const char* args, Signature* signature)
+{
+    GP_ASSERT(signature);
+    signature->args = args ? args : "";
+    signature->arguments.clear();
+
+    const char* sig = args;
+    if (!sig)
+        return;
+
+    while (*sig)
+    {
+        switch(*sig++)
+        {
+        // Signed integers.
+        case 'c':
+        case 'h':
+        case 'i':
+        case 'l':
+            signature->arguments.push_back(Argument('i', ""));
+            break;
+        // Unsigned integers.
+        case 'u':
+            // Skip past the actual type (long, int, short, char).
+            sig++;
+            signature->arguments.push_back(Argument('u', ""));
+            break;
+        // Booleans.
+        case 'b':
+            signature->arguments.push_back(Argument('b', ""));
+            break;
+        // Floating point numbers.
+        case 'f':
+        case 'd':
+            signature->arguments.push_back(Argument('f', ""));
+            break;
+        // Strings.
+        case 's':
+            signature->arguments.push_back(Argument('s', ""));
+            break;
+        // Pointers.
+        case 'p':
+            signature->arguments.push_back(Argument('p', ""));
+            break;
+        // Enums.
+        case '[':
+        {
+            std::string type = sig;
+            type = type.substr(0, type.find("]"));
+
+            // Skip past the closing ']' (the semi-colon here is intentional-do not remove).
+            while (*sig++ != ']');
+
+            signature->arguments.push_back(Argument('[', type));
+            break;
+        }
+        // Object references/pointers (Lua userdata) and arrays of object pointers (Lua tables of userdata).
+        case '<':
+        case '{':
+        {
+            char open = *(sig - 1);
+            char close = open == '<' ? '>' : '}';
+            std::string type = sig;
+            type = type.substr(0, type.find(close));
+
+            // Skip past the closing '>' or '}' (the semi-colon here is intentional-do not remove).
+            while (*sig++ != close);
+
+            // Calculate the unique Lua type name.
+            size_t i = type.find("::");
+            while (i != std::string::npos)
             {
-                std::string type = sig;
-                type = type.substr(0, type.find(">"));
+                // We use "" as the replacement here-this must match the preprocessor
+                // define SCOPE_REPLACEMENT from the gameplay-luagen project.
+                type.replace(i, 2, "");
+                i = type.find("::");
+            }
+
+            signature->arguments.push_back(Argument(open, type));
+            break;
+        }
+        default:
+            GP_ERROR("Invalid argument type '%d'.", *(sig - 1));
+            break;
+        }
+    }
+}
 
-                // Skip past the closing '>' (the semi-colon here is intentional-do not remove).
-                while (*sig++ != '>');
+int ScriptController::pushArguments(Signature* signature, va_list* list)
+{
+    GP_ASSERT(signature);
 
-                // Calculate the unique Lua type name.
-                size_t i = type.find("::");
-                while (i != std::string::npos)
+    int argumentCount = 0;
+    for (std::vector<Argument>::iterator itr = signature->arguments.begin(); itr != signature->arguments.end(); ++itr)
+    {
+        Argument& argument = *itr;
+        switch (argument.type)
+        {
+        case 'i':
+            lua_pushinteger(_lua, va_arg(*list, int));
+            break;
+        case 'u':
+            lua_pushunsigned(_lua, va_arg(*list, int));
+            break;
+        case 'b':
+            lua_pushboolean(_lua, va_arg(*list, int));
+            break;
+        case 'f':
+            lua_pushnumber(_lua, va_arg(*list, double));
+            break;
+        case 's':
+            lua_pushstring(_lua, va_arg(*list, char*));
+            break;
+        case 'p':
+            lua_pushlightuserdata(_lua, va_arg(*list, void*));
+            break;
+        case '[':
+        {
+            unsigned int value = va_arg(*list, int);
+
+            // Try the conversion function that handled this enum type last time first.
+            std::string enumStr = "";
+            if (argument.enumConversion >= 0)
+                enumStr = (*_stringFromEnum[argument.enumConversion])(argument.typeName, value);
+            for (unsigned int i = 0; enumStr.size() == 0 && i < _stringFromEnum.size(); i++)
+            {
+                enumStr = (*_stringFromEnum[i])(argument.typeName, value);
+                if (enumStr.size() > 0)
+                    argument.enumConversion = (int)i;
+            }
+
+            lua_pushstring(_lua, enumStr.c_str());
+            break;
+        }
+        case '<':
+        {
+            void* ptr = va_arg(*list, void*);
+            if (ptr == NULL)
+            {
+                lua_pushnil(_lua);
+            }
+            else
+            {
+                // Keep a reference to the metatable rather than looking it up by name on every call.
+                if (argument.metatable == LUA_NOREF)
                 {
-                    // We use "" as the replacement here-this must match the preprocessor
-                    // define SCOPE_REPLACEMENT from the gameplay-luagen project.
-                    type.replace(i, 2, "");
-                    i = type.find("::");
+                    luaL_getmetatable(_lua, argument.typeName.c_str());
+                    argument.metatable = luaL_ref(_lua, LUA_REGISTRYINDEX);
                 }
-
-                void* ptr = va_arg(*list, void*);
-                if (ptr == NULL)
+                lua_rawgeti(_lua, LUA_REGISTRYINDEX, argument.metatable);
+                pushUserdata(_lua, ptr, false);
+            }
+            break;
+        }
+        case '{':
+        {
+            void** objects = va_arg(*list, void**);
+            unsigned int count = va_arg(*list, unsigned int);
+            lua_createtable(_lua, (int)count, 0);
+            if (count > 0)
+            {
+                if (argument.metatable == LUA_NOREF)
                 {
-                    lua_pushnil(_lua);
+                    luaL_getmetatable(_lua, argument.typeName.c_str());
+                    argument.metatable = luaL_ref(_lua, LUA_REGISTRYINDEX);
                 }
-                else
+                for (unsigned int i = 0; i < count; i++)
                 {
-                    ScriptUtil::LuaObject* object = (ScriptUtil::LuaObject*)lua_newuserdata(_lua, sizeof(ScriptUtil::LuaObject));
-                    object->instance = ptr;
-                    object->owns = false;
-                    luaL_getmetatable(_lua, type.c_str());
-                    lua_setmetatable(_lua, -2);
+                    lua_rawgeti(_lua, LUA_REGISTRYINDEX, argument.metatable);
+                    pushUserdata(_lua, objects[i], false);
+                    lua_rawseti(_lua, -2, (int)i + 1);
                 }
-                break;
-            }
-            default:
-                GP_ERROR("Invalid argument type '%d'.", *(sig - 1));
-                break;
             }
+            break;
+        }
+        default:
+            GP_ERROR("Invalid argument type '%d'.", argument.type);
+            break;
+        }
+
+        argumentCount++;
+        luaL_checkstack(_lua, 1, "Too many arguments.");
+    }
+
+    return argumentCount;
+}
+
+void ScriptController::releaseSignature(Signature* signature)
+{
+    GP_ASSERT(signature);
+
+    for (std::vector<Argument>::iterator itr = signature->arguments.begin(); itr != signature->arguments.end(); ++itr)
+    {
+        if (_lua && itr->metatable != LUA_NOREF)
+            luaL_unref(_lua, LUA_REGISTRYINDEX, itr->metatable);
+        itr->metatable = LUA_NOREF;
+    }
+}
+
+ScriptController::Argument::Argument(char type, const std::string& typeName)
+    : type(type), typeName(typeName), metatable(LUA_NOREF), enumConversion(-1)
+{
+}
+
+ScriptFunction::ScriptFunction(ScriptController* controller, const char* func, const char* args)
+    : _controller(controller), _name(func), _lua(NULL), _ref(LUA_NOREF), _scriptGeneration(0)
+{
+    GP_ASSERT(controller);
+    ScriptController::parseSignature(args, &_signature);
+}
 
-            argumentCount++;
-            luaL_checkstack(_lua, 1, "Too many arguments.");
+ScriptFunction::~ScriptFunction()
+{
+    release();
+    if (_controller)
+        _controller->_functions.erase(this);
+}
+
+const char* ScriptFunction::getName() const
+{
+    return _name.c_str();
+}
+
+bool ScriptFunction::push()
+{
+    if (!_controller)
+        return false;
+
+    lua_State* lua = _controller->_lua;
+    GP_ASSERT(lua);
+
+    // References from a previous Lua state are gone, so start over.
+    if (_lua != lua)
+    {
+        _ref = LUA_NOREF;
+        for (std::vector<ScriptController::Argument>::iterator itr = _signature.arguments.begin(); itr != _signature.arguments.end(); ++itr)
+            itr->metatable = LUA_NOREF;
+        _lua = lua;
+    }
+
+    // Look the function up again after scripts are loaded.
+    if (_ref == LUA_NOREF || _scriptGeneration != _controller->_scriptGeneration)
+    {
+        if (_ref != LUA_NOREF)
+            luaL_unref(lua, LUA_REGISTRYINDEX, _ref);
+        _ref = LUA_NOREF;
+
+        int top = lua_gettop(lua);
+        if (!getNestedVariable(lua, _name.c_str()) || !lua_isfunction(lua, -1))
+        {
+            lua_settop(lua, top);
+            return false;
         }
+        _ref = luaL_ref(lua, LUA_REGISTRYINDEX);
+        lua_settop(lua, top);
+        _scriptGeneration = _controller->_scriptGeneration;
     }
 
-    // Perform the function call.
-    if (lua_pcall(_lua, argumentCount, resultCount, 0) != 0)
-        GP_WARN("Failed to call function '%s' with error '%s'.", func, lua_tostring(_lua, -1));
+    lua_rawgeti(lua, LUA_REGISTRYINDEX, _ref);
+    return true;
+}
+
+void ScriptFunction::release()
+{
+    // Only release references into the state they were created in.
+    if (_controller && _lua && _lua == _controller->_lua)
+    {
+        if (_ref != LUA_NOREF)
+            luaL_unref(_lua, LUA_REGISTRYINDEX, _ref);
+        _controller->releaseSignature(&_signature);
+    }
+    _ref = LUA_NOREF;
+    _lua = NULL;
 }
 
 void ScriptController::registerCallback(const char* callback, const char* function)
@@ -1079,6 +1793,85 @@ ScriptController::ScriptCallback ScriptController::toCallback(const char* name)
         return ScriptController::INVALID_CALLBACK;
 }
 
+void ScriptController::pushUserdata(lua_State* state, void* instance, bool owns)
+{
+    ScriptController* sc = Game::getInstance()->getScriptController();
+    int metatable = lua_gettop(state);
+
+    // Objects owned by Lua are always new, so only objects owned by C++ are cached.
+    // An object has one cached userdata, which is only reused while its metatable matches.
+    int cache = 0;
+    if (!owns && lua_istable(state, metatable))
+    {
+        lua_rawgetp(state, LUA_REGISTRYINDEX, &__userdataCacheKey);
+        cache = lua_gettop(state);
+        lua_rawgetp(state, cache, instance);
+        if (lua_isuserdata(state, -1) && lua_getmetatable(state, -1))
+        {
+            if (lua_rawequal(state, -1, metatable))
+            {
+                lua_pop(state, 1);
+                lua_replace(state, metatable);
+                lua_settop(state, metatable);
+                sc->_reusedUserdataCount++;
+                return;
+            }
+            lua_pop(state, 1);
+        }
+        lua_pop(state, 1);
+    }
+
+    ScriptUtil::LuaObject* object = (ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(ScriptUtil::LuaObject));
+    object->instance = instance;
+    object->owns = owns;
+    lua_pushvalue(state, metatable);
+    lua_setmetatable(state, -2);
+    sc->_createdUserdataCount++;
+
+    if (cache)
+    {
+        lua_pushvalue(state, -1);
+        lua_rawsetp(state, cache, instance);
+    }
+
+    lua_replace(state, metatable);
+    lua_settop(state, metatable);
+}
+
+void ScriptController::removeUserdata(void* instance)
+{
+    lua_State* state = __userdataCacheState;
+    if (state == NULL)
+        return;
+
+    // The Lua state is not thread safe, so objects that may have been pushed to scripts
+    // must be destroyed on the thread that runs the scripts.
+    GP_ASSERT(__scriptThread);
+
+    // The address may be reused by a new object, which must not get the userdata of this one.
+    lua_rawgetp(state, LUA_REGISTRYINDEX, &__userdataCacheKey);
+    lua_rawgetp(state, -1, instance);
+    if (!lua_isnil(state, -1))
+    {
+        lua_pushnil(state);
+        lua_rawsetp(state, -3, instance);
+    }
+    lua_pop(state, 2);
+}
+
+int ScriptController::collectSentinel(lua_State* state)
+{
+    ScriptController* sc = Game::getInstance()->getScriptController();
+    sc->_collectionCount++;
+
+    // The sentinel is unreachable, so the next sentinel is collected by the next cycle.
+    lua_newuserdata(state, 1);
+    lua_getmetatable(state, 1);
+    lua_setmetatable(state, -2);
+    lua_pop(state, 1);
+    return 0;
+}
+
 int ScriptController::convert(lua_State* state)
 {
     // Get the number of parameters.
@@ -1092,12 +1885,31 @@ int ScriptController::convert(lua_State* state)
             {
                 // Get parameter 2
                 const char* param2 = ScriptUtil::getString(2, false);
-                if (param2 != NULL)
+                ScriptUtil::LuaObject* object = (ScriptUtil::LuaObject*)lua_touserdata(state, 1);
+                if (param2 == NULL || object == NULL || lua_rawlen(state, 1) != sizeof(ScriptUtil::LuaObject))
                 {
-                    luaL_getmetatable(state, param2);
-                    lua_setmetatable(state, -3);
+                    lua_pushnil(state);
+                    return 1;
                 }
-                return 0;
+
+                // The userdata is converted in place, so scripts that ignore the return value keep working.
+                luaL_getmetatable(state, param2);
+                lua_setmetatable(state, 1);
+
+                // Objects owned by C++ have one cached userdata. It is replaced by the converted
+                // userdata, so pushing the object as the new type again returns the same value.
+                if (!object->owns)
+                {
+                    lua_rawgetp(state, LUA_REGISTRYINDEX, &__userdataCacheKey);
+                    if (lua_istable(state, -1))
+                    {
+                        lua_pushvalue(state, 1);
+                        lua_rawsetp(state, -2, object->instance);
+                    }
+                    lua_pop(state, 1);
+                }
+                lua_pushvalue(state, 1);
+                return 1;
             }
 
             lua_pushstring(state, "lua_convert - Failed to match the given parameters to a valid function signature.");
@@ -1142,6 +1954,25 @@ int ScriptController::convert(lua_State* state)
     lua_settop(_lua, top); \
     return value;
 
+#define SCRIPT_EXECUTE_HANDLE_PARAM(type, checkfunc) \
+    int top = lua_gettop(_lua); \
+    va_list list; \
+    va_start(list, function); \
+    executeFunctionHelper(1, function, &list); \
+    type value = (type)checkfunc(_lua, -1); \
+    lua_pop(_lua, -1); \
+    va_end(list); \
+    lua_settop(_lua, top); \
+    return value;
+
+#define SCRIPT_EXECUTE_HANDLE_PARAM_LIST(type, checkfunc) \
+    int top = lua_gettop(_lua); \
+    executeFunctionHelper(1, function, list); \
+    type value = (type)checkfunc(_lua, -1); \
+    lua_pop(_lua, -1); \
+    lua_settop(_lua, top); \
+    return value;
+
 template<> void ScriptController::executeFunction<void>(const char* func)
 {
     int top = lua_gettop(_lua);
@@ -1370,4 +2201,168 @@ template<> std::string ScriptController::executeFunction<std::string>(const char
     SCRIPT_EXECUTE_FUNCTION_PARAM_LIST(std::string, luaL_checkstring);
 }
 
+
+/** Template specialization. */
+template<> void ScriptController::executeFunction<void>(ScriptFunction* function, ...)
+{
+    int top = lua_gettop(_lua);
+    va_list list;
+    va_start(list, function);
+    executeFunctionHelper(0, function, &list);
+    va_end(list);
+    lua_settop(_lua, top);
+}
+
+/** Template specialization. */
+template<> bool ScriptController::executeFunction<bool>(ScriptFunction* function, ...)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM(bool, ScriptUtil::luaCheckBool);
+}
+
+/** Template specialization. */
+template<> char ScriptController::executeFunction<char>(ScriptFunction* function, ...)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM(char, luaL_checkint);
+}
+
+/** Template specialization. */
+template<> short ScriptController::executeFunction<short>(ScriptFunction* function, ...)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM(short, luaL_checkint);
+}
+
+/** Template specialization. */
+template<> int ScriptController::executeFunction<int>(ScriptFunction* function, ...)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM(int, luaL_checkint);
+}
+
+/** Template specialization. */
+template<> long ScriptController::executeFunction<long>(ScriptFunction* function, ...)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM(long, luaL_checklong);
+}
+
+/** Template specialization. */
+template<> unsigned char ScriptController::executeFunction<unsigned char>(ScriptFunction* function, ...)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM(unsigned char, luaL_checkunsigned);
+}
+
+/** Template specialization. */
+template<> unsigned short ScriptController::executeFunction<unsigned short>(ScriptFunction* function, ...)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM(unsigned short, luaL_checkunsigned);
+}
+
+/** Template specialization. */
+template<> unsigned int ScriptController::executeFunction<unsigned int>(ScriptFunction* function, ...)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM(unsigned int, luaL_checkunsigned);
+}
+
+/** Template specialization. */
+template<> unsigned long ScriptController::executeFunction<unsigned long>(ScriptFunction* function, ...)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM(unsigned long, luaL_checkunsigned);
+}
+
+/** Template specialization. */
+template<> float ScriptController::executeFunction<float>(ScriptFunction* function, ...)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM(float, luaL_checknumber);
+}
+
+/** Template specialization. */
+template<> double ScriptController::executeFunction<double>(ScriptFunction* function, ...)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM(double, luaL_checknumber);
+}
+
+/** Template specialization. */
+template<> std::string ScriptController::executeFunction<std::string>(ScriptFunction* function, ...)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM(std::string, luaL_checkstring);
+}
+
+/** Template specialization. */
+template<> void ScriptController::executeFunction<void>(ScriptFunction* function, va_list* list)
+{
+    int top = lua_gettop(_lua);
+    executeFunctionHelper(0, function, list);
+    lua_settop(_lua, top);
+}
+
+/** Template specialization. */
+template<> bool ScriptController::executeFunction<bool>(ScriptFunction* function, va_list* list)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM_LIST(bool, ScriptUtil::luaCheckBool);
+}
+
+/** Template specialization. */
+template<> char ScriptController::executeFunction<char>(ScriptFunction* function, va_list* list)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM_LIST(char, luaL_checkint);
+}
+
+/** Template specialization. */
+template<> short ScriptController::executeFunction<short>(ScriptFunction* function, va_list* list)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM_LIST(short, luaL_checkint);
+}
+
+/** Template specialization. */
+template<> int ScriptController::executeFunction<int>(ScriptFunction* function, va_list* list)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM_LIST(int, luaL_checkint);
+}
+
+/** Template specialization. */
+template<> long ScriptController::executeFunction<long>(ScriptFunction* function, va_list* list)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM_LIST(long, luaL_checklong);
+}
+
+/** Template specialization. */
+template<> unsigned char ScriptController::executeFunction<unsigned char>(ScriptFunction* function, va_list* list)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM_LIST(unsigned char, luaL_checkunsigned);
+}
+
+/** Template specialization. */
+template<> unsigned short ScriptController::executeFunction<unsigned short>(ScriptFunction* function, va_list* list)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM_LIST(unsigned short, luaL_checkunsigned);
+}
+
+/** Template specialization. */
+template<> unsigned int ScriptController::executeFunction<unsigned int>(ScriptFunction* function, va_list* list)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM_LIST(unsigned int, luaL_checkunsigned);
+}
+
+/** Template specialization. */
+template<> unsigned long ScriptController::executeFunction<unsigned long>(ScriptFunction* function, va_list* list)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM_LIST(unsigned long, luaL_checkunsigned);
+}
+
+/** Template specialization. */
+template<> float ScriptController::executeFunction<float>(ScriptFunction* function, va_list* list)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM_LIST(float, luaL_checknumber);
+}
+
+/** Template specialization. */
+template<> double ScriptController::executeFunction<double>(ScriptFunction* function, va_list* list)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM_LIST(double, luaL_checknumber);
+}
+
+/** Template specialization. */
+template<> std::string ScriptController::executeFunction<std::string>(ScriptFunction* function, va_list* list)
+{
+    SCRIPT_EXECUTE_HANDLE_PARAM_LIST(std::string, luaL_checkstring);
+}
+
 }
@@ -338,8 +338,26 @@ const char* getString(int index, bool isStdString);
  */
 bool luaCheckBool(lua_State* state, int n);
 
+/**
+ * Pushes the given object onto the stack as userdata of the given type.
+ *
+ * Objects that are not owned by Lua are cached per type, so pushing the same object
+ * again reuses its existing userdata instead of allocating a new one. The cache does
+ * not keep the userdata alive. A NULL object is pushed as nil.
+ *
+ * @param state The Lua state.
+ * @param instance The object to push.
+ * @param type The unique type name of the object (the name its class was registered with).
+ * @param owns Whether Lua owns the object (and deletes it when the userdata is collected).
+ *
+ * @script{ignore}
+ */
+void pushObject(lua_State* state, void* instance, const char* type, bool owns);
+
 }
 
+class ScriptFunction;
+
 /**
  * Controls and manages all scripts.
  */
@@ -347,9 +365,28 @@ class ScriptController
 {
     friend class Game;
     friend class Platform;
+    friend class ScriptFunction;
+    friend class Ref;
+    friend class Node;
+    friend class MaterialParameter;
 
 public:
 
+    /**
+     * Defines the modes of the Lua garbage collector.
+     *
+     * @script{ignore}
+     */
+    enum GarbageCollectionMode
+    {
+        /** The collector runs incrementally, interleaved with allocation (the Lua default). */
+        GC_INCREMENTAL,
+        /** The collector runs in generational mode. */
+        GC_GENERATIONAL,
+        /** The collector only runs in the steps taken once per frame (at least one, more within the time budget). */
+        GC_MANUAL
+    };
+
     /**
      * Loads the given script file and executes its global code.
      * 
@@ -420,6 +457,8 @@ public:
      *      - 'p' - pointer
      *      - '<object-type>' - a <b>pointer</b> to an object of the given type (where the qualified type name is enclosed by angle brackets).
      *      - '[enum-type]' - an enumerated value of the given type (where the qualified type name is enclosed by square brackets).
+     *      - '{object-type}' - an array of <b>pointers</b> to objects of the given type (where the qualified type name is enclosed
+     *          by curly braces), passed as the array followed by its element count (unsigned int) and received in Lua as a table.
      * 
      * @return The return value of the executed Lua function.
      */
@@ -445,12 +484,178 @@ public:
      *      - 'p' - pointer
      *      - '<object-type>' - a <b>pointer</b> to an object of the given type (where the qualified type name is enclosed by angle brackets).
      *      - '[enum-type]' - an enumerated value of the given type (where the qualified type name is enclosed by square brackets).
+     *      - '{object-type}' - an array of <b>pointers</b> to objects of the given type (where the qualified type name is enclosed
+     *          by curly braces), passed as the array followed by its element count (unsigned int) and received in Lua as a table.
      * @param list The variable argument list containing the function's parameters.
      * 
      * @return The return value of the executed Lua function.
      */
     template<typename T> T executeFunction(const char* func, const char* args, va_list* list);
 
+    /**
+     * Creates a handle to the specified Lua function with the given argument signature.
+     *
+     * Calling a function through a handle skips looking the function up by name and
+     * parsing its argument signature, which executeFunction otherwise does on every call.
+     * Prefer handles for functions that are called frequently (i.e. every frame or for
+     * every object in a scene).
+     *
+     * The function is looked up again the first time the handle is called after a script
+     * is loaded, so handles follow functions that are redefined by reloading scripts.
+     * Handles release their Lua references when the controller is finalized and can
+     * still be deleted safely afterwards.
+     *
+     * @param func The name of the function.
+     * @param args The argument signature of the function (see executeFunction).
+     *
+     * @return The new function handle, which must be deleted by the caller.
+     * @script{ignore}
+     */
+    ScriptFunction* createFunction(const char* func, const char* args = NULL);
+
+    /**
+     * Calls the Lua function referenced by the given handle using the given parameters.
+     *
+     * @param function The handle of the function to call.
+     *
+     * @return The return value of the executed Lua function.
+     * @script{ignore}
+     */
+    template<typename T> T executeFunction(ScriptFunction* function, ...);
+
+    /**
+     * Calls the Lua function referenced by the given handle using the given parameters.
+     *
+     * @param function The handle of the function to call.
+     * @param list The variable argument list containing the function's parameters.
+     *
+     * @return The return value of the executed Lua function.
+     * @script{ignore}
+     */
+    template<typename T> T executeFunction(ScriptFunction* function, va_list* list);
+
+    /**
+     * Gets the amount of memory currently in use by Lua, including the free space in the
+     * pages the small blocks allocated by Lua are pooled in.
+     *
+     * @return The memory in use, in bytes.
+     */
+    unsigned int getMemoryUsage() const;
+
+    /**
+     * Gets the number of garbage collection cycles Lua has completed.
+     *
+     * @return The number of completed collection cycles.
+     */
+    unsigned int getCollectionCount() const;
+
+    /**
+     * Gets the number of userdata objects allocated for C++ objects pushed to Lua.
+     *
+     * @return The number of userdata objects allocated.
+     */
+    unsigned int getCreatedUserdataCount() const;
+
+    /**
+     * Gets the number of times a C++ object pushed to Lua reused its cached userdata
+     * instead of allocating a new one.
+     *
+     * @return The number of reused userdata objects.
+     */
+    unsigned int getReusedUserdataCount() const;
+
+    /**
+     * Sets the mode of the Lua garbage collector.
+     *
+     * The default mode is GC_INCREMENTAL.
+     *
+     * @param mode The garbage collection mode.
+     * @script{ignore}
+     */
+    void setGarbageCollectionMode(GarbageCollectionMode mode);
+
+    /**
+     * Gets the mode of the Lua garbage collector.
+     *
+     * @return The garbage collection mode.
+     * @script{ignore}
+     */
+    GarbageCollectionMode getGarbageCollectionMode() const;
+
+    /**
+     * Sets the size of each explicit garbage collection step, in kilobytes.
+     *
+     * Zero (the default) takes the smallest step Lua supports, which keeps the
+     * steps taken within the time budget fine grained.
+     *
+     * @param size The step size, in kilobytes.
+     */
+    void setGarbageCollectionStepSize(int size);
+
+    /**
+     * Gets the size of each explicit garbage collection step, in kilobytes.
+     *
+     * @return The step size, in kilobytes.
+     */
+    int getGarbageCollectionStepSize() const;
+
+    /**
+     * Sets the time scripts may take each frame, in milliseconds.
+     *
+     * Once per frame, after the render callbacks, the controller takes explicit
+     * garbage collection steps with whatever is left of this budget after the
+     * script callbacks of the frame (and always at least one step, so collection
+     * keeps up). This keeps collection work at a predictable point in the frame
+     * rather than wherever allocation happens to trigger it.
+     *
+     * Zero (the default) disables the explicit steps. Explicit steps are not taken
+     * in GC_GENERATIONAL mode, since a step there is a full minor collection.
+     *
+     * @param budget The time budget, in milliseconds.
+     */
+    void setTimeBudget(float budget);
+
+    /**
+     * Gets the time scripts may take each frame, in milliseconds.
+     *
+     * @return The time budget, in milliseconds.
+     */
+    float getTimeBudget() const;
+
+    /**
+     * Gets the time spent in explicit garbage collection steps in the last frame.
+     *
+     * @return The collection time, in milliseconds.
+     */
+    float getCollectionTime() const;
+
+    /**
+     * Gets the total number of memory blocks Lua has allocated.
+     *
+     * @return The number of allocations.
+     */
+    unsigned int getAllocationCount() const;
+
+    /**
+     * Gets the time spent executing the script functions registered for the given
+     * callback in the last frame.
+     *
+     * @param callback The script callback (see registerCallback).
+     *
+     * @return The execution time, in milliseconds.
+     */
+    float getCallbackTime(const char* callback) const;
+
+    /**
+     * Gets the number of memory blocks Lua allocated while executing the script
+     * functions registered for the given callback in the last frame.
+     *
+     * @param callback The script callback (see registerCallback).
+     *
+     * @return The number of allocations.
+     */
+    unsigned int getCallbackAllocationCount(const char* callback) const;
+
     /**
      * Gets the global boolean script variable with the given name.
      * 
@@ -955,10 +1160,73 @@ private:
      *      - 'p' - pointer
      *      - '<object-type>' - a <b>pointer</b> to an object of the given type (where the qualified type name is enclosed by angle brackets).
      *      - '[enum-type]' - an enumerated value of the given type (where the qualified type name is enclosed by square brackets).
+     *      - '{object-type}' - an array of <b>pointers</b> to objects of the given type (where the qualified type name is enclosed
+     *          by curly braces), passed as the array followed by its element count (unsigned int) and received in Lua as a table.
      * @param list The variable argument list.
      */
     void executeFunctionHelper(int resultCount, const char* func, const char* args, va_list* list);
 
+    /**
+     * Calls the function referenced by the given handle, using the given arguments.
+     */
+    void executeFunctionHelper(int resultCount, ScriptFunction* function, va_list* list);
+
+    /**
+     * An argument of a parsed function signature.
+     */
+    struct Argument
+    {
+        Argument(char type, const std::string& typeName);
+
+        char type;
+        std::string typeName;
+        int metatable;
+        int enumConversion;
+    };
+
+    /**
+     * A function argument signature, parsed into its arguments.
+     */
+    struct Signature
+    {
+        std::string args;
+        std::vector<Argument> arguments;
+    };
+
+    /**
+     * A page of small blocks of a single size class, allocated aligned to its size so
+     * the page of a block is found from the block's address.
+     */
+    struct AllocationPage
+    {
+        AllocationPage* prev;
+        AllocationPage* next;
+        void* freeBlocks;
+        char* cursor;
+        size_t blockSize;
+        unsigned int blockCount;
+    };
+
+    /**
+     * Parses the given argument signature.
+     */
+    static void parseSignature(const char* args, Signature* signature);
+
+    /**
+     * Gets the parsed signature for the given argument signature string, parsing it on first use.
+     */
+    Signature* getSignature(const char* args);
+
+    /**
+     * Pushes the arguments of the given signature from the given list and returns the argument count.
+     */
+    int pushArguments(Signature* signature, va_list* list);
+
+    /**
+     * Releases the Lua references held by the given signature.
+     */
+    void releaseSignature(Signature* signature);
+
     /**
      * Converts the given string to a valid script callback enumeration value
      * or to ScriptController::INVALID_CALLBACK if there is no valid conversion.
@@ -971,12 +1239,12 @@ private:
 
     /**
      * Converts a Gameplay userdata value to the type with the given class name.
-     * This function will change the metatable of the userdata value to the metatable that matches the given string.
+     * This function converts the given userdata value in place by setting the metatable that matches the
+     * given string, and returns it. Other references to the same userdata value see the new type as well.
      * 
      * Example:
      * <code>
-     * local launchButton = form:getControl("launch")
-     * convert(launchButton, "Button")
+     * local launchButton = convert(form:getControl("launch"), "Button")
      * print("Button text: " .. launchButton:getText())
      * </code>
      * 
@@ -984,6 +1252,7 @@ private:
      * -- The signature of the lua function:
      * -- param: object    A userdata object that represents a Gameplay object.
      * -- param: className The name of the class to convert the object to. (Examples: "Button", "PhysicsRigidBody")
+     * -- return: The converted object, or nil if the object is not a Gameplay object.
      * function convert(object, className)
      * </code>
      * 
@@ -995,6 +1264,66 @@ private:
      */
     static int convert(lua_State* state);
 
+    /**
+     * Pushes the given object as userdata with the metatable (or nil) on top of the stack,
+     * which it replaces. Objects not owned by Lua reuse the userdata cached for the object
+     * if it has the same metatable.
+     */
+    static void pushUserdata(lua_State* state, void* instance, bool owns);
+
+    /**
+     * Removes the userdata cached for an object that is being destroyed.
+     *
+     * This accesses the Lua state, so it must be called on the thread that runs scripts
+     * (the main thread). Ref, Node and MaterialParameter call it from their destructors, so
+     * scriptable objects must not be destroyed on other threads.
+     *
+     * Objects that do not call this, such as value types returned by reference, are never
+     * evicted. Their cached userdata stays in the weak cache until Lua collects it, and an
+     * object of the same type created at the same address may be pushed with it.
+     *
+     * @param instance The address of the object, as pushed to Lua.
+     */
+    static void removeUserdata(void* instance);
+
+    /**
+     * Finalizer of the garbage collection sentinel: counts the completed collection
+     * cycle and creates the sentinel for the next cycle.
+     */
+    static int collectSentinel(lua_State* state);
+
+    /**
+     * Allocates memory for Lua (a lua_Alloc function), taking small blocks from pools.
+     */
+    static void* allocate(void* ud, void* ptr, size_t osize, size_t nsize);
+
+    /**
+     * Allocates a block of the given size, from the pool of its size class if it is small.
+     */
+    void* allocateBlock(size_t size);
+
+    /**
+     * Frees the given block of the given size, returning it to its pool if it is small.
+     * Pages that no longer hold any blocks are freed, except the last page of a size class.
+     */
+    void freeBlock(void* block, size_t size);
+
+    /**
+     * Applies the garbage collection mode to the Lua state.
+     */
+    void applyGarbageCollectionMode();
+
+    /**
+     * Takes the garbage collection steps for the frame within the time budget and
+     * publishes the statistics of the frame.
+     */
+    void collectGarbage();
+
+    /**
+     * Adds the time and allocations since the given start values to the statistics of the given callback.
+     */
+    void recordCallback(ScriptCallback callback, double startTime, unsigned int startAllocationCount);
+
     // Friend functions (used by Lua script bindings).
     friend void ScriptUtil::registerLibrary(const char* name, const luaL_Reg* functions);
     friend void ScriptUtil::registerConstantBool(const std::string& name, bool value, const std::vector<std::string>& scopePath);
@@ -1017,6 +1346,7 @@ private:
     friend ScriptUtil::LuaArray<double> ScriptUtil::getDoublePointer(int index);
     template<typename T> friend ScriptUtil::LuaArray<T> ScriptUtil::getObjectPointer(int index, const char* type, bool nonNull, bool* success);
     friend const char* ScriptUtil::getString(int index, bool isStdString);
+    friend void ScriptUtil::pushObject(lua_State* state, void* instance, const char* type, bool owns);
 
     lua_State* _lua;
     unsigned int _returnCount;
@@ -1024,6 +1354,87 @@ private:
     std::vector<std::string> _callbacks[CALLBACK_COUNT];
     std::set<std::string> _loadedScripts;
     std::vector<luaStringEnumConversionFunction> _stringFromEnum;
+    std::map<const char*, Signature*> _signatures;
+    std::set<ScriptFunction*> _functions;
+    unsigned int _scriptGeneration;
+    unsigned int _collectionCount;
+    unsigned int _createdUserdataCount;
+    unsigned int _reusedUserdataCount;
+    GarbageCollectionMode _garbageCollectionMode;
+    int _garbageCollectionStepSize;
+    float _timeBudget;
+    float _collectionTime;
+    unsigned int _allocationCount;
+    std::vector<AllocationPage*> _allocationPages;
+    unsigned int _allocationPageCount;
+    size_t _pooledMemoryUsage;
+    float _callbackTime[CALLBACK_COUNT];
+    unsigned int _callbackAllocationCount[CALLBACK_COUNT];
+    float _frameCallbackTime[CALLBACK_COUNT];
+    unsigned int _frameCallbackAllocationCount[CALLBACK_COUNT];
+};
+
+/**
+ * Defines a handle to a Lua function and its argument signature.
+ *
+ * Handles are created with ScriptController::createFunction and called with
+ * ScriptController::executeFunction. The handle keeps a reference to the function
+ * in the Lua registry and the argument signature parsed into typed arguments, with
+ * the metatables of object arguments and the conversions of enum arguments cached.
+ *
+ * @script{ignore}
+ */
+class ScriptFunction
+{
+    friend class ScriptController;
+
+public:
+
+    /**
+     * Destructor.
+     */
+    ~ScriptFunction();
+
+    /**
+     * Gets the name of the function.
+     *
+     * @return The name of the function.
+     */
+    const char* getName() const;
+
+private:
+
+    /**
+     * Constructor.
+     */
+    ScriptFunction(ScriptController* controller, const char* func, const char* args);
+
+    /**
+     * Hidden copy constructor.
+     */
+    ScriptFunction(const ScriptFunction& copy);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    ScriptFunction& operator=(const ScriptFunction&);
+
+    /**
+     * Pushes the function onto the Lua stack, looking it up if needed.
+     */
+    bool push();
+
+    /**
+     * Releases the Lua references held by the handle.
+     */
+    void release();
+
+    ScriptController* _controller;
+    std::string _name;
+    ScriptController::Signature _signature;
+    lua_State* _lua;
+    int _ref;
+    unsigned int _scriptGeneration;
 };
 
 /** Template specialization. */
@@ -1106,6 +1517,58 @@ template<> float ScriptController::executeFunction<float>(const char* func, cons
 template<> double ScriptController::executeFunction<double>(const char* func, const char* args, va_list* list);
 /** Template specialization. */
 template<> std::string ScriptController::executeFunction<std::string>(const char* func, const char* args, va_list* list);
+/** Template specialization. */
+template<> void ScriptController::executeFunction<void>(ScriptFunction* function, ...);
+/** Template specialization. */
+template<> bool ScriptController::executeFunction<bool>(ScriptFunction* function, ...);
+/** Template specialization. */
+template<> char ScriptController::executeFunction<char>(ScriptFunction* function, ...);
+/** Template specialization. */
+template<> short ScriptController::executeFunction<short>(ScriptFunction* function, ...);
+/** Template specialization. */
+template<> int ScriptController::executeFunction<int>(ScriptFunction* function, ...);
+/** Template specialization. */
+template<> long ScriptController::executeFunction<long>(ScriptFunction* function, ...);
+/** Template specialization. */
+template<> unsigned char ScriptController::executeFunction<unsigned char>(ScriptFunction* function, ...);
+/** Template specialization. */
+template<> unsigned short ScriptController::executeFunction<unsigned short>(ScriptFunction* function, ...);
+/** Template specialization. */
+template<> unsigned int ScriptController::executeFunction<unsigned int>(ScriptFunction* function, ...);
+/** Template specialization. */
+template<> unsigned long ScriptController::executeFunction<unsigned long>(ScriptFunction* function, ...);
+/** Template specialization. */
+template<> float ScriptController::executeFunction<float>(ScriptFunction* function, ...);
+/** Template specialization. */
+template<> double ScriptController::executeFunction<double>(ScriptFunction* function, ...);
+/** Template specialization. */
+template<> std::string ScriptController::executeFunction<std::string>(ScriptFunction* function, ...);
+/** Template specialization. */
+template<> void ScriptController::executeFunction<void>(ScriptFunction* function, va_list* list);
+/** Template specialization. */
+template<> bool ScriptController::executeFunction<bool>(ScriptFunction* function, va_list* list);
+/** Template specialization. */
+template<> char ScriptController::executeFunction<char>(ScriptFunction* function, va_list* list);
+/** Template specialization. */
+template<> short ScriptController::executeFunction<short>(ScriptFunction* function, va_list* list);
+/** Template specialization. */
+template<> int ScriptController::executeFunction<int>(ScriptFunction* function, va_list* list);
+/** Template specialization. */
+template<> long ScriptController::executeFunction<long>(ScriptFunction* function, va_list* list);
+/** Template specialization. */
+template<> unsigned char ScriptController::executeFunction<unsigned char>(ScriptFunction* function, va_list* list);
+/** Template specialization. */
+template<> unsigned short ScriptController::executeFunction<unsigned short>(ScriptFunction* function, va_list* list);
+/** Template specialization. */
+template<> unsigned int ScriptController::executeFunction<unsigned int>(ScriptFunction* function, va_list* list);
+/** Template specialization. */
+template<> unsigned long ScriptController::executeFunction<unsigned long>(ScriptFunction* function, va_list* list);
+/** Template specialization. */
+template<> float ScriptController::executeFunction<float>(ScriptFunction* function, va_list* list);
+/** Template specialization. */
+template<> double ScriptController::executeFunction<double>(ScriptFunction* function, va_list* list);
+/** Template specialization. */
+template<> std::string ScriptController::executeFunction<std::string>(ScriptFunction* function, va_list* list);
 
 }
 
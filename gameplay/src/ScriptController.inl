@@ -299,6 +299,27 @@ template<typename T> T ScriptController::executeFunction(const char* func, const
     return value;
 }
 
+template<typename T> T ScriptController::executeFunction(ScriptFunction* function, ...)
+{
+    va_list list;
+    va_start(list, function);
+    executeFunctionHelper(1, function, &list);
+
+    T value = (T)((ScriptUtil::LuaObject*)lua_touserdata(_lua, -1))->instance;
+    lua_pop(_lua, -1);
+    va_end(list);
+    return value;
+}
+
+template<typename T> T ScriptController::executeFunction(ScriptFunction* function, va_list* list)
+{
+    executeFunctionHelper(1, function, list);
+
+    T value = (T)((ScriptUtil::LuaObject*)lua_touserdata(_lua, -1))->instance;
+    lua_pop(_lua, -1);
+    return value;
+}
+
 template<typename T>T* ScriptController::getObjectPointer(const char* type, const char* name)
 {
     lua_getglobal(_lua, name);
@@ -310,11 +331,7 @@ template<typename T>T* ScriptController::getObjectPointer(const char* type, cons
 
 template<typename T>void ScriptController::setObjectPointer(const char* type, const char* name, T* v)
 {
-    ScriptUtil::LuaObject* object = (ScriptUtil::LuaObject*)lua_newuserdata(_lua, sizeof(ScriptUtil::LuaObject));
-    object->instance = (void*)v;
-    object->owns = false;
-    luaL_getmetatable(_lua, type);
-    lua_setmetatable(_lua, -2);
+    ScriptUtil::pushObject(_lua, (void*)v, type, false);
     lua_setglobal(_lua, name);
 }
 
@@ -16,6 +16,13 @@ ScriptTarget::~ScriptTarget()
     std::map<std::string, std::vector<Callback>* >::iterator iter = _callbacks.begin();
     for (; iter != _callbacks.end(); iter++)
     {
+        if (iter->second)
+        {
+            for (unsigned int i = 0; i < iter->second->size(); i++)
+            {
+                SAFE_DELETE((*iter->second)[i].handle);
+            }
+        }
         SAFE_DELETE(iter->second);
     }
 }
@@ -30,19 +37,9 @@ template<> void ScriptTarget::fireScriptEvent<void>(const char* eventName, ...)
     {
         ScriptController* sc = Game::getInstance()->getScriptController();
 
-        if (_events[eventName].size() > 0)
-        {
-            for (unsigned int i = 0; i < iter->second->size(); i++)
-            {
-                sc->executeFunction<void>((*iter->second)[i].function.c_str(), _events[eventName].c_str(), &list);
-            }
-        }
-        else
+        for (unsigned int i = 0; i < iter->second->size(); i++)
         {
-            for (unsigned int i = 0; i < iter->second->size(); i++)
-            {
-                sc->executeFunction<void>((*iter->second)[i].function.c_str(), _events[eventName].c_str());
-            }
+            sc->executeFunction<void>((*iter->second)[i].handle, &list);
         }
     }
 
@@ -59,26 +56,12 @@ template<> bool ScriptTarget::fireScriptEvent<bool>(const char* eventName, ...)
     {
         ScriptController* sc = Game::getInstance()->getScriptController();
 
-        if (_events[eventName].size() > 0)
-        {
-            for (unsigned int i = 0; i < iter->second->size(); i++)
-            {
-                if (sc->executeFunction<bool>((*iter->second)[i].function.c_str(), _events[eventName].c_str(), &list))
-                {
-                    va_end(list);
-                    return true;
-                }
-            }
-        }
-        else
+        for (unsigned int i = 0; i < iter->second->size(); i++)
         {
-            for (unsigned int i = 0; i < iter->second->size(); i++)
+            if (sc->executeFunction<bool>((*iter->second)[i].handle, &list))
             {
-                if (sc->executeFunction<bool>((*iter->second)[i].function.c_str(), _events[eventName].c_str()))
-                {
-                    va_end(list);
-                    return true;
-                }
+                va_end(list);
+                return true;
             }
         }
     }
@@ -95,9 +78,12 @@ void ScriptTarget::addScriptCallback(const std::string& eventName, const std::st
         if (!iter->second)
             iter->second = new std::vector<Callback>();
 
-        // Add the function to the list of callbacks.
-        std::string functionName = Game::getInstance()->getScriptController()->loadUrl(function.c_str());
-        iter->second->push_back(Callback(functionName));
+        // Add the function to the list of callbacks, resolving its argument signature once up front.
+        ScriptController* sc = Game::getInstance()->getScriptController();
+        std::string functionName = sc->loadUrl(function.c_str());
+        const std::string& args = _events[eventName];
+        ScriptFunction* handle = sc->createFunction(functionName.c_str(), args.size() > 0 ? args.c_str() : NULL);
+        iter->second->push_back(Callback(functionName, handle));
     }
     else
     {
@@ -126,6 +112,7 @@ void ScriptTarget::removeScriptCallback(const std::string& eventName, const std:
         {
             if ((*iter->second)[i].function == id)
             {
+                SAFE_DELETE((*iter->second)[i].handle);
                 iter->second->erase(iter->second->begin() + i);
                 return;
             }
@@ -143,7 +130,7 @@ void ScriptTarget::addScriptEvent(const std::string& eventName, const char* args
     _callbacks[eventName] = NULL;
 }
 
-ScriptTarget::Callback::Callback(const std::string& function) : function(function)
+ScriptTarget::Callback::Callback(const std::string& function, ScriptFunction* handle) : function(function), handle(handle)
 {
 }
 
@@ -6,6 +6,8 @@
 namespace gameplay
 {
 
+class ScriptFunction;
+
 /**
  * Defines an interface for supporting script callbacks.
  */
@@ -63,10 +65,12 @@ protected:
     struct Callback
     {
         /** Constructor. */
-        Callback(const std::string& string);
+        Callback(const std::string& string, ScriptFunction* handle);
 
         /** Holds the Lua script callback function. */
         std::string function;
+        /** Holds the resolved handle used to call the function (owned by the script target). */
+        ScriptFunction* handle;
     };
 
     /** Holds the supported events for this script target. */
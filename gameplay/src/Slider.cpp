@@ -62,6 +62,7 @@ void Slider::initialize(const char* typeName, Theme::Style* style, Properties* p
 void Slider::setMin(float min)
 {
     _min = min;
+    invalidateForm();
 }
 
 float Slider::getMin() const
@@ -72,6 +73,7 @@ float Slider::getMin() const
 void Slider::setMax(float max)
 {
     _max = max;
+    invalidateForm();
 }
 
 float Slider::getMax() const
@@ -82,6 +84,7 @@ float Slider::getMax() const
 void Slider::setStep(float step)
 {
     _step = step;
+    invalidateForm();
 }
 
 float Slider::getStep() const
@@ -101,6 +104,7 @@ void Slider::setValue(float value)
     if (value != _value)
     {
         _value = value;
+        invalidateForm();
         notifyListeners(Control::Listener::VALUE_CHANGED);
     }
 
@@ -131,6 +135,7 @@ bool Slider::isValueTextVisible() const
 void Slider::setValueTextAlignment(Font::Justify alignment)
 {
     _valueTextAlignment = alignment;
+    invalidateForm();
 }
 
 Font::Justify Slider::getValueTextAlignment() const
@@ -141,6 +146,7 @@ Font::Justify Slider::getValueTextAlignment() const
 void Slider::setValueTextPrecision(unsigned int precision)
 {
     _valueTextPrecision = precision;
+    invalidateForm();
 }
 
 unsigned int Slider::getValueTextPrecision() const
@@ -352,6 +352,17 @@ void SpriteBatch::draw(SpriteBatch::SpriteVertex* vertices, unsigned int vertexC
     _batch->add(vertices, vertexCount, indices, indexCount);
 }
 
+void SpriteBatch::getSprites(std::vector<SpriteBatch::SpriteVertex>* vertices, std::vector<unsigned short>* indices) const
+{
+    GP_ASSERT(vertices);
+    GP_ASSERT(indices);
+    GP_ASSERT(_batch);
+
+    const SpriteVertex* v = (const SpriteVertex*)_batch->_vertices;
+    vertices->assign(v, v + _batch->_vertexCount);
+    indices->assign(_batch->_indices, _batch->_indices + _batch->_indexCount);
+}
+
 void SpriteBatch::draw(float x, float y, float z, float width, float height, float u1, float v1, float u2, float v2, const Vector4& color, bool positionIsCenter)
 {
     // Treat the given position as the center if the user specified it as such.
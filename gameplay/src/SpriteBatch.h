@@ -26,6 +26,7 @@ class SpriteBatch
 {
     friend class Bundle;
     friend class Font;
+    friend class Form;
 
 public:
 
@@ -388,6 +389,14 @@ private:
      */
     void draw(SpriteBatch::SpriteVertex* vertices, unsigned int vertexCount, unsigned short* indices, unsigned int indexCount);
 
+    /**
+     * Copies the vertices and indices drawn since the batch was started.
+     *
+     * @param vertices Destination for the vertices.
+     * @param indices Destination for the vertex indices.
+     */
+    void getSprites(std::vector<SpriteBatch::SpriteVertex>* vertices, std::vector<unsigned short>* indices) const;
+
     /**
      * Clip position and size to fit within clip region.
      *
@@ -58,6 +58,7 @@ void TextBox::setCaretLocation(unsigned int index)
     _caretLocation = index;
     if (_caretLocation > _text.length())
         _caretLocation = (unsigned int)_text.length();
+    invalidateForm();
 }
 
 bool TextBox::touchEvent(Touch::TouchEvent evt, int x, int y, unsigned int contactIndex)
@@ -427,7 +428,10 @@ void TextBox::setCaretLocation(int x, int y)
     }
 
     if (index != -1)
+    {
         _caretLocation = index;
+        invalidateForm();
+    }
 }
 
 void TextBox::getCaretLocation(Vector2* p)
@@ -446,6 +450,7 @@ const char* TextBox::getType() const
 void TextBox::setPasswordChar(char character)
 {
     _passwordChar = character;
+    invalidateForm();
 }
 
 char TextBox::getPasswordChar() const
@@ -2,6 +2,7 @@
 #include "Image.h"
 #include "Texture.h"
 #include "FileSystem.h"
+#include "ResourceCache.h"
 
 // PVRTC (GL_IMG_texture_compression_pvrtc) : Imagination based gpus
 #ifndef GL_COMPRESSED_RGB_PVRTC_2BPPV1_IMG
@@ -47,9 +48,48 @@
 namespace gameplay
 {
 
-static std::vector<Texture*> __textureCache;
+// Cache of loaded textures.
+static ResourceCache* __textureCache = NULL;
+
+static ResourceCache* getTextureCache()
+{
+    return ResourceCache::get(&__textureCache, "Texture");
+}
 static TextureHandle __currentTextureId;
 
+/**
+ * Estimates the video memory used by a texture. Compressed textures are assumed to use
+ * 4 bits per pixel, which is the rate of DXT1, ETC1 and 4bpp PVRTC, and a full mipmap
+ * chain adds a third to the size of the base level.
+ */
+static size_t getMemoryUsage(const Texture* texture)
+{
+    size_t size = (size_t)texture->getWidth() * texture->getHeight();
+    if (texture->isCompressed())
+    {
+        size /= 2;
+    }
+    else
+    {
+        switch (texture->getFormat())
+        {
+        case Texture::ALPHA:
+            break;
+        case Texture::RGB:
+            size *= 3;
+            break;
+        default:
+            size *= 4;
+            break;
+        }
+    }
+    if (texture->isMipmapped())
+    {
+        size += size / 3;
+    }
+    return size;
+}
+
 Texture::Texture() : _handle(0), _format(UNKNOWN), _width(0), _height(0), _mipmapped(false), _cached(false), _compressed(false),
     _wrapS(Texture::REPEAT), _wrapT(Texture::REPEAT), _minFilter(Texture::NEAREST_MIPMAP_LINEAR), _magFilter(Texture::LINEAR)
 {
@@ -66,11 +106,8 @@ Texture::~Texture()
     // Remove ourself from the texture cache.
     if (_cached)
     {
-        std::vector<Texture*>::iterator itr = std::find(__textureCache.begin(), __textureCache.end(), this);
-        if (itr != __textureCache.end())
-        {
-            __textureCache.erase(itr);
-        }
+        if (__textureCache)
+            __textureCache->remove(this);
     }
 }
 
@@ -78,31 +115,30 @@ Texture* Texture::create(const char* path, bool generateMipmaps)
 {
     GP_ASSERT(path);
 
-    // Search texture cache first.
-    for (size_t i = 0, count = __textureCache.size(); i < count; ++i)
+    // Search texture cache first. Textures are cached by their resolved path, so that
+    // paths which resolve to the same file share a texture.
+    std::string key = FileSystem::resolvePath(path);
+    Texture* t = static_cast<Texture*>(getTextureCache()->find(key.c_str()));
+    if (t)
     {
-        Texture* t = __textureCache[i];
-        GP_ASSERT(t);
-        if (t->_path == path)
+        // If 'generateMipmaps' is true, call Texture::generateMipamps() to force the
+        // texture to generate its mipmap chain if it hasn't already done so.
+        if (generateMipmaps)
         {
-            // If 'generateMipmaps' is true, call Texture::generateMipamps() to force the
-            // texture to generate its mipmap chain if it hasn't already done so.
-            if (generateMipmaps)
-            {
-                t->generateMipmaps();
-            }
+            t->generateMipmaps();
+        }
 
-            // Found a match.
-            t->addRef();
+        // Found a match.
+        getTextureCache()->use(t);
+        t->addRef();
 
-            return t;
-        }
+        return t;
     }
 
     Texture* texture = NULL;
 
     // Filter loading based on file extension.
-    const char* ext = strrchr(FileSystem::resolvePath(path), '.');
+    const char* ext = strrchr(key.c_str(), '.');
     if (ext)
     {
         switch (strlen(ext))
@@ -135,7 +171,7 @@ Texture* Texture::create(const char* path, bool generateMipmaps)
         texture->_cached = true;
 
         // Add to texture cache.
-        __textureCache.push_back(texture);
+        getTextureCache()->add(key.c_str(), texture, getMemoryUsage(texture));
 
         return texture;
     }
@@ -848,6 +884,28 @@ TextureHandle Texture::getHandle() const
     return _handle;
 }
 
+void Texture::setData(int x, int y, unsigned int width, unsigned int height, const unsigned char* data)
+{
+    GP_ASSERT(data);
+
+    if (_compressed)
+    {
+        GP_WARN("Cannot update the data of compressed texture '%s'.", _path.c_str());
+        return;
+    }
+
+    GP_ASSERT(x >= 0 && y >= 0 && x + width <= _width && y + height <= _height);
+
+    GL_ASSERT( glBindTexture(GL_TEXTURE_2D, _handle) );
+    GL_ASSERT( glPixelStorei(GL_UNPACK_ALIGNMENT, 1) );
+    GL_ASSERT( glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, (GLenum)_format, GL_UNSIGNED_BYTE, data) );
+    if (_mipmapped && glGenerateMipmap)
+        GL_ASSERT( glGenerateMipmap(GL_TEXTURE_2D) );
+
+    // Restore the texture id
+    GL_ASSERT( glBindTexture(GL_TEXTURE_2D, __currentTextureId) );
+}
+
 void Texture::generateMipmaps()
 {
     if (!_mipmapped)
@@ -227,6 +227,22 @@ public:
      */
     unsigned int getHeight() const;
 
+    /**
+     * Replaces a region of the texture's image with new data.
+     *
+     * The data is expected to be tightly packed and in the same format as the texture.
+     * If the texture is mipmapped, the mipmap chain is regenerated after the update.
+     * Compressed textures cannot be updated.
+     *
+     * @param x The x offset of the region to replace.
+     * @param y The y offset of the region to replace.
+     * @param width The width of the region to replace.
+     * @param height The height of the region to replace.
+     * @param data Raw texture data (expected to be tightly packed).
+     * @script{ignore}
+     */
+    void setData(int x, int y, unsigned int width, unsigned int height, const unsigned char* data);
+
     /**
      * Generates a full mipmap chain for this texture if it isn't already mipmapped.
      */
@@ -3,11 +3,18 @@
 #include "ThemeStyle.h"
 #include "Game.h"
 #include "FileSystem.h"
+#include "ResourceCache.h"
 
 namespace gameplay
 {
 
-static std::vector<Theme*> __themeCache;
+// Cache of loaded themes.
+static ResourceCache* __themeCache = NULL;
+
+static ResourceCache* getThemeCache()
+{
+    return ResourceCache::get(&__themeCache, "Theme");
+}
 static Theme* __defaultTheme = NULL;
 
 Theme::Theme() : _texture(NULL), _spriteBatch(NULL), _emptyImage(NULL)
@@ -45,11 +52,8 @@ Theme::~Theme()
     SAFE_RELEASE(_texture);
 
     // Remove ourself from the theme cache.
-    std::vector<Theme*>::iterator itr = std::find(__themeCache.begin(), __themeCache.end(), this);
-    if (itr != __themeCache.end())
-    {
-        __themeCache.erase(itr);
-    }
+    if (__themeCache)
+        __themeCache->remove(this);
 
     SAFE_RELEASE(_emptyImage);
 
@@ -101,16 +105,15 @@ Theme* Theme::create(const char* url)
     GP_ASSERT(url);
 
     // Search theme cache first.
-    for (size_t i = 0, count = __themeCache.size(); i < count; ++i)
+    std::string key = FileSystem::resolvePath(url);
+    Theme* t = static_cast<Theme*>(getThemeCache()->find(key.c_str()));
+    if (t)
     {
-        Theme* t = __themeCache[i];
-        if (t->_url == url)
-        {
-            // Found a match.
-            t->addRef();
+        // Found a match.
+        getThemeCache()->use(t);
+        t->addRef();
 
-            return t;
-        }
+        return t;
     }
 
     // Load theme properties from file path.
@@ -495,8 +498,8 @@ Theme* Theme::create(const char* url)
         space = themeProperties->getNextNamespace();
     }
 
-    // Add this theme to the cache.
-    __themeCache.push_back(theme);
+    // Add this theme to the cache. Its texture is accounted for by the texture cache.
+    getThemeCache()->add(key.c_str(), theme);
 
     SAFE_DELETE(properties);
 
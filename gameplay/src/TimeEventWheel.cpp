@@ -0,0 +1,241 @@
+#include "Base.h"
+#include "TimeEventWheel.h"
+
+namespace gameplay
+{
+
+// Time event handles hold the event index in the low bits and its generation in the high bits.
+static const unsigned int TIME_EVENT_INDEX_MASK = 0x00FFFFFF;
+static const unsigned int TIME_EVENT_GENERATION_SHIFT = 24;
+static const unsigned int TIME_EVENT_GENERATION_MAX = 0xFF;
+
+// Values of TimeEvent::slot for events that are not linked into the wheel.
+static const int TIME_EVENT_PENDING = -1;
+static const int TIME_EVENT_FREE = -2;
+
+// Converts a game time to the millisecond tick it falls in (wrapping around after ~49 days).
+static unsigned int toTick(double time)
+{
+    return time > 0.0 ? (unsigned int)fmod(time, 4294967296.0) : 0;
+}
+
+TimeEventWheel::TimeEventWheel()
+    : _free(-1), _count(0), _tick(0), _firing(false)
+{
+    for (unsigned int i = 0; i < WHEEL_SIZE * WHEEL_LEVELS; ++i)
+    {
+        _heads[i] = -1;
+        _tails[i] = -1;
+    }
+}
+
+unsigned int TimeEventWheel::add(double now, double time, TimeListener* timeListener, void* cookie)
+{
+    // Nothing is linked when the wheel is empty, so skip straight to the current time.
+    if (_count == 0 && !_firing)
+        _tick = toTick(now);
+
+    int index;
+    if (_free >= 0)
+    {
+        index = _free;
+        _free = _events[index].next;
+    }
+    else
+    {
+        if (_events.size() >= TIME_EVENT_INDEX_MASK)
+        {
+            GP_ERROR("Too many time events are scheduled (%u).", _count);
+            return 0;
+        }
+        _events.push_back(TimeEvent());
+        index = (int)_events.size() - 1;
+        _events[index].generation = 0;
+    }
+
+    TimeEvent& event = _events[index];
+    event.time = time;
+    event.listener = timeListener;
+    event.cookie = cookie;
+    // Round up so events never fire before their time.
+    event.tick = toTick(ceil(time));
+    event.generation = (event.generation % TIME_EVENT_GENERATION_MAX) + 1;
+    event.slot = TIME_EVENT_PENDING;
+    event.prev = -1;
+    event.next = -1;
+    ++_count;
+
+    // Events scheduled from a time event fire no earlier than the next frame.
+    if (_firing)
+        _pending.push_back(index);
+    else
+        link(index);
+
+    return (event.generation << TIME_EVENT_GENERATION_SHIFT) | (unsigned int)(index + 1);
+}
+
+bool TimeEventWheel::remove(unsigned int handle)
+{
+    int index = (int)(handle & TIME_EVENT_INDEX_MASK) - 1;
+    if (index < 0 || index >= (int)_events.size())
+        return false;
+
+    TimeEvent& event = _events[index];
+    if (event.slot == TIME_EVENT_FREE || event.generation != (handle >> TIME_EVENT_GENERATION_SHIFT))
+        return false;
+
+    if (event.slot == TIME_EVENT_PENDING)
+        _pending.erase(std::find(_pending.begin(), _pending.end(), index));
+    else
+        unlink(index);
+    release(index);
+    return true;
+}
+
+void TimeEventWheel::clear()
+{
+    for (unsigned int i = 0; i < WHEEL_SIZE * WHEEL_LEVELS; ++i)
+    {
+        _heads[i] = -1;
+        _tails[i] = -1;
+    }
+    for (unsigned int i = 0; i < _events.size(); ++i)
+    {
+        if (_events[i].slot != TIME_EVENT_FREE)
+            release(i);
+    }
+    _pending.clear();
+}
+
+void TimeEventWheel::fire(double frameTime)
+{
+    unsigned int target = toTick(frameTime);
+
+    _firing = true;
+    while ((int)(target - _tick) >= 0)
+    {
+        if (_count == _pending.size())
+        {
+            // Nothing left in the wheel.
+            _tick = target + 1;
+            break;
+        }
+
+        // Move the events of the next wheel down whenever this one wraps around.
+        unsigned int slot = _tick & WHEEL_MASK;
+        if (slot == 0 && cascade(1) == 0 && cascade(2) == 0)
+            cascade(3);
+        ++_tick;
+
+        // Release each event before calling its listener so it can schedule or cancel events.
+        while (_heads[slot] >= 0)
+        {
+            int index = _heads[slot];
+            unlink(index);
+            TimeEvent event = _events[index];
+            release(index);
+            if (event.listener)
+            {
+                event.listener->timeEvent(frameTime - event.time, event.cookie);
+            }
+        }
+    }
+    _firing = false;
+
+    for (std::vector<int>::const_iterator itr = _pending.begin(); itr != _pending.end(); ++itr)
+    {
+        link(*itr);
+    }
+    _pending.clear();
+}
+
+unsigned int TimeEventWheel::getEventCount() const
+{
+    return _count;
+}
+
+void TimeEventWheel::link(int index)
+{
+    TimeEvent& event = _events[index];
+
+    // Events that are already due go in the slot that is processed next.
+    unsigned int tick = (int)(event.tick - _tick) < 0 ? _tick : event.tick;
+    unsigned int delta = tick - _tick;
+    unsigned int level = 0;
+    while (level < WHEEL_LEVELS - 1 && (delta >> (WHEEL_BITS * (level + 1))) != 0)
+        ++level;
+    int slot = (int)(level * WHEEL_SIZE + ((tick >> (WHEEL_BITS * level)) & WHEEL_MASK));
+
+    // Events in a slot of the first wheel are kept sorted by time, so events that expire
+    // within the same millisecond fire in order. Events with the same time keep their order.
+    int prev = _tails[slot];
+    if (level == 0)
+    {
+        while (prev >= 0 && _events[prev].time > event.time)
+            prev = _events[prev].prev;
+    }
+
+    int next = prev >= 0 ? _events[prev].next : _heads[slot];
+    event.slot = slot;
+    event.prev = prev;
+    event.next = next;
+    if (prev >= 0)
+        _events[prev].next = index;
+    else
+        _heads[slot] = index;
+    if (next >= 0)
+        _events[next].prev = index;
+    else
+        _tails[slot] = index;
+}
+
+void TimeEventWheel::unlink(int index)
+{
+    TimeEvent& event = _events[index];
+    GP_ASSERT(event.slot >= 0);
+
+    if (event.prev >= 0)
+        _events[event.prev].next = event.next;
+    else
+        _heads[event.slot] = event.next;
+    if (event.next >= 0)
+        _events[event.next].prev = event.prev;
+    else
+        _tails[event.slot] = event.prev;
+
+    event.slot = TIME_EVENT_PENDING;
+    event.prev = -1;
+    event.next = -1;
+}
+
+void TimeEventWheel::release(int index)
+{
+    TimeEvent& event = _events[index];
+    event.listener = NULL;
+    event.cookie = NULL;
+    event.slot = TIME_EVENT_FREE;
+    event.prev = -1;
+    event.next = _free;
+    _free = index;
+    GP_ASSERT(_count > 0);
+    --_count;
+}
+
+unsigned int TimeEventWheel::cascade(unsigned int level)
+{
+    // Re-link the events of the current slot on the given wheel into the lower wheels.
+    unsigned int index = (_tick >> (WHEEL_BITS * level)) & WHEEL_MASK;
+    int slot = (int)(level * WHEEL_SIZE + index);
+    int event = _heads[slot];
+    _heads[slot] = -1;
+    _tails[slot] = -1;
+    while (event >= 0)
+    {
+        int next = _events[event].next;
+        link(event);
+        event = next;
+    }
+    return index;
+}
+
+}
@@ -0,0 +1,118 @@
+#ifndef TIMEEVENTWHEEL_H_
+#define TIMEEVENTWHEEL_H_
+
+#include "TimeListener.h"
+
+namespace gameplay
+{
+
+/**
+ * Holds the time events that are sent to TimeListeners as a result of calling Game::schedule().
+ *
+ * Events are kept in a hierarchical timing wheel: four wheels of 256 slots each bucket
+ * the events by the millisecond in which they expire, so scheduling and cancelling are
+ * constant time and firing only visits the slots that expire. Events that expire in the
+ * same millisecond fire in order of their time. Event storage is pooled and reused, and
+ * events are identified by handles that become invalid once they fire.
+ *
+ * @script{ignore}
+ */
+class TimeEventWheel
+{
+public:
+
+    /**
+     * Constructor.
+     */
+    TimeEventWheel();
+
+    /**
+     * Adds a time event.
+     *
+     * Events added while events are being fired fire no earlier than the next call to fire().
+     *
+     * @param now The current game time in milliseconds.
+     * @param time The game time at which the event fires, in milliseconds.
+     * @param timeListener The listener to call when the event fires.
+     * @param cookie The cookie data to pass to the listener.
+     *
+     * @return A handle to the event, or 0 if the event could not be added.
+     */
+    unsigned int add(double now, double time, TimeListener* timeListener, void* cookie);
+
+    /**
+     * Removes a time event that has not fired yet.
+     *
+     * @param handle The handle returned by add().
+     *
+     * @return True if the event was removed, false if it already fired or was removed.
+     */
+    bool remove(unsigned int handle);
+
+    /**
+     * Removes all time events.
+     */
+    void clear();
+
+    /**
+     * Fires all time events that are due.
+     *
+     * @param frameTime The current game time in milliseconds.
+     */
+    void fire(double frameTime);
+
+    /**
+     * Returns the number of time events that have not fired yet.
+     *
+     * @return The number of pending time events.
+     */
+    unsigned int getEventCount() const;
+
+private:
+
+    // Layout of the wheels: WHEEL_LEVELS wheels of WHEEL_SIZE slots, one millisecond per slot on the first.
+    static const unsigned int WHEEL_BITS = 8;
+    static const unsigned int WHEEL_SIZE = 1 << WHEEL_BITS;
+    static const unsigned int WHEEL_MASK = WHEEL_SIZE - 1;
+    static const unsigned int WHEEL_LEVELS = 4;
+
+    struct TimeEvent
+    {
+        double time;
+        TimeListener* listener;
+        void* cookie;
+        unsigned int tick;
+        unsigned int generation;
+        int slot;
+        int prev;
+        int next;
+    };
+
+    /**
+     * Hidden copy constructor.
+     */
+    TimeEventWheel(const TimeEventWheel& copy);
+
+    /**
+     * Hidden copy assignment operator.
+     */
+    TimeEventWheel& operator=(const TimeEventWheel&);
+
+    void link(int index);
+    void unlink(int index);
+    void release(int index);
+    unsigned int cascade(unsigned int level);
+
+    std::vector<TimeEvent> _events;
+    std::vector<int> _pending;
+    int _heads[WHEEL_SIZE * WHEEL_LEVELS];
+    int _tails[WHEEL_SIZE * WHEEL_LEVELS];
+    int _free;
+    unsigned int _count;
+    unsigned int _tick;
+    bool _firing;
+};
+
+}
+
+#endif
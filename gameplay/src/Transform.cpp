@@ -10,7 +10,7 @@ int Transform::_suspendTransformChanged(0);
 std::vector<Transform*> Transform::_transformsChanged;
 
 Transform::Transform()
-    : _matrixDirtyBits(0), _listeners(NULL)
+    : _matrixDirtyBits(0), _listenerDispatchDepth(0), _listeners(NULL)
 {
     _targetType = AnimationTarget::TRANSFORM;
     _scale.set(Vector3::one());
@@ -18,7 +18,7 @@ Transform::Transform()
 }
 
 Transform::Transform(const Vector3& scale, const Quaternion& rotation, const Vector3& translation)
-    : _matrixDirtyBits(0), _listeners(NULL)
+    : _matrixDirtyBits(0), _listenerDispatchDepth(0), _listeners(NULL)
 {
     _targetType = AnimationTarget::TRANSFORM;
     set(scale, rotation, translation);
@@ -26,7 +26,7 @@ Transform::Transform(const Vector3& scale, const Quaternion& rotation, const Vec
 }
 
 Transform::Transform(const Vector3& scale, const Matrix& rotation, const Vector3& translation)
-    : _matrixDirtyBits(0), _listeners(NULL)
+    : _matrixDirtyBits(0), _listenerDispatchDepth(0), _listeners(NULL)
 {
     _targetType = AnimationTarget::TRANSFORM;
     set(scale, rotation, translation);
@@ -34,7 +34,7 @@ Transform::Transform(const Vector3& scale, const Matrix& rotation, const Vector3
 }
 
 Transform::Transform(const Transform& copy)
-    : _matrixDirtyBits(0), _listeners(NULL)
+    : _matrixDirtyBits(0), _listenerDispatchDepth(0), _listeners(NULL)
 {
     _targetType = AnimationTarget::TRANSFORM;
     set(copy);
@@ -955,7 +955,7 @@ void Transform::addListener(Transform::Listener* listener, long cookie)
     GP_ASSERT(listener);
 
     if (_listeners == NULL)
-        _listeners = new std::list<TransformListener>();
+        _listeners = new std::vector<TransformListener>();
 
     TransformListener l;
     l.listener = listener;
@@ -969,11 +969,16 @@ void Transform::removeListener(Transform::Listener* listener)
 
     if (_listeners)
     {
-        for (std::list<TransformListener>::iterator itr = _listeners->begin(); itr != _listeners->end(); ++itr)
+        for (std::vector<TransformListener>::iterator itr = _listeners->begin(); itr != _listeners->end(); ++itr)
         {
             if ((*itr).listener == listener)
             {
-                _listeners->erase(itr);
+                // Erasing while listeners are being notified would skip the next listener,
+                // so the entry is only marked and erased after the notification.
+                if (_listenerDispatchDepth > 0)
+                    (*itr).listener = NULL;
+                else
+                    _listeners->erase(itr);
                 break;
             }
         }
@@ -984,11 +989,26 @@ void Transform::transformChanged()
 {
     if (_listeners)
     {
-        for (std::list<TransformListener>::iterator itr = _listeners->begin(); itr != _listeners->end(); ++itr)
+        // Listeners may add or remove listeners from their callback, so index the
+        // vector rather than holding an iterator into it.
+        ++_listenerDispatchDepth;
+        for (size_t i = 0; i < _listeners->size(); ++i)
         {
-            TransformListener& l = *itr;
-            GP_ASSERT(l.listener);
-            l.listener->transformChanged(this, l.cookie);
+            TransformListener l = (*_listeners)[i];
+            if (l.listener)
+                l.listener->transformChanged(this, l.cookie);
+        }
+
+        // Erase the listeners that were removed during the notification.
+        if (--_listenerDispatchDepth == 0)
+        {
+            size_t count = 0;
+            for (size_t i = 0, size = _listeners->size(); i < size; ++i)
+            {
+                if ((*_listeners)[i].listener)
+                    (*_listeners)[count++] = (*_listeners)[i];
+            }
+            _listeners->resize(count);
         }
     }
     fireScriptEvent<void>("transformChanged", this);
@@ -873,11 +873,17 @@ protected:
      * Matrix dirty bits flag.
      */
     mutable char _matrixDirtyBits;
+
+    /**
+     * The number of transformChanged() calls notifying listeners. Listeners removed
+     * while it is nonzero are marked and erased once the outermost call returns.
+     */
+    unsigned char _listenerDispatchDepth;
     
     /** 
      * List of TransformListener's on the Transform.
      */
-    std::list<TransformListener>* _listeners;
+    std::vector<TransformListener>* _listeners;
 
 private:
    
@@ -8,6 +8,9 @@
 #include "Gesture.h"
 #include "Gamepad.h"
 #include "FileSystem.h"
+#include "BufferedStream.h"
+#include "ResourceCache.h"
+#include "PoolAllocator.h"
 #include "Bundle.h"
 #include "MathUtil.h"
 #include "Logger.h"
@@ -730,18 +730,7 @@ int lua_AIMessage_static_create(lua_State* state)
                 unsigned int param4 = (unsigned int)luaL_checkunsigned(state, 4);
 
                 void* returnPtr = (void*)AIMessage::create(param1, param2, param3, param4);
-                if (returnPtr)
-                {
-                    gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                    object->instance = returnPtr;
-                    object->owns = false;
-                    luaL_getmetatable(state, "AIMessage");
-                    lua_setmetatable(state, -2);
-                }
-                else
-                {
-                    lua_pushnil(state);
-                }
+                gameplay::ScriptUtil::pushObject(state, returnPtr, "AIMessage", false);
 
                 return 1;
             }
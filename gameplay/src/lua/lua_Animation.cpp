@@ -142,18 +142,7 @@ int lua_Animation_createClip(lua_State* state)
 
                 Animation* instance = getInstance(state);
                 void* returnPtr = (void*)instance->createClip(param1, param2, param3);
-                if (returnPtr)
-                {
-                    gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                    object->instance = returnPtr;
-                    object->owns = true;
-                    luaL_getmetatable(state, "AnimationClip");
-                    lua_setmetatable(state, -2);
-                }
-                else
-                {
-                    lua_pushnil(state);
-                }
+                gameplay::ScriptUtil::pushObject(state, returnPtr, "AnimationClip", true);
 
                 return 1;
             }
@@ -224,18 +213,7 @@ int lua_Animation_getClip(lua_State* state)
                 {
                     Animation* instance = getInstance(state);
                     void* returnPtr = (void*)instance->getClip();
-                    if (returnPtr)
-                    {
-                        gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                        object->instance = returnPtr;
-                        object->owns = false;
-                        luaL_getmetatable(state, "AnimationClip");
-                        lua_setmetatable(state, -2);
-                    }
-                    else
-                    {
-                        lua_pushnil(state);
-                    }
+                    gameplay::ScriptUtil::pushObject(state, returnPtr, "AnimationClip", false);
 
                     return 1;
                 }
@@ -257,18 +235,7 @@ int lua_Animation_getClip(lua_State* state)
 
                     Animation* instance = getInstance(state);
                     void* returnPtr = (void*)instance->getClip(param1);
-                    if (returnPtr)
-                    {
-                        gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                        object->instance = returnPtr;
-                        object->owns = false;
-                        luaL_getmetatable(state, "AnimationClip");
-                        lua_setmetatable(state, -2);
-                    }
-                    else
-                    {
-                        lua_pushnil(state);
-                    }
+                    gameplay::ScriptUtil::pushObject(state, returnPtr, "AnimationClip", false);
 
                     return 1;
                 }
@@ -284,18 +251,7 @@ int lua_Animation_getClip(lua_State* state)
 
                     Animation* instance = getInstance(state);
                     void* returnPtr = (void*)instance->getClip(param1);
-                    if (returnPtr)
-                    {
-                        gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                        object->instance = returnPtr;
-                        object->owns = false;
-                        luaL_getmetatable(state, "AnimationClip");
-                        lua_setmetatable(state, -2);
-                    }
-                    else
-                    {
-                        lua_pushnil(state);
-                    }
+                    gameplay::ScriptUtil::pushObject(state, returnPtr, "AnimationClip", false);
 
                     return 1;
                 }
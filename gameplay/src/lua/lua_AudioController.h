@@ -6,6 +6,10 @@ namespace gameplay
 
 // Lua bindings for AudioController.
 int lua_AudioController__gc(lua_State* state);
+int lua_AudioController_getMaxVoices(lua_State* state);
+int lua_AudioController_getRealVoiceCount(lua_State* state);
+int lua_AudioController_getVirtualVoiceCount(lua_State* state);
+int lua_AudioController_setMaxVoices(lua_State* state);
 
 void luaRegister_AudioController();
 
@@ -10,10 +10,13 @@ int lua_AudioSource_addRef(lua_State* state);
 int lua_AudioSource_getGain(lua_State* state);
 int lua_AudioSource_getNode(lua_State* state);
 int lua_AudioSource_getPitch(lua_State* state);
+int lua_AudioSource_getPriority(lua_State* state);
 int lua_AudioSource_getRefCount(lua_State* state);
 int lua_AudioSource_getState(lua_State* state);
 int lua_AudioSource_getVelocity(lua_State* state);
 int lua_AudioSource_isLooped(lua_State* state);
+int lua_AudioSource_isStreamed(lua_State* state);
+int lua_AudioSource_isVirtual(lua_State* state);
 int lua_AudioSource_pause(lua_State* state);
 int lua_AudioSource_play(lua_State* state);
 int lua_AudioSource_release(lua_State* state);
@@ -22,6 +25,7 @@ int lua_AudioSource_rewind(lua_State* state);
 int lua_AudioSource_setGain(lua_State* state);
 int lua_AudioSource_setLooped(lua_State* state);
 int lua_AudioSource_setPitch(lua_State* state);
+int lua_AudioSource_setPriority(lua_State* state);
 int lua_AudioSource_setVelocity(lua_State* state);
 int lua_AudioSource_static_create(lua_State* state);
 int lua_AudioSource_stop(lua_State* state);
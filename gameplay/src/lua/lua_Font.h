@@ -24,7 +24,12 @@ int lua_Font_release(lua_State* state);
 int lua_Font_setCharacterSpacing(lua_State* state);
 int lua_Font_start(lua_State* state);
 int lua_Font_static_create(lua_State* state);
+int lua_Font_static_createFromTrueType(lua_State* state);
 int lua_Font_static_getJustify(lua_State* state);
+int lua_Font_static_getTextCacheHitCount(lua_State* state);
+int lua_Font_static_getTextCacheMissCount(lua_State* state);
+int lua_Font_static_getTextCacheSize(lua_State* state);
+int lua_Font_static_setTextCacheSize(lua_State* state);
 
 void luaRegister_Font();
 
@@ -68,7 +68,9 @@ int lua_Form_getY(lua_State* state);
 int lua_Form_getZIndex(lua_State* state);
 int lua_Form_hasFocus(lua_State* state);
 int lua_Form_insertControl(lua_State* state);
+int lua_Form_invalidate(lua_State* state);
 int lua_Form_isBatchingEnabled(lua_State* state);
+int lua_Form_isCachingEnabled(lua_State* state);
 int lua_Form_isChild(lua_State* state);
 int lua_Form_isContainer(lua_State* state);
 int lua_Form_isEnabled(lua_State* state);
@@ -93,6 +95,7 @@ int lua_Form_setAutoSize(lua_State* state);
 int lua_Form_setBatchingEnabled(lua_State* state);
 int lua_Form_setBorder(lua_State* state);
 int lua_Form_setBounds(lua_State* state);
+int lua_Form_setCachingEnabled(lua_State* state);
 int lua_Form_setCanFocus(lua_State* state);
 int lua_Form_setConsumeInputEvents(lua_State* state);
 int lua_Form_setCursorColor(lua_State* state);
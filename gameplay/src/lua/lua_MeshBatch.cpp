@@ -287,18 +287,7 @@ int lua_MeshBatch_getMaterial(lua_State* state)
             {
                 MeshBatch* instance = getInstance(state);
                 void* returnPtr = (void*)instance->getMaterial();
-                if (returnPtr)
-                {
-                    gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                    object->instance = returnPtr;
-                    object->owns = false;
-                    luaL_getmetatable(state, "Material");
-                    lua_setmetatable(state, -2);
-                }
-                else
-                {
-                    lua_pushnil(state);
-                }
+                gameplay::ScriptUtil::pushObject(state, returnPtr, "Material", false);
 
                 return 1;
             }
@@ -453,18 +442,7 @@ int lua_MeshBatch_static_create(lua_State* state)
                     bool param4 = gameplay::ScriptUtil::luaCheckBool(state, 4);
 
                     void* returnPtr = (void*)MeshBatch::create(*param1, param2, param3, param4);
-                    if (returnPtr)
-                    {
-                        gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                        object->instance = returnPtr;
-                        object->owns = true;
-                        luaL_getmetatable(state, "MeshBatch");
-                        lua_setmetatable(state, -2);
-                    }
-                    else
-                    {
-                        lua_pushnil(state);
-                    }
+                    gameplay::ScriptUtil::pushObject(state, returnPtr, "MeshBatch", true);
 
                     return 1;
                 }
@@ -496,18 +474,7 @@ int lua_MeshBatch_static_create(lua_State* state)
                     bool param4 = gameplay::ScriptUtil::luaCheckBool(state, 4);
 
                     void* returnPtr = (void*)MeshBatch::create(*param1, param2, param3, param4);
-                    if (returnPtr)
-                    {
-                        gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                        object->instance = returnPtr;
-                        object->owns = true;
-                        luaL_getmetatable(state, "MeshBatch");
-                        lua_setmetatable(state, -2);
-                    }
-                    else
-                    {
-                        lua_pushnil(state);
-                    }
+                    gameplay::ScriptUtil::pushObject(state, returnPtr, "MeshBatch", true);
 
                     return 1;
                 }
@@ -546,18 +513,7 @@ int lua_MeshBatch_static_create(lua_State* state)
                     unsigned int param5 = (unsigned int)luaL_checkunsigned(state, 5);
 
                     void* returnPtr = (void*)MeshBatch::create(*param1, param2, param3, param4, param5);
-                    if (returnPtr)
-                    {
-                        gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                        object->instance = returnPtr;
-                        object->owns = true;
-                        luaL_getmetatable(state, "MeshBatch");
-                        lua_setmetatable(state, -2);
-                    }
-                    else
-                    {
-                        lua_pushnil(state);
-                    }
+                    gameplay::ScriptUtil::pushObject(state, returnPtr, "MeshBatch", true);
 
                     return 1;
                 }
@@ -593,18 +549,7 @@ int lua_MeshBatch_static_create(lua_State* state)
                     unsigned int param5 = (unsigned int)luaL_checkunsigned(state, 5);
 
                     void* returnPtr = (void*)MeshBatch::create(*param1, param2, param3, param4, param5);
-                    if (returnPtr)
-                    {
-                        gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                        object->instance = returnPtr;
-                        object->owns = true;
-                        luaL_getmetatable(state, "MeshBatch");
-                        lua_setmetatable(state, -2);
-                    }
-                    else
-                    {
-                        lua_pushnil(state);
-                    }
+                    gameplay::ScriptUtil::pushObject(state, returnPtr, "MeshBatch", true);
 
                     return 1;
                 }
@@ -647,18 +592,7 @@ int lua_MeshBatch_static_create(lua_State* state)
                     unsigned int param6 = (unsigned int)luaL_checkunsigned(state, 6);
 
                     void* returnPtr = (void*)MeshBatch::create(*param1, param2, param3, param4, param5, param6);
-                    if (returnPtr)
-                    {
-                        gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                        object->instance = returnPtr;
-                        object->owns = true;
-                        luaL_getmetatable(state, "MeshBatch");
-                        lua_setmetatable(state, -2);
-                    }
-                    else
-                    {
-                        lua_pushnil(state);
-                    }
+                    gameplay::ScriptUtil::pushObject(state, returnPtr, "MeshBatch", true);
 
                     return 1;
                 }
@@ -698,18 +632,7 @@ int lua_MeshBatch_static_create(lua_State* state)
                     unsigned int param6 = (unsigned int)luaL_checkunsigned(state, 6);
 
                     void* returnPtr = (void*)MeshBatch::create(*param1, param2, param3, param4, param5, param6);
-                    if (returnPtr)
-                    {
-                        gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                        object->instance = returnPtr;
-                        object->owns = true;
-                        luaL_getmetatable(state, "MeshBatch");
-                        lua_setmetatable(state, -2);
-                    }
-                    else
-                    {
-                        lua_pushnil(state);
-                    }
+                    gameplay::ScriptUtil::pushObject(state, returnPtr, "MeshBatch", true);
 
                     return 1;
                 }
@@ -111,18 +111,7 @@ int lua_PhysicsCollisionObjectCollisionPair__init(lua_State* state)
                 }
 
                 void* returnPtr = (void*)new PhysicsCollisionObject::CollisionPair(param1, param2);
-                if (returnPtr)
-                {
-                    gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                    object->instance = returnPtr;
-                    object->owns = true;
-                    luaL_getmetatable(state, "PhysicsCollisionObjectCollisionPair");
-                    lua_setmetatable(state, -2);
-                }
-                else
-                {
-                    lua_pushnil(state);
-                }
+                gameplay::ScriptUtil::pushObject(state, returnPtr, "PhysicsCollisionObjectCollisionPair", true);
 
                 return 1;
             }
@@ -168,18 +157,7 @@ int lua_PhysicsCollisionObjectCollisionPair_objectA(lua_State* state)
     else
     {
         void* returnPtr = (void*)instance->objectA;
-        if (returnPtr)
-        {
-            gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-            object->instance = returnPtr;
-            object->owns = false;
-            luaL_getmetatable(state, "PhysicsCollisionObject");
-            lua_setmetatable(state, -2);
-        }
-        else
-        {
-            lua_pushnil(state);
-        }
+        gameplay::ScriptUtil::pushObject(state, returnPtr, "PhysicsCollisionObject", false);
 
         return 1;
     }
@@ -212,18 +190,7 @@ int lua_PhysicsCollisionObjectCollisionPair_objectB(lua_State* state)
     else
     {
         void* returnPtr = (void*)instance->objectB;
-        if (returnPtr)
-        {
-            gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-            object->instance = returnPtr;
-            object->owns = false;
-            luaL_getmetatable(state, "PhysicsCollisionObject");
-            lua_setmetatable(state, -2);
-        }
-        else
-        {
-            lua_pushnil(state);
-        }
+        gameplay::ScriptUtil::pushObject(state, returnPtr, "PhysicsCollisionObject", false);
 
         return 1;
     }
@@ -13,11 +13,22 @@ int lua_PhysicsController_createHingeConstraint(lua_State* state);
 int lua_PhysicsController_createSocketConstraint(lua_State* state);
 int lua_PhysicsController_createSpringConstraint(lua_State* state);
 int lua_PhysicsController_drawDebug(lua_State* state);
+int lua_PhysicsController_getDroppedTime(lua_State* state);
+int lua_PhysicsController_getFixedTimeStep(lua_State* state);
 int lua_PhysicsController_getGravity(lua_State* state);
+int lua_PhysicsController_getMaxSubSteps(lua_State* state);
+int lua_PhysicsController_getSkippedBodyCount(lua_State* state);
+int lua_PhysicsController_getStepTime(lua_State* state);
+int lua_PhysicsController_getSubStepBudget(lua_State* state);
+int lua_PhysicsController_getSubStepCount(lua_State* state);
+int lua_PhysicsController_getSyncedBodyCount(lua_State* state);
 int lua_PhysicsController_rayTest(lua_State* state);
 int lua_PhysicsController_removeScriptCallback(lua_State* state);
 int lua_PhysicsController_removeStatusListener(lua_State* state);
+int lua_PhysicsController_setFixedTimeStep(lua_State* state);
 int lua_PhysicsController_setGravity(lua_State* state);
+int lua_PhysicsController_setMaxSubSteps(lua_State* state);
+int lua_PhysicsController_setSubStepBudget(lua_State* state);
 int lua_PhysicsController_sweepTest(lua_State* state);
 
 void luaRegister_PhysicsController();
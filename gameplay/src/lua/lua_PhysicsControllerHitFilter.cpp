@@ -87,18 +87,7 @@ int lua_PhysicsControllerHitFilter__init(lua_State* state)
         case 0:
         {
             void* returnPtr = (void*)new PhysicsController::HitFilter();
-            if (returnPtr)
-            {
-                gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                object->instance = returnPtr;
-                object->owns = true;
-                luaL_getmetatable(state, "PhysicsControllerHitFilter");
-                lua_setmetatable(state, -2);
-            }
-            else
-            {
-                lua_pushnil(state);
-            }
+            gameplay::ScriptUtil::pushObject(state, returnPtr, "PhysicsControllerHitFilter", true);
 
             return 1;
             break;
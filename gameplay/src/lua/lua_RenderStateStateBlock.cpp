@@ -766,18 +766,7 @@ int lua_RenderStateStateBlock_static_create(lua_State* state)
         case 0:
         {
             void* returnPtr = (void*)RenderState::StateBlock::create();
-            if (returnPtr)
-            {
-                gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                object->instance = returnPtr;
-                object->owns = true;
-                luaL_getmetatable(state, "RenderStateStateBlock");
-                lua_setmetatable(state, -2);
-            }
-            else
-            {
-                lua_pushnil(state);
-            }
+            gameplay::ScriptUtil::pushObject(state, returnPtr, "RenderStateStateBlock", true);
 
             return 1;
             break;
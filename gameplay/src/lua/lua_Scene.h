@@ -24,11 +24,16 @@ int lua_Scene_reset(lua_State* state);
 int lua_Scene_setActiveCamera(lua_State* state);
 int lua_Scene_setAmbientColor(lua_State* state);
 int lua_Scene_setId(lua_State* state);
+int lua_Scene_static_FILTER_CAMERA(lua_State* state);
+int lua_Scene_static_FILTER_LIGHT(lua_State* state);
+int lua_Scene_static_FILTER_MODEL(lua_State* state);
+int lua_Scene_static_FILTER_PARTICLE_EMITTER(lua_State* state);
 int lua_Scene_static_create(lua_State* state);
 int lua_Scene_static_getScene(lua_State* state);
 int lua_Scene_static_load(lua_State* state);
 int lua_Scene_update(lua_State* state);
 int lua_Scene_visit(lua_State* state);
+int lua_Scene_visitNodes(lua_State* state);
 
 void luaRegister_Scene();
 
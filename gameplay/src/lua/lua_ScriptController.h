@@ -5,9 +5,21 @@ namespace gameplay
 {
 
 // Lua bindings for ScriptController.
+int lua_ScriptController_getAllocationCount(lua_State* state);
+int lua_ScriptController_getCallbackAllocationCount(lua_State* state);
+int lua_ScriptController_getCallbackTime(lua_State* state);
+int lua_ScriptController_getCollectionCount(lua_State* state);
+int lua_ScriptController_getCollectionTime(lua_State* state);
+int lua_ScriptController_getCreatedUserdataCount(lua_State* state);
+int lua_ScriptController_getGarbageCollectionStepSize(lua_State* state);
+int lua_ScriptController_getMemoryUsage(lua_State* state);
+int lua_ScriptController_getReusedUserdataCount(lua_State* state);
+int lua_ScriptController_getTimeBudget(lua_State* state);
 int lua_ScriptController_loadScript(lua_State* state);
 int lua_ScriptController_loadUrl(lua_State* state);
 int lua_ScriptController_registerCallback(lua_State* state);
+int lua_ScriptController_setGarbageCollectionStepSize(lua_State* state);
+int lua_ScriptController_setTimeBudget(lua_State* state);
 int lua_ScriptController_static_print(lua_State* state);
 int lua_ScriptController_unregisterCallback(lua_State* state);
 
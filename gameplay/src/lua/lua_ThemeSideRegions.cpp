@@ -88,18 +88,7 @@ int lua_ThemeSideRegions__init(lua_State* state)
         case 0:
         {
             void* returnPtr = (void*)new Theme::SideRegions();
-            if (returnPtr)
-            {
-                gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                object->instance = returnPtr;
-                object->owns = true;
-                luaL_getmetatable(state, "ThemeSideRegions");
-                lua_setmetatable(state, -2);
-            }
-            else
-            {
-                lua_pushnil(state);
-            }
+            gameplay::ScriptUtil::pushObject(state, returnPtr, "ThemeSideRegions", true);
 
             return 1;
             break;
@@ -212,18 +201,7 @@ int lua_ThemeSideRegions_static_empty(lua_State* state)
         case 0:
         {
             void* returnPtr = (void*)&(Theme::SideRegions::empty());
-            if (returnPtr)
-            {
-                gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                object->instance = returnPtr;
-                object->owns = false;
-                luaL_getmetatable(state, "ThemeSideRegions");
-                lua_setmetatable(state, -2);
-            }
-            else
-            {
-                lua_pushnil(state);
-            }
+            gameplay::ScriptUtil::pushObject(state, returnPtr, "ThemeSideRegions", false);
 
             return 1;
             break;
@@ -79,18 +79,7 @@ int lua_VertexFormatElement__init(lua_State* state)
         case 0:
         {
             void* returnPtr = (void*)new VertexFormat::Element();
-            if (returnPtr)
-            {
-                gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                object->instance = returnPtr;
-                object->owns = true;
-                luaL_getmetatable(state, "VertexFormatElement");
-                lua_setmetatable(state, -2);
-            }
-            else
-            {
-                lua_pushnil(state);
-            }
+            gameplay::ScriptUtil::pushObject(state, returnPtr, "VertexFormatElement", true);
 
             return 1;
             break;
@@ -109,18 +98,7 @@ int lua_VertexFormatElement__init(lua_State* state)
                     unsigned int param2 = (unsigned int)luaL_checkunsigned(state, 2);
 
                     void* returnPtr = (void*)new VertexFormat::Element(param1, param2);
-                    if (returnPtr)
-                    {
-                        gameplay::ScriptUtil::LuaObject* object = (gameplay::ScriptUtil::LuaObject*)lua_newuserdata(state, sizeof(gameplay::ScriptUtil::LuaObject));
-                        object->instance = returnPtr;
-                        object->owns = true;
-                        luaL_getmetatable(state, "VertexFormatElement");
-                        lua_setmetatable(state, -2);
-                    }
-                    else
-                    {
-                        lua_pushnil(state);
-                    }
+                    gameplay::ScriptUtil::pushObject(state, returnPtr, "VertexFormatElement", true);
 
                     return 1;
                 }
@@ -0,0 +1,200 @@
+#include "BenchmarkGame.h"
+#include "Atomic.h"
+#include <pthread.h>
+
+namespace gameplay
+{
+
+static const unsigned int AGENT_COUNT = 50000;
+static const unsigned int FRAME_COUNT = 200;
+static const unsigned int MAX_THREAD_COUNT = 4;
+
+/**
+ * The state of an agent, held by its node.
+ */
+struct AgentData
+{
+    unsigned int updateCount;
+    float distance;
+};
+
+/**
+ * Moves agents while they walk, and switches them between idling and walking every few updates.
+ */
+class WanderListener : public AIState::Listener
+{
+public:
+
+    WanderListener() : idle(NULL), walk(NULL) { }
+
+    void stateUpdate(AIAgent* agent, AIState* state, float elapsedTime)
+    {
+        // Use a fixed time step so that every run does the same work.
+        AgentData* data = (AgentData*)agent->getNode()->getUserPointer();
+        if (state == walk)
+            data->distance += 1.5f * 0.016f;
+        if (++data->updateCount % 8 == 0)
+            agent->getStateMachine()->setState(state == idle ? walk : idle);
+    }
+
+    AIState* idle;
+    AIState* walk;
+};
+
+/**
+ * Runs the batches of each agent update on up to MAX_THREAD_COUNT threads and times them.
+ */
+class TimingDispatcher : public AIController::Dispatcher
+{
+public:
+
+    TimingDispatcher() : threadCount(1), time(0.0), _controller(NULL), _batchCount(0), _nextBatch(0) { }
+
+    void dispatch(AIController* controller, unsigned int batchCount)
+    {
+        const double start = Game::getAbsoluteTime();
+        _controller = controller;
+        _batchCount = batchCount;
+        _nextBatch = 0;
+
+        // The game thread runs batches too.
+        pthread_t threads[MAX_THREAD_COUNT];
+        for (unsigned int i = 1; i < threadCount; ++i)
+            pthread_create(&threads[i], NULL, runBatches, this);
+        runBatches(this);
+        for (unsigned int i = 1; i < threadCount; ++i)
+            pthread_join(threads[i], NULL);
+
+        time += Game::getAbsoluteTime() - start;
+    }
+
+    unsigned int threadCount;
+    double time;
+
+private:
+
+    static void* runBatches(void* dispatcher)
+    {
+        TimingDispatcher* d = (TimingDispatcher*)dispatcher;
+        long index;
+        while ((index = atomicAdd(&d->_nextBatch, 1)) < (long)d->_batchCount)
+            d->_controller->updateBatch((unsigned int)index);
+        return NULL;
+    }
+
+    AIController* _controller;
+    unsigned int _batchCount;
+    volatile long _nextBatch;
+};
+
+/**
+ * Updates AGENT_COUNT agents running a two state machine for FRAME_COUNT frames, first on the
+ * game thread and then on MAX_THREAD_COUNT threads, and checks that both runs end the same way.
+ */
+class AIAgentBenchmark : public GameBenchmark
+{
+public:
+
+    AIAgentBenchmark() : _scene(NULL), _agentData(NULL), _run(0), _frame(0), _checksum(0.0)
+    {
+    }
+
+    void initialize()
+    {
+        _listener.idle = AIState::create("idle");
+        _listener.walk = AIState::create("walk");
+        _listener.idle->setListener(&_listener);
+        _listener.walk->setListener(&_listener);
+
+        _scene = Scene::create();
+        _agentData = new AgentData[AGENT_COUNT];
+        for (unsigned int i = 0; i < AGENT_COUNT; ++i)
+        {
+            char id[32];
+            sprintf(id, "agent%u", i);
+            Node* node = _scene->addNode(id);
+            node->setUserPointer(&_agentData[i]);
+
+            AIAgent* agent = AIAgent::create();
+            agent->getStateMachine()->addState(_listener.idle);
+            agent->getStateMachine()->addState(_listener.walk);
+            node->setAgent(agent);
+            SAFE_RELEASE(agent);
+        }
+
+        Game::getInstance()->getAIController()->setDispatcher(&_dispatcher);
+        startRun();
+    }
+
+    bool update(float elapsedTime)
+    {
+        if (++_frame < FRAME_COUNT)
+            return true;
+
+        double checksum = 0.0;
+        unsigned int walkingCount = 0;
+        for (Node* node = _scene->getFirstNode(); node; node = node->getNextSibling())
+        {
+            AgentData* data = (AgentData*)node->getUserPointer();
+            checksum += data->distance + data->updateCount;
+            if (node->getAgent()->getStateMachine()->getActiveState() == _listener.walk)
+                ++walkingCount;
+        }
+
+        printf("AIAgentBenchmark (%u threads): %u agent updates in %.3f ms (%.2f ns each), %u agents walking\n",
+            _dispatcher.threadCount, AGENT_COUNT * FRAME_COUNT, _dispatcher.time,
+            _dispatcher.time * 1e6 / (AGENT_COUNT * FRAME_COUNT), walkingCount);
+
+        if (_run == 0)
+        {
+            _checksum = checksum;
+        }
+        else if (checksum != _checksum)
+        {
+            printf("AIAgentBenchmark: the threaded run ended in a different state than the serial run\n");
+        }
+
+        if (++_run == 2)
+            return false;
+
+        _dispatcher.threadCount = MAX_THREAD_COUNT;
+        startRun();
+        return true;
+    }
+
+    void finalize()
+    {
+        Game::getInstance()->getAIController()->setDispatcher(NULL);
+        SAFE_RELEASE(_scene);
+        SAFE_DELETE_ARRAY(_agentData);
+        SAFE_RELEASE(_listener.idle);
+        SAFE_RELEASE(_listener.walk);
+    }
+
+private:
+
+    void startRun()
+    {
+        // Each run starts with all agents idle.
+        for (Node* node = _scene->getFirstNode(); node; node = node->getNextSibling())
+            node->getAgent()->getStateMachine()->setState(_listener.idle);
+        memset(_agentData, 0, sizeof(AgentData) * AGENT_COUNT);
+        _dispatcher.time = 0.0;
+        _frame = 0;
+    }
+
+    Scene* _scene;
+    AgentData* _agentData;
+    WanderListener _listener;
+    TimingDispatcher _dispatcher;
+    unsigned int _run;
+    unsigned int _frame;
+    double _checksum;
+};
+
+GameBenchmark* createAIAgentBenchmark()
+{
+    return new AIAgentBenchmark();
+}
+
+}
@@ -0,0 +1,133 @@
+#include "BenchmarkGame.h"
+#include <pthread.h>
+
+namespace gameplay
+{
+
+static const unsigned int AGENT_COUNT = 1000;
+static const unsigned int SENT_MESSAGE_COUNT = 1000000;
+static const unsigned int POSTING_THREAD_COUNT = 4;
+static const unsigned int POSTED_MESSAGE_COUNT = 250000;
+
+static std::vector<std::string> __agentIds;
+
+/**
+ * Counts the messages received by an agent.
+ */
+class CountingAgentListener : public AIAgent::Listener
+{
+public:
+
+    CountingAgentListener() : messageCount(0) { }
+
+    bool messageReceived(AIMessage* message)
+    {
+        ++messageCount;
+        return true;
+    }
+
+    unsigned int messageCount;
+};
+
+/**
+ * Posts POSTED_MESSAGE_COUNT messages to the agents in turn, as a worker thread would.
+ */
+static void* postMessages(void* sender)
+{
+    AIController* controller = Game::getInstance()->getAIController();
+    for (unsigned int i = 0; i < POSTED_MESSAGE_COUNT; ++i)
+    {
+        AIMessage* message = AIMessage::create(i, (const char*)sender, __agentIds[i % AGENT_COUNT].c_str(), 1);
+        message->setInt(0, (int)i);
+        controller->postMessage(message);
+    }
+    return NULL;
+}
+
+/**
+ * Sends messages between agents on the game thread, then posts messages from worker
+ * threads and checks that all of them are delivered by the next frame.
+ */
+class AIMessageBenchmark : public GameBenchmark
+{
+public:
+
+    AIMessageBenchmark() : _scene(NULL), _frame(0), _postEnd(0.0)
+    {
+    }
+
+    void initialize()
+    {
+        _scene = Scene::create();
+        __agentIds.resize(AGENT_COUNT);
+        for (unsigned int i = 0; i < AGENT_COUNT; ++i)
+        {
+            char id[32];
+            sprintf(id, "agent%u", i);
+            __agentIds[i] = id;
+
+            AIAgent* agent = AIAgent::create();
+            agent->setListener(&_listener);
+            _scene->addNode(id)->setAgent(agent);
+            SAFE_RELEASE(agent);
+        }
+    }
+
+    bool update(float elapsedTime)
+    {
+        if (_frame++ == 0)
+        {
+            // Sending a message from the game thread delivers it right away.
+            AIController* controller = Game::getInstance()->getAIController();
+            double start = Game::getAbsoluteTime();
+            for (unsigned int i = 0; i < SENT_MESSAGE_COUNT; ++i)
+            {
+                AIMessage* message = AIMessage::create(i, __agentIds[i % AGENT_COUNT].c_str(), __agentIds[(i + 1) % AGENT_COUNT].c_str(), 1);
+                message->setInt(0, (int)i);
+                controller->sendMessage(message);
+            }
+            reportGameBenchmark("AIController::sendMessage", SENT_MESSAGE_COUNT, start);
+            if (_listener.messageCount != SENT_MESSAGE_COUNT)
+                printf("AIMessageBenchmark: %u of %u sent messages were delivered\n", _listener.messageCount, SENT_MESSAGE_COUNT);
+            _listener.messageCount = 0;
+
+            // Posted messages are queued until the next update of the AIController.
+            const char* senders[POSTING_THREAD_COUNT] = { "worker0", "worker1", "worker2", "worker3" };
+            pthread_t threads[POSTING_THREAD_COUNT];
+            start = Game::getAbsoluteTime();
+            for (unsigned int i = 0; i < POSTING_THREAD_COUNT; ++i)
+                pthread_create(&threads[i], NULL, postMessages, (void*)senders[i]);
+            for (unsigned int i = 0; i < POSTING_THREAD_COUNT; ++i)
+                pthread_join(threads[i], NULL);
+            reportGameBenchmark("AIController::postMessage (4 threads)", POSTING_THREAD_COUNT * POSTED_MESSAGE_COUNT, start);
+            _postEnd = Game::getAbsoluteTime();
+            return true;
+        }
+
+        // The frame time includes rendering the (empty) frame as well as delivering the messages.
+        const unsigned int postedCount = POSTING_THREAD_COUNT * POSTED_MESSAGE_COUNT;
+        printf("AIMessageBenchmark: %u of %u posted messages delivered in a frame of %.3f ms\n",
+            _listener.messageCount, postedCount, Game::getAbsoluteTime() - _postEnd);
+        return false;
+    }
+
+    void finalize()
+    {
+        SAFE_RELEASE(_scene);
+        __agentIds.clear();
+    }
+
+private:
+
+    Scene* _scene;
+    CountingAgentListener _listener;
+    unsigned int _frame;
+    double _postEnd;
+};
+
+GameBenchmark* createAIMessageBenchmark()
+{
+    return new AIMessageBenchmark();
+}
+
+}
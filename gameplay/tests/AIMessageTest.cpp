@@ -0,0 +1,73 @@
+#include "Test.h"
+#include "AIMessage.h"
+#include <pthread.h>
+
+namespace gameplay
+{
+
+static const unsigned int AGENT_ID_COUNT = 2000;
+
+/**
+ * Creates a message from each agent ID in turn and records the interned sender IDs.
+ */
+static void* internAgentIds(void* senders)
+{
+    char id[32];
+    for (unsigned int i = 0; i < AGENT_ID_COUNT; ++i)
+    {
+        sprintf(id, "agent%u", i);
+        AIMessage* message = AIMessage::create(0, id, NULL, 0);
+        ((const char**)senders)[i] = message->getSender();
+        AIMessage::destroy(message);
+    }
+    return NULL;
+}
+
+void testAIMessage()
+{
+    // Messages hold interned agent IDs, so equal IDs share one string.
+    AIMessage* first = AIMessage::create(1, "alpha", "beta", 2);
+    AIMessage* second = AIMessage::create(2, "alpha", NULL, 0);
+    TEST_CHECK(first->getId() == 1 && second->getId() == 2);
+    TEST_CHECK(strcmp(first->getSender(), "alpha") == 0 && strcmp(first->getReceiver(), "beta") == 0);
+    TEST_CHECK(first->getSender() == second->getSender());
+    TEST_CHECK(strcmp(second->getReceiver(), "") == 0);
+
+    first->setString(0, "hello");
+    first->setInt(1, 42);
+    TEST_CHECK(strcmp(first->getString(0), "hello") == 0 && first->getInt(1) == 42);
+
+    // Destroyed messages are reused.
+    AIMessage::destroy(first);
+    AIMessage* reused = AIMessage::create(3, "gamma", "alpha", 1);
+    TEST_CHECK(reused == first);
+    TEST_CHECK(reused->getId() == 3 && reused->getReceiver() == second->getSender());
+    AIMessage::destroy(reused);
+    AIMessage::destroy(second);
+
+    // Threads interning the same IDs at the same time get the same strings.
+    const char** senders[2];
+    pthread_t threads[2];
+    for (unsigned int i = 0; i < 2; ++i)
+    {
+        senders[i] = new const char*[AGENT_ID_COUNT];
+        pthread_create(&threads[i], NULL, internAgentIds, senders[i]);
+    }
+    for (unsigned int i = 0; i < 2; ++i)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    unsigned int mismatchCount = 0;
+    for (unsigned int i = 0; i < AGENT_ID_COUNT; ++i)
+    {
+        char id[32];
+        sprintf(id, "agent%u", i);
+        if (senders[0][i] != senders[1][i] || strcmp(senders[0][i], id) != 0)
+            ++mismatchCount;
+    }
+    TEST_CHECK(mismatchCount == 0);
+    SAFE_DELETE_ARRAY(senders[0]);
+    SAFE_DELETE_ARRAY(senders[1]);
+}
+
+}
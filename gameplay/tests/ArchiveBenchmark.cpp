@@ -0,0 +1,87 @@
+#include "Test.h"
+#include "FileSystem.h"
+#include "Stream.h"
+
+namespace gameplay
+{
+
+static const unsigned int READ_PASSES = 5000;
+
+static const char* __archiveFiles[] =
+{
+    "hello.txt",
+    "textures/noise.bin",
+    "textures/repeat.txt",
+    "empty/empty.txt"
+};
+static const unsigned int ARCHIVE_FILE_COUNT = sizeof(__archiveFiles) / sizeof(__archiveFiles[0]);
+
+/**
+ * Reads every file under the given directory READ_PASSES times and returns the number of bytes read.
+ */
+static unsigned int readFiles(const char* name, const char* directory)
+{
+    std::string paths[ARCHIVE_FILE_COUNT];
+    for (unsigned int i = 0; i < ARCHIVE_FILE_COUNT; ++i)
+        paths[i] = std::string(directory) + __archiveFiles[i];
+
+    unsigned int byteCount = 0;
+    clock_t start = clock();
+    for (unsigned int pass = 0; pass < READ_PASSES; ++pass)
+    {
+        for (unsigned int i = 0; i < ARCHIVE_FILE_COUNT; ++i)
+        {
+            int size = 0;
+            char* data = FileSystem::readAll(paths[i].c_str(), &size);
+            TEST_CHECK(data != NULL);
+            byteCount += (unsigned int)size;
+            SAFE_DELETE_ARRAY(data);
+        }
+    }
+    reportBenchmark(name, ARCHIVE_FILE_COUNT * READ_PASSES, start);
+    return byteCount;
+}
+
+void benchmarkArchive()
+{
+    FileSystem::setResourcePath(getTestResourcePath());
+
+    // Reading many small files is dominated by opening them, which the archive does with a lookup.
+    // The files are in the operating system's cache after the first pass, so this doesn't time a cold start.
+    unsigned int looseBytes = readFiles("FileSystem::readAll loose files", "archive/");
+
+    TEST_CHECK(FileSystem::mountArchive("test.gpk", "packed/"));
+    unsigned int packedBytes = readFiles("FileSystem::readAll archive files", "packed/");
+    TEST_CHECK(packedBytes == looseBytes);
+
+    clock_t start = clock();
+    unsigned int foundCount = 0;
+    for (unsigned int pass = 0; pass < READ_PASSES; ++pass)
+    {
+        for (unsigned int i = 0; i < ARCHIVE_FILE_COUNT; ++i)
+        {
+            std::string path = std::string("packed/") + __archiveFiles[i];
+            if (FileSystem::fileExists(path.c_str()))
+                ++foundCount;
+        }
+    }
+    reportBenchmark("FileSystem::fileExists archive files", ARCHIVE_FILE_COUNT * READ_PASSES, start);
+    TEST_CHECK(foundCount == ARCHIVE_FILE_COUNT * READ_PASSES);
+    FileSystem::unmountArchive("test.gpk");
+
+    start = clock();
+    foundCount = 0;
+    for (unsigned int pass = 0; pass < READ_PASSES; ++pass)
+    {
+        for (unsigned int i = 0; i < ARCHIVE_FILE_COUNT; ++i)
+        {
+            std::string path = std::string("archive/") + __archiveFiles[i];
+            if (FileSystem::fileExists(path.c_str()))
+                ++foundCount;
+        }
+    }
+    reportBenchmark("FileSystem::fileExists loose files", ARCHIVE_FILE_COUNT * READ_PASSES, start);
+    TEST_CHECK(foundCount == ARCHIVE_FILE_COUNT * READ_PASSES);
+}
+
+}
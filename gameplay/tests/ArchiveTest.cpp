@@ -0,0 +1,85 @@
+#include "Test.h"
+#include "FileSystem.h"
+#include "Stream.h"
+
+namespace gameplay
+{
+
+/**
+ * Checks that a file read from the mounted archive matches the loose file it was packed from.
+ */
+static void compareFile(const char* name)
+{
+    std::string loosePath = std::string("archive/") + name;
+    std::string packedPath = std::string("packed/") + name;
+
+    int looseSize = 0;
+    int packedSize = 0;
+    char* loose = FileSystem::readAll(loosePath.c_str(), &looseSize);
+    char* packed = FileSystem::readAll(packedPath.c_str(), &packedSize);
+    TEST_CHECK(loose != NULL);
+    TEST_CHECK(packed != NULL);
+    TEST_CHECK(looseSize == packedSize);
+    if (loose && packed && looseSize == packedSize)
+        TEST_CHECK(memcmp(loose, packed, looseSize) == 0);
+
+    // Streams seek and read within the file.
+    Stream* stream = FileSystem::open(packedPath.c_str());
+    TEST_CHECK(stream != NULL);
+    if (stream && loose && looseSize > 16)
+    {
+        char buffer[8];
+        TEST_CHECK(stream->seek(-5, SEEK_END));
+        TEST_CHECK(stream->read(buffer, 1, sizeof(buffer)) == 5);
+        TEST_CHECK(memcmp(buffer, loose + looseSize - 5, 5) == 0);
+        TEST_CHECK(stream->eof());
+
+        TEST_CHECK(stream->seek(3, SEEK_SET) && stream->seek(2, SEEK_CUR));
+        TEST_CHECK(stream->position() == 5);
+        TEST_CHECK(stream->read(buffer, 2, 4) == 4);
+        TEST_CHECK(memcmp(buffer, loose + 5, 8) == 0);
+    }
+    SAFE_DELETE(stream);
+    SAFE_DELETE_ARRAY(loose);
+    SAFE_DELETE_ARRAY(packed);
+}
+
+void testArchive()
+{
+    FileSystem::setResourcePath(getTestResourcePath());
+
+    // test.gpk is the archive directory packed by gameplay-encoder.
+    TEST_CHECK(FileSystem::mountArchive("test.gpk", "packed/"));
+    TEST_CHECK(FileSystem::fileExists("packed/hello.txt"));
+    TEST_CHECK(!FileSystem::fileExists("packed/missing.txt"));
+    TEST_CHECK(FileSystem::open("packed/missing.txt") == NULL);
+
+    compareFile("hello.txt");
+    compareFile("textures/noise.bin");
+    compareFile("textures/repeat.txt");
+    compareFile("empty/empty.txt");
+
+    // Lines are read across the chunks the archive stream reads from the file.
+    Stream* stream = FileSystem::open("packed/hello.txt");
+    TEST_CHECK(stream != NULL);
+    if (stream)
+    {
+        char line[64];
+        TEST_CHECK(stream->readLine(line, sizeof(line)) && strcmp(line, "Hello archive\n") == 0);
+        TEST_CHECK(stream->readLine(line, sizeof(line)) && strcmp(line, "second line\n") == 0);
+        TEST_CHECK(stream->readLine(line, sizeof(line)) == NULL);
+    }
+
+    // Streams that are already open stay valid after the archive is unmounted.
+    FileSystem::unmountArchive("test.gpk");
+    TEST_CHECK(!FileSystem::fileExists("packed/hello.txt"));
+    if (stream)
+    {
+        char buffer[5];
+        TEST_CHECK(stream->seek(0, SEEK_SET));
+        TEST_CHECK(stream->read(buffer, 1, 5) == 5 && memcmp(buffer, "Hello", 5) == 0);
+    }
+    SAFE_DELETE(stream);
+}
+
+}
@@ -0,0 +1,195 @@
+#include "Test.h"
+#include "NullOpenAL.h"
+#include "AudioBuffer.h"
+#include "FileSystem.h"
+#include "Atomic.h"
+
+namespace gameplay
+{
+
+static const unsigned int SAMPLE_COUNT = 100000;
+static const unsigned int SAMPLE_RATE = 22050;
+static const char* WAVE_FILE = "stream.wav";
+
+static short sampleAt(unsigned int index)
+{
+    return (short)((index * 37) % 65521 - 32760);
+}
+
+static void writeLittleEndian(Stream* stream, unsigned int value, unsigned int size)
+{
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        unsigned char byte = (unsigned char)(value >> (i * 8));
+        stream->write(&byte, 1, 1);
+    }
+}
+
+/**
+ * Writes a 16-bit mono wave file of SAMPLE_COUNT samples.
+ */
+static bool writeWave()
+{
+    Stream* stream = FileSystem::open(WAVE_FILE, FileSystem::WRITE);
+    if (!stream)
+        return false;
+
+    const unsigned int dataSize = SAMPLE_COUNT * 2;
+    stream->write("RIFF", 1, 4);
+    writeLittleEndian(stream, 36 + dataSize, 4);
+    stream->write("WAVEfmt ", 1, 8);
+    writeLittleEndian(stream, 16, 4);
+    writeLittleEndian(stream, 1, 2);
+    writeLittleEndian(stream, 1, 2);
+    writeLittleEndian(stream, SAMPLE_RATE, 4);
+    writeLittleEndian(stream, SAMPLE_RATE * 2, 4);
+    writeLittleEndian(stream, 2, 2);
+    writeLittleEndian(stream, 16, 2);
+    stream->write("data", 1, 4);
+    writeLittleEndian(stream, dataSize, 4);
+    for (unsigned int i = 0; i < SAMPLE_COUNT; ++i)
+        writeLittleEndian(stream, (unsigned short)sampleAt(i), 2);
+    SAFE_DELETE(stream);
+    return true;
+}
+
+/**
+ * Checks that played audio data holds the samples of the wave file, starting from the given sample.
+ */
+static bool checkSamples(const std::vector<char>& played, unsigned int firstSample)
+{
+    for (size_t i = 0; i + 1 < played.size(); i += 2)
+    {
+        short sample = (short)((unsigned char)played[i] | ((unsigned char)played[i + 1] << 8));
+        if (sample != sampleAt((firstSample + (unsigned int)(i / 2)) % SAMPLE_COUNT))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Streams audio through AudioBuffer, which is only used by the engine's audio classes.
+ */
+class AudioBufferTest
+{
+public:
+
+    /**
+     * Waits for the decoding thread to fill the chunk queue of a looped stream.
+     */
+    static bool waitForDecodedChunks(AudioBuffer* buffer)
+    {
+        time_t start = time(NULL);
+        while (atomicAdd(&buffer->_streamChunkCount, 0) < STREAMING_BUFFER_QUEUE_SIZE)
+        {
+            if (time(NULL) - start > 5)
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * Plays a streamed buffer on a null OpenAL source, refilling its buffer queue as
+     * AudioSource does, until the source stops or maxSize bytes have been played.
+     */
+    static void playStream(AudioBuffer* buffer, bool looped, size_t maxSize, std::vector<char>* played)
+    {
+        ALuint source;
+        alGenSources(1, &source);
+        for (unsigned int i = 0; i < STREAMING_BUFFER_QUEUE_SIZE; ++i)
+        {
+            if (!buffer->streamData(buffer->_alBufferQueue[i], looped))
+                break;
+            alSourceQueueBuffers(source, 1, &buffer->_alBufferQueue[i]);
+        }
+        alSourcePlay(source);
+
+        while (played->size() < maxSize)
+        {
+            // Looped streams never run out, so the decoding thread always has chunks to decode ahead.
+            bool decodedAhead = !looped || waitForDecodedChunks(buffer);
+            TEST_CHECK(decodedAhead);
+            if (!decodedAhead || !playNullOpenALBuffer(source, played))
+                break;
+
+            ALint processed = 0;
+            alGetSourcei(source, AL_BUFFERS_PROCESSED, &processed);
+            while (processed-- > 0)
+            {
+                ALuint alBuffer;
+                alSourceUnqueueBuffers(source, 1, &alBuffer);
+                if (buffer->streamData(alBuffer, looped))
+                    alSourceQueueBuffers(source, 1, &alBuffer);
+            }
+
+            ALint queued = 0;
+            ALint state = 0;
+            alGetSourcei(source, AL_BUFFERS_QUEUED, &queued);
+            alGetSourcei(source, AL_SOURCE_STATE, &state);
+            if (queued > 0 && state == AL_STOPPED)
+                alSourcePlay(source);
+        }
+
+        alSourceStop(source);
+        alSourcei(source, AL_BUFFER, 0);
+        alDeleteSources(1, &source);
+    }
+
+    /**
+     * Runs the test.
+     */
+    static void run();
+};
+
+void AudioBufferTest::run()
+{
+    FileSystem::setResourcePath(getTestResourcePath());
+    TEST_CHECK(writeWave());
+
+    AudioBuffer* buffer = AudioBuffer::create(WAVE_FILE, true);
+    TEST_CHECK(buffer != NULL);
+    if (buffer)
+    {
+        TEST_CHECK(fabs(buffer->getDuration() - (float)SAMPLE_COUNT / SAMPLE_RATE) < 0.0001f);
+
+        // A looped stream continues from the start of the file, with chunks decoded on the decoding thread.
+        std::vector<char> played;
+        playStream(buffer, true, SAMPLE_COUNT * 5, &played);
+        TEST_CHECK(played.size() >= SAMPLE_COUNT * 5);
+        TEST_CHECK(checkSamples(played, 0));
+
+        // Seeking discards the chunks decoded ahead from the old position.
+        buffer->seekStreamToTime(1.0f);
+        played.clear();
+        playStream(buffer, false, SAMPLE_COUNT * 2, &played);
+        TEST_CHECK(played.size() == (SAMPLE_COUNT - SAMPLE_RATE) * 2);
+        TEST_CHECK(checkSamples(played, SAMPLE_RATE));
+
+        // A stream that isn't looped plays the file once and stops.
+        buffer->seekStreamToTime(0.0f);
+        played.clear();
+        playStream(buffer, false, SAMPLE_COUNT * 4, &played);
+        TEST_CHECK(played.size() == SAMPLE_COUNT * 2);
+        TEST_CHECK(checkSamples(played, 0));
+        TEST_CHECK(!buffer->streamData(buffer->_alBufferQueue[0], false));
+
+        // Looping can be turned on again at the end of the file.
+        played.clear();
+        playStream(buffer, true, SAMPLE_COUNT, &played);
+        TEST_CHECK(played.size() >= SAMPLE_COUNT);
+        TEST_CHECK(checkSamples(played, 0));
+    }
+
+    // Releasing the buffer stops the decoding thread and deletes its OpenAL buffers.
+    SAFE_RELEASE(buffer);
+    TEST_CHECK(getNullOpenALObjectCount() == 0);
+
+    remove((std::string(FileSystem::getResourcePath()) + WAVE_FILE).c_str());
+}
+
+void testAudioBuffer()
+{
+    AudioBufferTest::run();
+}
+
+}
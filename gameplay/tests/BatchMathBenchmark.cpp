@@ -0,0 +1,138 @@
+#include "Test.h"
+#include "BoundingBox.h"
+#include "BoundingSphere.h"
+#include "Matrix.h"
+
+namespace gameplay
+{
+
+static const unsigned int ELEMENT_COUNT = 4096;
+static const unsigned int PASSES = 250;
+
+static float batchValue(unsigned int i)
+{
+    return (float)((i * 7919) % 1000) / 50.0f - 10.0f;
+}
+
+static bool closeTo(const Vector3& a, const Vector3& b)
+{
+    return fabs(a.x - b.x) <= 1e-4f * (1.0f + fabs(b.x)) &&
+           fabs(a.y - b.y) <= 1e-4f * (1.0f + fabs(b.y)) &&
+           fabs(a.z - b.z) <= 1e-4f * (1.0f + fabs(b.z));
+}
+
+void benchmarkBatchMath()
+{
+    Matrix matrix;
+    Matrix::createRotation(Vector3(1.0f, 2.0f, 3.0f), 0.5f, &matrix);
+    matrix.scale(1.5f);
+    matrix.translate(4.0f, -5.0f, 6.0f);
+
+    // Transforming points and vectors one at a time against transforming the whole array.
+    Vector3* points = new Vector3[ELEMENT_COUNT];
+    Vector3* looped = new Vector3[ELEMENT_COUNT];
+    Vector3* batched = new Vector3[ELEMENT_COUNT];
+    for (unsigned int i = 0; i < ELEMENT_COUNT; ++i)
+        points[i].set(batchValue(i * 3), batchValue(i * 3 + 1), batchValue(i * 3 + 2));
+
+    clock_t start = clock();
+    for (unsigned int pass = 0; pass < PASSES; ++pass)
+    {
+        for (unsigned int i = 0; i < ELEMENT_COUNT; ++i)
+            matrix.transformPoint(points[i], &looped[i]);
+    }
+    reportBenchmark("Matrix::transformPoint loop", ELEMENT_COUNT * PASSES, start);
+
+    start = clock();
+    for (unsigned int pass = 0; pass < PASSES; ++pass)
+        matrix.transformPoints(points, ELEMENT_COUNT, batched);
+    reportBenchmark("Matrix::transformPoints", ELEMENT_COUNT * PASSES, start);
+    for (unsigned int i = 0; i < ELEMENT_COUNT; ++i)
+        TEST_CHECK(closeTo(batched[i], looped[i]));
+
+    start = clock();
+    for (unsigned int pass = 0; pass < PASSES; ++pass)
+    {
+        for (unsigned int i = 0; i < ELEMENT_COUNT; ++i)
+            matrix.transformVector(points[i], &looped[i]);
+    }
+    reportBenchmark("Matrix::transformVector loop", ELEMENT_COUNT * PASSES, start);
+
+    start = clock();
+    for (unsigned int pass = 0; pass < PASSES; ++pass)
+        matrix.transformVectors(points, ELEMENT_COUNT, batched);
+    reportBenchmark("Matrix::transformVectors", ELEMENT_COUNT * PASSES, start);
+    for (unsigned int i = 0; i < ELEMENT_COUNT; ++i)
+        TEST_CHECK(closeTo(batched[i], looped[i]));
+
+    // Transforming bounding boxes, as nodes do for their world bounds.
+    BoundingBox* boxes = new BoundingBox[ELEMENT_COUNT];
+    BoundingBox* loopedBoxes = new BoundingBox[ELEMENT_COUNT];
+    BoundingBox* batchedBoxes = new BoundingBox[ELEMENT_COUNT];
+    for (unsigned int i = 0; i < ELEMENT_COUNT; ++i)
+    {
+        float size = 0.5f + (float)(i % 7);
+        boxes[i].set(points[i], points[i] + Vector3(size, size * 0.5f, size * 2.0f));
+    }
+
+    start = clock();
+    for (unsigned int pass = 0; pass < PASSES; ++pass)
+    {
+        for (unsigned int i = 0; i < ELEMENT_COUNT; ++i)
+        {
+            loopedBoxes[i] = boxes[i];
+            loopedBoxes[i].transform(matrix);
+        }
+    }
+    reportBenchmark("BoundingBox::transform loop", ELEMENT_COUNT * PASSES, start);
+
+    start = clock();
+    for (unsigned int pass = 0; pass < PASSES; ++pass)
+        BoundingBox::transform(boxes, ELEMENT_COUNT, matrix, batchedBoxes);
+    reportBenchmark("BoundingBox::transform array", ELEMENT_COUNT * PASSES, start);
+    TEST_CHECK(memcmp(batchedBoxes, loopedBoxes, sizeof(BoundingBox) * ELEMENT_COUNT) == 0);
+
+    // Merging bounding spheres, as a scene does to bound its nodes.
+    BoundingSphere* spheres = new BoundingSphere[ELEMENT_COUNT];
+    for (unsigned int i = 0; i < ELEMENT_COUNT; ++i)
+        spheres[i].set(points[i], 0.5f + (float)(i % 5));
+
+    BoundingSphere loopedSphere;
+    start = clock();
+    for (unsigned int pass = 0; pass < PASSES; ++pass)
+    {
+        loopedSphere = spheres[0];
+        for (unsigned int i = 1; i < ELEMENT_COUNT; ++i)
+            loopedSphere.merge(spheres[i]);
+    }
+    reportBenchmark("BoundingSphere::merge loop", ELEMENT_COUNT * PASSES, start);
+
+    BoundingSphere batchedSphere;
+    start = clock();
+    for (unsigned int pass = 0; pass < PASSES; ++pass)
+    {
+        batchedSphere = spheres[0];
+        batchedSphere.merge(spheres + 1, ELEMENT_COUNT - 1);
+    }
+    reportBenchmark("BoundingSphere::merge array", ELEMENT_COUNT * PASSES, start);
+    printf("BoundingSphere::merge radius: %.3f looped, %.3f array\n", loopedSphere.radius, batchedSphere.radius);
+
+    // Both merges must bound every sphere.
+    for (unsigned int i = 0; i < ELEMENT_COUNT; ++i)
+    {
+        float reach = spheres[i].center.distance(batchedSphere.center) + spheres[i].radius;
+        TEST_CHECK(reach <= batchedSphere.radius * 1.0001f);
+        reach = spheres[i].center.distance(loopedSphere.center) + spheres[i].radius;
+        TEST_CHECK(reach <= loopedSphere.radius * 1.0001f);
+    }
+
+    SAFE_DELETE_ARRAY(points);
+    SAFE_DELETE_ARRAY(looped);
+    SAFE_DELETE_ARRAY(batched);
+    SAFE_DELETE_ARRAY(boxes);
+    SAFE_DELETE_ARRAY(loopedBoxes);
+    SAFE_DELETE_ARRAY(batchedBoxes);
+    SAFE_DELETE_ARRAY(spheres);
+}
+
+}
@@ -0,0 +1,84 @@
+#include "BenchmarkGame.h"
+
+using namespace gameplay;
+
+// Declare our game instance
+BenchmarkGame game;
+
+namespace gameplay
+{
+
+void reportGameBenchmark(const char* name, unsigned int operationCount, double start)
+{
+    const double milliseconds = Game::getAbsoluteTime() - start;
+    printf("%s: %u operations in %.3f ms (%.2f ns each)\n", name, operationCount, milliseconds,
+        operationCount ? milliseconds * 1e6 / operationCount : 0.0);
+}
+
+}
+
+struct BenchmarkCase
+{
+    const char* name;
+    GameBenchmark* (*create)();
+};
+
+static const BenchmarkCase __benchmarks[] =
+{
+    { "PhysicsBenchmark", createPhysicsBenchmark },
+    { "AIMessageBenchmark", createAIMessageBenchmark },
+    { "AIAgentBenchmark", createAIAgentBenchmark },
+    { "SceneVisitBenchmark", createSceneVisitBenchmark }
+};
+
+BenchmarkGame::BenchmarkGame() : _benchmark(NULL)
+{
+}
+
+void BenchmarkGame::initialize()
+{
+    int argc = 0;
+    char** argv = NULL;
+    getArguments(&argc, &argv);
+    const char* name = argc > 1 ? argv[1] : "";
+    if (argc > 2)
+        FileSystem::setResourcePath(argv[2]);
+
+    for (unsigned int i = 0; i < sizeof(__benchmarks) / sizeof(__benchmarks[0]); ++i)
+    {
+        if (strcmp(name, __benchmarks[i].name) == 0)
+            _benchmark = __benchmarks[i].create();
+    }
+    if (!_benchmark)
+        GP_ERROR("Unknown benchmark '%s'.", name);
+
+    // Run frames as fast as possible rather than at the display's refresh rate.
+    setVsync(false);
+
+    _benchmark->initialize();
+}
+
+void BenchmarkGame::finalize()
+{
+    if (_benchmark)
+    {
+        _benchmark->finalize();
+        SAFE_DELETE(_benchmark);
+    }
+}
+
+void BenchmarkGame::update(float elapsedTime)
+{
+    if (_benchmark && !_benchmark->update(elapsedTime))
+    {
+        // Exiting may end the process right away, so finish the benchmark first.
+        _benchmark->finalize();
+        SAFE_DELETE(_benchmark);
+        exit();
+    }
+}
+
+void BenchmarkGame::render(float elapsedTime)
+{
+    clear(CLEAR_COLOR_DEPTH, Vector4::zero(), 1.0f, 0);
+}
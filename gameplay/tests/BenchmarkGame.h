@@ -0,0 +1,99 @@
+#ifndef BENCHMARKGAME_H_
+#define BENCHMARKGAME_H_
+
+#include "gameplay.h"
+
+namespace gameplay
+{
+
+/**
+ * A benchmark of engine systems that only run inside a game, driven one frame at a time.
+ */
+class GameBenchmark
+{
+public:
+
+    /**
+     * Destructor.
+     */
+    virtual ~GameBenchmark() { }
+
+    /**
+     * Sets up the benchmark. Called from Game::initialize.
+     */
+    virtual void initialize() = 0;
+
+    /**
+     * Runs one frame of the benchmark. Called from Game::update, after the engine
+     * has updated its controllers for the frame.
+     *
+     * @param elapsedTime The elapsed time since the last frame, in milliseconds.
+     *
+     * @return True to run another frame, false once the benchmark has finished.
+     */
+    virtual bool update(float elapsedTime) = 0;
+
+    /**
+     * Releases the resources of the benchmark. Called once it has finished.
+     */
+    virtual void finalize() = 0;
+};
+
+/**
+ * Prints how long a benchmark took in total and per operation.
+ *
+ * @param name The name of the benchmark.
+ * @param operationCount The number of operations timed.
+ * @param start The time when the benchmark started, from Game::getAbsoluteTime().
+ */
+void reportGameBenchmark(const char* name, unsigned int operationCount, double start);
+
+GameBenchmark* createPhysicsBenchmark();
+GameBenchmark* createAIMessageBenchmark();
+GameBenchmark* createAIAgentBenchmark();
+GameBenchmark* createSceneVisitBenchmark();
+
+/**
+ * Runs the benchmark named on the command line, then exits.
+ *
+ * Usage: gameplay-benchmarks <benchmark name> [resource path]
+ */
+class BenchmarkGame : public Game
+{
+public:
+
+    /**
+     * Constructor.
+     */
+    BenchmarkGame();
+
+protected:
+
+    /**
+     * @see Game::initialize
+     */
+    void initialize();
+
+    /**
+     * @see Game::finalize
+     */
+    void finalize();
+
+    /**
+     * @see Game::update
+     */
+    void update(float elapsedTime);
+
+    /**
+     * @see Game::render
+     */
+    void render(float elapsedTime);
+
+private:
+
+    GameBenchmark* _benchmark;
+};
+
+}
+
+#endif
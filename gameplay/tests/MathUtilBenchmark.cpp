@@ -0,0 +1,85 @@
+#include "Test.h"
+#include "ScalarMathUtil.h"
+#include "Matrix.h"
+#include "Vector3.h"
+
+namespace gameplay
+{
+
+static const unsigned int MATRIX_COUNT = 1024;
+static const unsigned int MATRIX_PASSES = 1000;
+static const unsigned int POINT_COUNT = 4096;
+static const unsigned int POINT_PASSES = 250;
+
+static void fillFloats(float* values, unsigned int count)
+{
+    for (unsigned int i = 0; i < count; ++i)
+        values[i] = (float)((i * 7919) % 1000) / 500.0f - 1.0f;
+}
+
+void benchmarkMathUtil()
+{
+    Matrix* m1 = new Matrix[MATRIX_COUNT];
+    Matrix* m2 = new Matrix[MATRIX_COUNT];
+    Matrix* products = new Matrix[MATRIX_COUNT];
+    Matrix* scalarProducts = new Matrix[MATRIX_COUNT];
+    fillFloats(m1[0].m, MATRIX_COUNT * 16);
+    fillFloats(m2[0].m, MATRIX_COUNT * 16);
+
+    // Multiplying matrices one at a time, as transforms and nodes do.
+    clock_t start = clock();
+    for (unsigned int pass = 0; pass < MATRIX_PASSES; ++pass)
+    {
+        for (unsigned int i = 0; i < MATRIX_COUNT; ++i)
+            Matrix::multiply(m1[i], m2[i], &products[i]);
+    }
+    reportBenchmark("Matrix::multiply", MATRIX_COUNT * MATRIX_PASSES, start);
+
+    start = clock();
+    for (unsigned int pass = 0; pass < MATRIX_PASSES; ++pass)
+    {
+        for (unsigned int i = 0; i < MATRIX_COUNT; ++i)
+            ScalarMathUtil::multiplyMatrix(m1[i].m, m2[i].m, scalarProducts[i].m);
+    }
+    reportBenchmark("scalar multiplyMatrix", MATRIX_COUNT * MATRIX_PASSES, start);
+    TEST_CHECK(memcmp(products, scalarProducts, sizeof(Matrix) * MATRIX_COUNT) == 0);
+
+    // Multiplying arrays of matrices, as skinning does.
+    start = clock();
+    for (unsigned int pass = 0; pass < MATRIX_PASSES; ++pass)
+        Matrix::multiply(m1, m2, MATRIX_COUNT, products);
+    reportBenchmark("Matrix::multiply array", MATRIX_COUNT * MATRIX_PASSES, start);
+
+    start = clock();
+    for (unsigned int pass = 0; pass < MATRIX_PASSES; ++pass)
+        ScalarMathUtil::multiplyMatrixArray(m1[0].m, m2[0].m, MATRIX_COUNT, scalarProducts[0].m);
+    reportBenchmark("scalar multiplyMatrixArray", MATRIX_COUNT * MATRIX_PASSES, start);
+    TEST_CHECK(memcmp(products, scalarProducts, sizeof(Matrix) * MATRIX_COUNT) == 0);
+
+    // Transforming arrays of points, as bounding volumes and particles do.
+    Vector3* points = new Vector3[POINT_COUNT];
+    Vector3* transformed = new Vector3[POINT_COUNT];
+    float* scalarTransformed = new float[POINT_COUNT * 3];
+    fillFloats(&points[0].x, POINT_COUNT * 3);
+
+    start = clock();
+    for (unsigned int pass = 0; pass < POINT_PASSES; ++pass)
+        m1[pass].transformPoints(points, POINT_COUNT, transformed);
+    reportBenchmark("Matrix::transformPoints", POINT_COUNT * POINT_PASSES, start);
+
+    start = clock();
+    for (unsigned int pass = 0; pass < POINT_PASSES; ++pass)
+        ScalarMathUtil::transformVector3Array(m1[pass].m, &points[0].x, 1.0f, POINT_COUNT, scalarTransformed);
+    reportBenchmark("scalar transformVector3Array", POINT_COUNT * POINT_PASSES, start);
+    TEST_CHECK(memcmp(transformed, scalarTransformed, sizeof(float) * POINT_COUNT * 3) == 0);
+
+    SAFE_DELETE_ARRAY(m1);
+    SAFE_DELETE_ARRAY(m2);
+    SAFE_DELETE_ARRAY(products);
+    SAFE_DELETE_ARRAY(scalarProducts);
+    SAFE_DELETE_ARRAY(points);
+    SAFE_DELETE_ARRAY(transformed);
+    SAFE_DELETE_ARRAY(scalarTransformed);
+}
+
+}
@@ -0,0 +1,166 @@
+#include "Test.h"
+#include "ScalarMathUtil.h"
+#include "Matrix.h"
+#include "Vector3.h"
+#include "Vector4.h"
+
+namespace gameplay
+{
+
+static const unsigned int MATRIX_COUNT = 64;
+static const unsigned int VECTOR_COUNT = 256;
+
+static unsigned int __seed = 1;
+
+/**
+ * Returns a pseudo-random value, mixing in signed zeros, tiny and large values.
+ */
+static float randomValue()
+{
+    __seed = __seed * 1664525 + 1013904223;
+    switch (__seed >> 28)
+    {
+    case 0:
+        return 0.0f;
+    case 1:
+        return -0.0f;
+    case 2:
+        return ((__seed >> 8) & 0xffff) * 1e-30f;
+    case 3:
+        return -((float)((__seed >> 8) & 0xffff)) * 1e20f;
+    default:
+        return ((float)((__seed >> 8) & 0xfffff) / (float)0x80000) - 1.0f;
+    }
+}
+
+static void randomFloats(float* values, unsigned int count)
+{
+    for (unsigned int i = 0; i < count; ++i)
+        values[i] = randomValue();
+}
+
+static bool equalBits(const void* a, const void* b, size_t size)
+{
+    return memcmp(a, b, size) == 0;
+}
+
+void testMathUtil()
+{
+    Matrix* m1 = new Matrix[MATRIX_COUNT];
+    Matrix* m2 = new Matrix[MATRIX_COUNT];
+    Matrix* products = new Matrix[MATRIX_COUNT];
+    randomFloats(m1[0].m, MATRIX_COUNT * 16);
+    randomFloats(m2[0].m, MATRIX_COUNT * 16);
+
+    // Matrix operations match the scalar routines bit for bit.
+    unsigned int mismatchCount = 0;
+    for (unsigned int i = 0; i < MATRIX_COUNT; ++i)
+    {
+        Matrix& a = m1[i];
+        const Matrix& b = m2[i];
+        const float scalar = randomValue();
+        Matrix simd;
+        float scalarResult[16];
+
+        a.add(scalar, &simd);
+        ScalarMathUtil::addMatrix(a.m, scalar, scalarResult);
+        mismatchCount += equalBits(simd.m, scalarResult, sizeof(scalarResult)) ? 0 : 1;
+
+        Matrix::add(a, b, &simd);
+        ScalarMathUtil::addMatrix(a.m, b.m, scalarResult);
+        mismatchCount += equalBits(simd.m, scalarResult, sizeof(scalarResult)) ? 0 : 1;
+
+        Matrix::subtract(a, b, &simd);
+        ScalarMathUtil::subtractMatrix(a.m, b.m, scalarResult);
+        mismatchCount += equalBits(simd.m, scalarResult, sizeof(scalarResult)) ? 0 : 1;
+
+        Matrix::multiply(a, scalar, &simd);
+        ScalarMathUtil::multiplyMatrix(a.m, scalar, scalarResult);
+        mismatchCount += equalBits(simd.m, scalarResult, sizeof(scalarResult)) ? 0 : 1;
+
+        Matrix::multiply(a, b, &simd);
+        ScalarMathUtil::multiplyMatrix(a.m, b.m, scalarResult);
+        mismatchCount += equalBits(simd.m, scalarResult, sizeof(scalarResult)) ? 0 : 1;
+
+        a.negate(&simd);
+        ScalarMathUtil::negateMatrix(a.m, scalarResult);
+        mismatchCount += equalBits(simd.m, scalarResult, sizeof(scalarResult)) ? 0 : 1;
+
+        a.transpose(&simd);
+        ScalarMathUtil::transposeMatrix(a.m, scalarResult);
+        mismatchCount += equalBits(simd.m, scalarResult, sizeof(scalarResult)) ? 0 : 1;
+
+        // The destination may be one of the operands.
+        simd = a;
+        simd.multiply(b);
+        ScalarMathUtil::multiplyMatrix(a.m, b.m, scalarResult);
+        mismatchCount += equalBits(simd.m, scalarResult, sizeof(scalarResult)) ? 0 : 1;
+
+        simd = a;
+        simd.transpose();
+        ScalarMathUtil::transposeMatrix(a.m, scalarResult);
+        mismatchCount += equalBits(simd.m, scalarResult, sizeof(scalarResult)) ? 0 : 1;
+
+        Vector4 v(randomValue(), randomValue(), randomValue(), randomValue());
+        Vector4 simdVector;
+        float scalarVector[4];
+        a.transformVector(v, &simdVector);
+        ScalarMathUtil::transformVector4(a.m, &v.x, scalarVector);
+        mismatchCount += equalBits(&simdVector.x, scalarVector, sizeof(scalarVector)) ? 0 : 1;
+
+        Vector3 simdVector3;
+        a.transformVector(v.x, v.y, v.z, v.w, &simdVector3);
+        ScalarMathUtil::transformVector4(a.m, v.x, v.y, v.z, v.w, scalarVector);
+        mismatchCount += equalBits(&simdVector3.x, scalarVector, sizeof(float) * 3) ? 0 : 1;
+    }
+    TEST_CHECK(mismatchCount == 0);
+
+    Matrix::multiply(m1, m2, MATRIX_COUNT, products);
+    Matrix* scalarProducts = new Matrix[MATRIX_COUNT];
+    ScalarMathUtil::multiplyMatrixArray(m1[0].m, m2[0].m, MATRIX_COUNT, scalarProducts[0].m);
+    TEST_CHECK(equalBits(products, scalarProducts, sizeof(Matrix) * MATRIX_COUNT));
+
+    // Vector arrays are transformed without touching the elements around them.
+    Vector3* points = new Vector3[VECTOR_COUNT + 1];
+    Vector3* simdPoints = new Vector3[VECTOR_COUNT + 1];
+    float* scalarPoints = new float[VECTOR_COUNT * 3];
+    randomFloats(&points[0].x, VECTOR_COUNT * 3);
+    const Vector3 guard(1.0f, 2.0f, 3.0f);
+    simdPoints[VECTOR_COUNT] = guard;
+
+    m1[0].transformPoints(points, VECTOR_COUNT, simdPoints);
+    ScalarMathUtil::transformVector3Array(m1[0].m, &points[0].x, 1.0f, VECTOR_COUNT, scalarPoints);
+    TEST_CHECK(equalBits(simdPoints, scalarPoints, sizeof(float) * VECTOR_COUNT * 3));
+    TEST_CHECK(simdPoints[VECTOR_COUNT] == guard);
+
+    m1[1].transformVectors(points, VECTOR_COUNT, simdPoints);
+    ScalarMathUtil::transformVector3Array(m1[1].m, &points[0].x, 0.0f, VECTOR_COUNT, scalarPoints);
+    TEST_CHECK(equalBits(simdPoints, scalarPoints, sizeof(float) * VECTOR_COUNT * 3));
+    TEST_CHECK(simdPoints[VECTOR_COUNT] == guard);
+
+    // Arrays can be transformed in place.
+    ScalarMathUtil::transformVector3Array(m1[2].m, &simdPoints[0].x, 1.0f, VECTOR_COUNT, scalarPoints);
+    m1[2].transformPoints(simdPoints, VECTOR_COUNT, simdPoints);
+    TEST_CHECK(equalBits(simdPoints, scalarPoints, sizeof(float) * VECTOR_COUNT * 3));
+
+    mismatchCount = 0;
+    for (unsigned int i = 0; i + 1 < VECTOR_COUNT; ++i)
+    {
+        Vector3 cross;
+        float scalarCross[3];
+        Vector3::cross(points[i], points[i + 1], &cross);
+        ScalarMathUtil::crossVector3(&points[i].x, &points[i + 1].x, scalarCross);
+        mismatchCount += equalBits(&cross.x, scalarCross, sizeof(scalarCross)) ? 0 : 1;
+    }
+    TEST_CHECK(mismatchCount == 0);
+
+    SAFE_DELETE_ARRAY(m1);
+    SAFE_DELETE_ARRAY(m2);
+    SAFE_DELETE_ARRAY(products);
+    SAFE_DELETE_ARRAY(scalarProducts);
+    SAFE_DELETE_ARRAY(points);
+    SAFE_DELETE_ARRAY(simdPoints);
+    SAFE_DELETE_ARRAY(scalarPoints);
+}
+
+}
@@ -0,0 +1,325 @@
+#include "NullOpenAL.h"
+
+using namespace gameplay;
+
+/**
+ * The data held by a null OpenAL buffer.
+ */
+struct NullBuffer
+{
+    std::vector<char> data;
+    ALint frequency;
+    ALint channels;
+    ALint bits;
+};
+
+/**
+ * The state of a null OpenAL source.
+ */
+struct NullSource
+{
+    std::deque<ALuint> queue;
+    ALint processedCount;
+    ALint state;
+};
+
+static std::map<ALuint, NullBuffer> __buffers;
+static std::map<ALuint, NullSource> __sources;
+static ALuint __nextName = 1;
+static ALenum __error = AL_NO_ERROR;
+static int __device;
+static int __context;
+
+static NullSource* findSource(ALuint source)
+{
+    std::map<ALuint, NullSource>::iterator itr = __sources.find(source);
+    if (itr == __sources.end())
+    {
+        __error = AL_INVALID_NAME;
+        return NULL;
+    }
+    return &itr->second;
+}
+
+static NullBuffer* findBuffer(ALuint buffer)
+{
+    std::map<ALuint, NullBuffer>::iterator itr = __buffers.find(buffer);
+    if (itr == __buffers.end())
+    {
+        __error = AL_INVALID_NAME;
+        return NULL;
+    }
+    return &itr->second;
+}
+
+ALenum alGetError()
+{
+    ALenum error = __error;
+    __error = AL_NO_ERROR;
+    return error;
+}
+
+void alGenBuffers(ALsizei n, ALuint* buffers)
+{
+    for (ALsizei i = 0; i < n; ++i)
+    {
+        buffers[i] = __nextName++;
+        NullBuffer& buffer = __buffers[buffers[i]];
+        buffer.frequency = 0;
+        buffer.channels = 0;
+        buffer.bits = 0;
+    }
+}
+
+void alDeleteBuffers(ALsizei n, const ALuint* buffers)
+{
+    for (ALsizei i = 0; i < n; ++i)
+    {
+        // Deleting buffer zero does nothing.
+        if (buffers[i] != 0 && __buffers.erase(buffers[i]) == 0)
+            __error = AL_INVALID_NAME;
+    }
+}
+
+void alBufferData(ALuint buffer, ALenum format, const ALvoid* data, ALsizei size, ALsizei frequency)
+{
+    NullBuffer* b = findBuffer(buffer);
+    if (!b)
+        return;
+
+    b->data.assign((const char*)data, (const char*)data + size);
+    b->frequency = frequency;
+    b->channels = (format == AL_FORMAT_STEREO8 || format == AL_FORMAT_STEREO16) ? 2 : 1;
+    b->bits = (format == AL_FORMAT_MONO8 || format == AL_FORMAT_STEREO8) ? 8 : 16;
+}
+
+void alGetBufferi(ALuint buffer, ALenum param, ALint* value)
+{
+    NullBuffer* b = findBuffer(buffer);
+    if (!b)
+        return;
+
+    switch (param)
+    {
+    case AL_SIZE:
+        *value = (ALint)b->data.size();
+        break;
+    case AL_FREQUENCY:
+        *value = b->frequency;
+        break;
+    case AL_CHANNELS:
+        *value = b->channels;
+        break;
+    case AL_BITS:
+        *value = b->bits;
+        break;
+    default:
+        __error = AL_INVALID_ENUM;
+        break;
+    }
+}
+
+void alGenSources(ALsizei n, ALuint* sources)
+{
+    for (ALsizei i = 0; i < n; ++i)
+    {
+        sources[i] = __nextName++;
+        NullSource& source = __sources[sources[i]];
+        source.processedCount = 0;
+        source.state = AL_INITIAL;
+    }
+}
+
+void alDeleteSources(ALsizei n, const ALuint* sources)
+{
+    for (ALsizei i = 0; i < n; ++i)
+    {
+        if (__sources.erase(sources[i]) == 0)
+            __error = AL_INVALID_NAME;
+    }
+}
+
+void alSourcei(ALuint source, ALenum param, ALint value)
+{
+    NullSource* s = findSource(source);
+    if (!s || param != AL_BUFFER)
+        return;
+
+    // Setting the buffer replaces the queue, and buffer zero empties it.
+    s->queue.clear();
+    s->processedCount = 0;
+    if (value != 0)
+        s->queue.push_back((ALuint)value);
+}
+
+void alSourcef(ALuint source, ALenum param, ALfloat value)
+{
+    findSource(source);
+}
+
+void alSourcefv(ALuint source, ALenum param, const ALfloat* values)
+{
+    findSource(source);
+}
+
+void alGetSourcei(ALuint source, ALenum param, ALint* value)
+{
+    NullSource* s = findSource(source);
+    if (!s)
+        return;
+
+    switch (param)
+    {
+    case AL_BUFFERS_PROCESSED:
+        *value = s->processedCount;
+        break;
+    case AL_BUFFERS_QUEUED:
+        *value = (ALint)s->queue.size();
+        break;
+    case AL_SOURCE_STATE:
+        *value = s->state;
+        break;
+    default:
+        __error = AL_INVALID_ENUM;
+        break;
+    }
+}
+
+void alGetSourcef(ALuint source, ALenum param, ALfloat* value)
+{
+    // Buffers are played whole, so playback is always at the start of one.
+    if (findSource(source))
+        *value = 0.0f;
+}
+
+void alSourcePlay(ALuint source)
+{
+    NullSource* s = findSource(source);
+    if (!s)
+        return;
+
+    // A source that isn't paused plays its queue from the start.
+    if (s->state != AL_PAUSED)
+        s->processedCount = 0;
+    s->state = s->processedCount < (ALint)s->queue.size() ? AL_PLAYING : AL_STOPPED;
+}
+
+void alSourcePause(ALuint source)
+{
+    NullSource* s = findSource(source);
+    if (s && s->state == AL_PLAYING)
+        s->state = AL_PAUSED;
+}
+
+void alSourceStop(ALuint source)
+{
+    NullSource* s = findSource(source);
+    if (!s)
+        return;
+
+    // Stopping a source marks all of its buffers as processed.
+    s->state = AL_STOPPED;
+    s->processedCount = (ALint)s->queue.size();
+}
+
+void alSourceRewind(ALuint source)
+{
+    NullSource* s = findSource(source);
+    if (!s)
+        return;
+
+    s->state = AL_INITIAL;
+    s->processedCount = 0;
+}
+
+void alSourceQueueBuffers(ALuint source, ALsizei n, const ALuint* buffers)
+{
+    NullSource* s = findSource(source);
+    for (ALsizei i = 0; s && i < n; ++i)
+    {
+        if (findBuffer(buffers[i]))
+            s->queue.push_back(buffers[i]);
+    }
+}
+
+void alSourceUnqueueBuffers(ALuint source, ALsizei n, ALuint* buffers)
+{
+    NullSource* s = findSource(source);
+    if (!s)
+        return;
+
+    // Only buffers that have been played can be unqueued.
+    if (n > s->processedCount)
+    {
+        __error = AL_INVALID_VALUE;
+        return;
+    }
+    for (ALsizei i = 0; i < n; ++i)
+    {
+        buffers[i] = s->queue.front();
+        s->queue.pop_front();
+    }
+    s->processedCount -= n;
+}
+
+void alListenerf(ALenum param, ALfloat value)
+{
+}
+
+void alListenerfv(ALenum param, const ALfloat* values)
+{
+}
+
+ALCdevice* alcOpenDevice(const ALCchar* deviceName)
+{
+    return (ALCdevice*)&__device;
+}
+
+ALCboolean alcCloseDevice(ALCdevice* device)
+{
+    return ALC_TRUE;
+}
+
+ALCcontext* alcCreateContext(ALCdevice* device, const ALCint* attributes)
+{
+    return (ALCcontext*)&__context;
+}
+
+void alcDestroyContext(ALCcontext* context)
+{
+}
+
+ALCboolean alcMakeContextCurrent(ALCcontext* context)
+{
+    return ALC_TRUE;
+}
+
+ALCenum alcGetError(ALCdevice* device)
+{
+    return ALC_NO_ERROR;
+}
+
+namespace gameplay
+{
+
+bool playNullOpenALBuffer(ALuint source, std::vector<char>* data)
+{
+    NullSource* s = findSource(source);
+    if (!s || s->state != AL_PLAYING)
+        return false;
+
+    GP_ASSERT(s->processedCount < (ALint)s->queue.size());
+    const NullBuffer& buffer = __buffers[s->queue[s->processedCount]];
+    if (data)
+        data->insert(data->end(), buffer.data.begin(), buffer.data.end());
+    if (++s->processedCount == (ALint)s->queue.size())
+        s->state = AL_STOPPED;
+    return true;
+}
+
+unsigned int getNullOpenALObjectCount()
+{
+    return (unsigned int)(__buffers.size() + __sources.size());
+}
+
+}
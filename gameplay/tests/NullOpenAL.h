@@ -0,0 +1,35 @@
+#ifndef NULLOPENAL_H_
+#define NULLOPENAL_H_
+
+#include "Base.h"
+
+namespace gameplay
+{
+
+/**
+ * gameplay-tests links against a null stand-in for OpenAL instead of an OpenAL library,
+ * so audio code can be tested without an audio device. Its sources don't play on their
+ * own: a test plays their queued buffers one at a time with playNullOpenALBuffer().
+ */
+
+/**
+ * Plays the next queued buffer of a playing source to its end. The source stops
+ * once it has played all of its queued buffers.
+ *
+ * @param source The OpenAL source.
+ * @param data The data of the buffer is appended to this. May be NULL.
+ *
+ * @return True if a buffer was played, false if the source is not playing.
+ */
+bool playNullOpenALBuffer(ALuint source, std::vector<char>* data);
+
+/**
+ * Gets the number of OpenAL buffers and sources that have been generated and not deleted.
+ *
+ * @return The number of buffers and sources.
+ */
+unsigned int getNullOpenALObjectCount();
+
+}
+
+#endif
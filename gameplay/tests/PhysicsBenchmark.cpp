@@ -0,0 +1,115 @@
+#include "BenchmarkGame.h"
+
+namespace gameplay
+{
+
+static const unsigned int BOX_COUNT = 1000;
+static const unsigned int FRAME_COUNT = 600;
+static const unsigned int SPIKE_INTERVAL = 60;
+static const double SPIKE_TIME = 200.0;
+
+/**
+ * Drops a pile of boxes and stalls every SPIKE_INTERVAL frames, once with the sub step
+ * limit alone and once with a sub step budget, and reports the cost of the physics updates.
+ */
+class PhysicsBenchmark : public GameBenchmark
+{
+public:
+
+    PhysicsBenchmark() : _scene(NULL), _run(0), _frame(0)
+    {
+    }
+
+    void initialize()
+    {
+        startRun();
+    }
+
+    bool update(float elapsedTime)
+    {
+        PhysicsController* controller = Game::getInstance()->getPhysicsController();
+        _stepTime += controller->getStepTime();
+        _maxStepTime = std::max(_maxStepTime, controller->getStepTime());
+        _subStepCount += controller->getSubStepCount();
+        _maxSubStepCount = std::max(_maxSubStepCount, controller->getSubStepCount());
+        _droppedTime += controller->getDroppedTime();
+
+        if (++_frame % SPIKE_INTERVAL == 0)
+        {
+            // Stall the frame, as a slow load or a long garbage collection would.
+            const double end = Game::getAbsoluteTime() + SPIKE_TIME;
+            while (Game::getAbsoluteTime() < end)
+            {
+            }
+        }
+
+        if (_frame < FRAME_COUNT)
+            return true;
+
+        printf("PhysicsBenchmark (%s): %u frames, %u sub steps (at most %u per frame), %.3f ms stepping "
+            "(at most %.3f ms per frame), %.1f ms of simulation dropped\n",
+            _run == 0 ? "no budget" : "2 ms budget", _frame, _subStepCount, _maxSubStepCount,
+            _stepTime, _maxStepTime, _droppedTime);
+
+        if (++_run == 2)
+            return false;
+
+        startRun();
+        return true;
+    }
+
+    void finalize()
+    {
+        SAFE_RELEASE(_scene);
+    }
+
+private:
+
+    void startRun()
+    {
+        PhysicsController* controller = Game::getInstance()->getPhysicsController();
+        controller->setFixedTimeStep(1.0f / 60.0f);
+        controller->setMaxSubSteps(10);
+        controller->setSubStepBudget(_run == 0 ? 0.0f : 2.0f);
+
+        // Each run starts from the same pile of boxes.
+        SAFE_RELEASE(_scene);
+        _scene = Scene::create();
+
+        Node* ground = _scene->addNode("ground");
+        PhysicsRigidBody::Parameters groundParameters;
+        ground->setCollisionObject(PhysicsCollisionObject::RIGID_BODY, PhysicsCollisionShape::box(Vector3(200.0f, 1.0f, 200.0f)), &groundParameters);
+
+        PhysicsRigidBody::Parameters boxParameters;
+        boxParameters.mass = 1.0f;
+        for (unsigned int i = 0; i < BOX_COUNT; ++i)
+        {
+            Node* box = _scene->addNode();
+            box->setTranslation((float)(i % 10) * 1.5f, 2.0f + (float)(i / 100) * 1.5f, (float)(i / 10 % 10) * 1.5f);
+            box->setCollisionObject(PhysicsCollisionObject::RIGID_BODY, PhysicsCollisionShape::box(Vector3::one()), &boxParameters);
+        }
+
+        _frame = 0;
+        _stepTime = 0.0f;
+        _maxStepTime = 0.0f;
+        _subStepCount = 0;
+        _maxSubStepCount = 0;
+        _droppedTime = 0.0f;
+    }
+
+    Scene* _scene;
+    unsigned int _run;
+    unsigned int _frame;
+    float _stepTime;
+    float _maxStepTime;
+    unsigned int _subStepCount;
+    unsigned int _maxSubStepCount;
+    float _droppedTime;
+};
+
+GameBenchmark* createPhysicsBenchmark()
+{
+    return new PhysicsBenchmark();
+}
+
+}
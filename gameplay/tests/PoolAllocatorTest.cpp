@@ -0,0 +1,76 @@
+#include "Test.h"
+#include "PoolAllocator.h"
+
+namespace gameplay
+{
+
+void testPoolAllocator()
+{
+    unsigned int allocatorCount = PoolAllocator::getAllocatorCount();
+    {
+        PoolAllocator allocator("Test", 20, 4);
+        TEST_CHECK(PoolAllocator::getAllocatorCount() == allocatorCount + 1);
+        TEST_CHECK(PoolAllocator::getAllocator(0) == &allocator);
+        TEST_CHECK(strcmp(allocator.getName(), "Test") == 0);
+
+        // Elements are rounded up to keep them aligned.
+        TEST_CHECK(allocator.getElementSize() == 32);
+        TEST_CHECK(allocator.getCapacity() == 0);
+
+        // Elements are handed out from chunks, in address order within a chunk.
+        void* elements[6];
+        for (int i = 0; i < 6; ++i)
+        {
+            elements[i] = allocator.allocate(20);
+            TEST_CHECK(elements[i] != NULL);
+            TEST_CHECK(((size_t)elements[i] & 15) == 0);
+            memset(elements[i], i, 20);
+        }
+        TEST_CHECK(allocator.getAllocationCount() == 6);
+        TEST_CHECK(allocator.getCapacity() == 8);
+        TEST_CHECK((char*)elements[1] == (char*)elements[0] + 32);
+
+        // Freed elements are reused before the allocator grows.
+        allocator.deallocate(elements[2], 20);
+        TEST_CHECK(allocator.getAllocationCount() == 5);
+        void* reused = allocator.allocate(16);
+        TEST_CHECK(reused == elements[2]);
+        elements[2] = reused;
+        memset(elements[2], 2, 20);
+        TEST_CHECK(allocator.getCapacity() == 8);
+
+        // Freeing one element leaves the others intact.
+        for (int i = 0; i < 6; ++i)
+        {
+            TEST_CHECK(((unsigned char*)elements[i])[19] == i);
+        }
+
+        // Allocations larger than an element are passed on to the heap.
+        void* large = allocator.allocate(100);
+        TEST_CHECK(large != NULL);
+        TEST_CHECK(allocator.getAllocationCount() == 6);
+        TEST_CHECK(allocator.getTotalAllocationCount() == 8);
+        allocator.deallocate(large, 100);
+        TEST_CHECK(allocator.getAllocationCount() == 6);
+
+        allocator.deallocate(NULL, 20);
+        for (int i = 0; i < 6; ++i)
+        {
+            allocator.deallocate(elements[i], 20);
+        }
+        TEST_CHECK(allocator.getAllocationCount() == 0);
+        TEST_CHECK(allocator.getCapacity() == 8);
+    }
+    TEST_CHECK(PoolAllocator::getAllocatorCount() == allocatorCount);
+
+    // Allocators created on first use are created once per pointer.
+    PoolAllocator* pool = NULL;
+    PoolAllocator* created = PoolAllocator::get(&pool, "Pooled", 8);
+    TEST_CHECK(created != NULL && created == pool);
+    TEST_CHECK(PoolAllocator::get(&pool, "Pooled", 8) == created);
+    TEST_CHECK(PoolAllocator::getAllocatorCount() == allocatorCount + 1);
+    SAFE_DELETE(pool);
+    TEST_CHECK(PoolAllocator::getAllocatorCount() == allocatorCount);
+}
+
+}
@@ -0,0 +1,148 @@
+#include "Test.h"
+#include "Properties.h"
+#include "FileSystem.h"
+
+namespace gameplay
+{
+
+static const unsigned int LOAD_COUNT = 200;
+static const unsigned int SCENE_NODE_COUNT = 500;
+static const unsigned int GET_PASSES = 100;
+
+/**
+ * Reads the transform of every node in a scene, as SceneLoader does, and returns the
+ * number of nodes read.
+ */
+static unsigned int readNodeTransforms(Properties* scene, Vector3* checksum)
+{
+    unsigned int nodeCount = 0;
+    scene->rewind();
+    Properties* node;
+    while ((node = scene->getNextNamespace()) != NULL)
+    {
+        if (strcmp(node->getNamespace(), "node") != 0)
+            continue;
+
+        Vector3 translate, scale;
+        Vector4 rotate;
+        node->getVector3("translate", &translate);
+        node->getVector4("rotate", &rotate);
+        node->getVector3("scale", &scale);
+        *checksum += translate + scale + Vector3(rotate.x, rotate.y, rotate.w);
+        ++nodeCount;
+    }
+    return nodeCount;
+}
+
+/**
+ * Loads benchmark.scene as text, then loads benchmark.gpp, which is the same scene compiled.
+ */
+static void benchmarkLoad(const char* name, const char* url)
+{
+    unsigned int nodeCount = 0;
+    Vector3 checksum;
+
+    clock_t start = clock();
+    for (unsigned int i = 0; i < LOAD_COUNT; ++i)
+    {
+        Properties* properties = Properties::create(url);
+        TEST_CHECK(properties != NULL);
+        SAFE_DELETE(properties);
+    }
+    reportBenchmark(name, LOAD_COUNT, start);
+
+    // Loading a scene also reads its values, which text files parse on every get.
+    char readName[64];
+    sprintf(readName, "%s and read", name);
+    start = clock();
+    for (unsigned int i = 0; i < LOAD_COUNT; ++i)
+    {
+        Properties* properties = Properties::create(url);
+        Properties* scene = properties ? properties->getNamespace("scene", true) : NULL;
+        TEST_CHECK(scene != NULL);
+        if (scene)
+            nodeCount += readNodeTransforms(scene, &checksum);
+        SAFE_DELETE(properties);
+    }
+    reportBenchmark(readName, LOAD_COUNT, start);
+    TEST_CHECK(nodeCount == LOAD_COUNT * SCENE_NODE_COUNT);
+    printf("%s: read %u nodes, checksum %.2f %.2f %.2f\n", name, nodeCount, checksum.x, checksum.y, checksum.z);
+}
+
+void benchmarkPropertiesLoad()
+{
+    FileSystem::setResourcePath(getTestResourcePath());
+
+    // benchmark.gpp is benchmark.scene compiled by gameplay-encoder.
+    benchmarkLoad("Properties::create text", "benchmark.scene");
+    benchmarkLoad("Properties::create compiled", "benchmark.gpp");
+}
+
+void benchmarkPropertiesGet()
+{
+    FileSystem::setResourcePath(getTestResourcePath());
+
+    Properties* properties = Properties::create("benchmark.scene");
+    Properties* scene = properties ? properties->getNamespace("scene", true) : NULL;
+    TEST_CHECK(scene != NULL);
+    if (!scene)
+    {
+        SAFE_DELETE(properties);
+        return;
+    }
+
+    // The first get of each value parses it, later gets return the cached value.
+    Vector3 firstChecksum;
+    clock_t start = clock();
+    unsigned int nodeCount = readNodeTransforms(scene, &firstChecksum);
+    reportBenchmark("Properties first get (nodes)", nodeCount, start);
+    TEST_CHECK(nodeCount == SCENE_NODE_COUNT);
+
+    Vector3 checksums[GET_PASSES];
+    nodeCount = 0;
+    start = clock();
+    for (unsigned int i = 0; i < GET_PASSES; ++i)
+        nodeCount += readNodeTransforms(scene, &checksums[i]);
+    reportBenchmark("Properties repeated get (nodes)", nodeCount, start);
+    for (unsigned int i = 0; i < GET_PASSES; ++i)
+        TEST_CHECK(checksums[i] == firstChecksum);
+
+    // Looking nodes up by ID, as scene scripts and SceneLoader references do.
+    std::vector<std::string> ids(SCENE_NODE_COUNT);
+    for (unsigned int i = 0; i < SCENE_NODE_COUNT; ++i)
+    {
+        char id[32];
+        sprintf(id, "node%u", i);
+        ids[i] = id;
+    }
+    unsigned int foundCount = 0;
+    start = clock();
+    for (unsigned int pass = 0; pass < GET_PASSES; ++pass)
+    {
+        for (unsigned int i = 0; i < SCENE_NODE_COUNT; ++i)
+        {
+            if (scene->getNamespace(ids[i].c_str()))
+                ++foundCount;
+        }
+    }
+    reportBenchmark("Properties::getNamespace by ID", SCENE_NODE_COUNT * GET_PASSES, start);
+    TEST_CHECK(foundCount == SCENE_NODE_COUNT * GET_PASSES);
+
+    // Searching only the immediate namespaces doesn't use the index, so it scans them.
+    foundCount = 0;
+    start = clock();
+    for (unsigned int pass = 0; pass < GET_PASSES; ++pass)
+    {
+        for (unsigned int i = 0; i < SCENE_NODE_COUNT; ++i)
+        {
+            if (scene->getNamespace(ids[i].c_str(), false, false))
+                ++foundCount;
+        }
+    }
+    reportBenchmark("Properties::getNamespace by ID without recursion", SCENE_NODE_COUNT * GET_PASSES, start);
+    TEST_CHECK(foundCount == SCENE_NODE_COUNT * GET_PASSES);
+
+    SAFE_DELETE(properties);
+}
+
+}
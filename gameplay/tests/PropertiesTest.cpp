@@ -0,0 +1,116 @@
+#include "Test.h"
+#include "Properties.h"
+#include "FileSystem.h"
+
+namespace gameplay
+{
+
+/**
+ * Checks that two namespaces hold the same properties and inner namespaces, in the same order.
+ */
+static void compareNamespaces(Properties* expected, Properties* actual)
+{
+    TEST_CHECK(strcmp(expected->getNamespace(), actual->getNamespace()) == 0);
+    TEST_CHECK(strcmp(expected->getId(), actual->getId()) == 0);
+
+    expected->rewind();
+    actual->rewind();
+    const char* name;
+    while ((name = expected->getNextProperty()) != NULL)
+    {
+        const char* actualName = actual->getNextProperty();
+        TEST_CHECK(actualName && strcmp(name, actualName) == 0);
+        if (!actualName)
+            return;
+
+        TEST_CHECK(strcmp(expected->getString(), actual->getString()) == 0);
+        TEST_CHECK(expected->getType() == actual->getType());
+        switch (expected->getType())
+        {
+        case Properties::NUMBER:
+            TEST_CHECK(expected->getFloat() == actual->getFloat());
+            break;
+        case Properties::VECTOR2:
+        {
+            Vector2 expectedVector, actualVector;
+            TEST_CHECK(expected->getVector2(name, &expectedVector) && actual->getVector2(name, &actualVector));
+            TEST_CHECK(expectedVector == actualVector);
+            break;
+        }
+        case Properties::VECTOR3:
+        {
+            Vector3 expectedVector, actualVector;
+            TEST_CHECK(expected->getVector3(name, &expectedVector) && actual->getVector3(name, &actualVector));
+            TEST_CHECK(expectedVector == actualVector);
+            break;
+        }
+        case Properties::VECTOR4:
+        {
+            Vector4 expectedVector, actualVector;
+            TEST_CHECK(expected->getVector4(name, &expectedVector) && actual->getVector4(name, &actualVector));
+            TEST_CHECK(expectedVector == actualVector);
+            break;
+        }
+        case Properties::MATRIX:
+        {
+            Matrix expectedMatrix, actualMatrix;
+            TEST_CHECK(expected->getMatrix(name, &expectedMatrix) && actual->getMatrix(name, &actualMatrix));
+            TEST_CHECK(memcmp(expectedMatrix.m, actualMatrix.m, sizeof(expectedMatrix.m)) == 0);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    TEST_CHECK(actual->getNextProperty() == NULL);
+
+    Properties* space;
+    while ((space = expected->getNextNamespace()) != NULL)
+    {
+        Properties* actualSpace = actual->getNextNamespace();
+        TEST_CHECK(actualSpace != NULL);
+        if (!actualSpace)
+            return;
+        compareNamespaces(space, actualSpace);
+    }
+    TEST_CHECK(actual->getNextNamespace() == NULL);
+}
+
+void testProperties()
+{
+    FileSystem::setResourcePath(getTestResourcePath());
+
+    // test.gpp is test.properties compiled by gameplay-encoder.
+    Properties* text = Properties::create("test.properties");
+    Properties* compiled = Properties::create("test.gpp");
+    TEST_CHECK(text != NULL);
+    TEST_CHECK(compiled != NULL);
+    if (text && compiled)
+    {
+        compareNamespaces(text, compiled);
+
+        // Inherited properties are resolved in the compiled file.
+        Properties* shiny = compiled->getNamespace("shiny");
+        TEST_CHECK(shiny != NULL);
+        if (shiny)
+        {
+            TEST_CHECK(shiny->getInt("shininess") == 128);
+            Vector4 color;
+            TEST_CHECK(shiny->getVector4("color", &color) && color == Vector4(1.0f, 0.5f, 0.25f, 1.0f));
+            Properties* pass = shiny->getNamespace("pass", true);
+            TEST_CHECK(pass && strcmp(pass->getString("vertexShader"), "res/shaders/colored.vert") == 0);
+        }
+
+        Properties* light = compiled->getNamespace("light");
+        TEST_CHECK(light && light->getBool("enabled") && light->getInt("count") == -7);
+    }
+    SAFE_DELETE(text);
+    SAFE_DELETE(compiled);
+
+    // A namespace within a compiled file can be loaded by URL.
+    Properties* shiny = Properties::create("test.gpp#shiny");
+    TEST_CHECK(shiny && shiny->getInt("shininess") == 128);
+    SAFE_DELETE(shiny);
+}
+
+}
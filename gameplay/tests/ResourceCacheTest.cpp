@@ -0,0 +1,103 @@
+#include "Test.h"
+#include "ResourceCache.h"
+
+namespace gameplay
+{
+
+static ResourceCache* __testCache = NULL;
+static unsigned int __destroyedCount = 0;
+
+/**
+ * A resource that removes itself from the test cache when it is destroyed.
+ */
+class TestResource : public Ref
+{
+public:
+
+    TestResource() { }
+
+    ~TestResource()
+    {
+        if (__testCache)
+            __testCache->remove(this);
+        ++__destroyedCount;
+    }
+};
+
+void testResourceCache()
+{
+    unsigned int cacheCount = ResourceCache::getCacheCount();
+    ResourceCache* cache = ResourceCache::get(&__testCache, "Test");
+    TEST_CHECK(cache != NULL && cache == __testCache);
+    TEST_CHECK(ResourceCache::get(&__testCache, "Test") == cache);
+    TEST_CHECK(ResourceCache::getCacheCount() == cacheCount + 1);
+    TEST_CHECK(strcmp(cache->getType(), "Test") == 0);
+
+    // Resources that share a key are found by index.
+    TestResource* first = new TestResource();
+    TestResource* second = new TestResource();
+    TestResource* third = new TestResource();
+    cache->add("a", first, 10, 1);
+    cache->add("a", second, 20, 2);
+    cache->add("b", third, 30, 3);
+    TEST_CHECK(cache->find("a") == first);
+    TEST_CHECK(cache->find("a", 1) == second);
+    TEST_CHECK(cache->find("a", 2) == NULL);
+    TEST_CHECK(cache->find("b") == third);
+    TEST_CHECK(cache->find("c") == NULL);
+    TEST_CHECK(cache->getResourceCount() == 3);
+    TEST_CHECK(cache->getGPUMemoryUsage() == 60);
+    TEST_CHECK(cache->getCPUMemoryUsage() == 6);
+    TEST_CHECK(cache->getMemoryUsage() == 66);
+
+    // Without a budget, resources are destroyed as soon as they are released.
+    TEST_CHECK(cache->getUnusedResourceCount() == 0);
+    SAFE_RELEASE(first);
+    TEST_CHECK(__destroyedCount == 1);
+    TEST_CHECK(cache->find("a") == second);
+    TEST_CHECK(cache->getMemoryUsage() == 55);
+    SAFE_RELEASE(second);
+    SAFE_RELEASE(third);
+    TEST_CHECK(cache->getResourceCount() == 0);
+    TEST_CHECK(cache->getMemoryUsage() == 0);
+
+    // With a budget, the cache keeps unused resources loaded and releases the least
+    // recently used first once the budget is exceeded.
+    __destroyedCount = 0;
+    ResourceCache::setMemoryBudget(1000);
+    first = new TestResource();
+    second = new TestResource();
+    third = new TestResource();
+    cache->add("first", first, 10);
+    cache->add("second", second, 10);
+    cache->add("third", third, 10);
+    cache->use(first);
+    SAFE_RELEASE(first);
+    SAFE_RELEASE(second);
+    SAFE_RELEASE(third);
+    TEST_CHECK(__destroyedCount == 0);
+    TEST_CHECK(cache->getUnusedResourceCount() == 3);
+
+    ResourceCache::setMemoryBudget(25);
+    TEST_CHECK(__destroyedCount == 1);
+    TEST_CHECK(cache->find("second") == NULL);
+    TEST_CHECK(cache->find("first") != NULL);
+    TEST_CHECK(cache->find("third") != NULL);
+
+    // Resources that are in use are never released.
+    TestResource* used = static_cast<TestResource*>(cache->find("third"));
+    used->addRef();
+    ResourceCache::releaseUnused();
+    TEST_CHECK(__destroyedCount == 2);
+    TEST_CHECK(cache->find("first") == NULL);
+    TEST_CHECK(cache->find("third") == used);
+
+    // Removing the budget drops the reference held by the cache.
+    ResourceCache::setMemoryBudget(0);
+    TEST_CHECK(used->getRefCount() == 1);
+    SAFE_RELEASE(used);
+    TEST_CHECK(__destroyedCount == 3);
+    TEST_CHECK(cache->getResourceCount() == 0);
+}
+
+}
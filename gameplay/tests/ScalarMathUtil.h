@@ -0,0 +1,47 @@
+#ifndef SCALARMATHUTIL_H_
+#define SCALARMATHUTIL_H_
+
+#include "MathUtil.h"
+
+namespace gameplay
+{
+
+/**
+ * The portable MathUtil routines, built from MathUtil.inl whichever version the engine uses.
+ */
+class ScalarMathUtil
+{
+public:
+
+    inline static void addMatrix(const float* m, float scalar, float* dst);
+
+    inline static void addMatrix(const float* m1, const float* m2, float* dst);
+
+    inline static void subtractMatrix(const float* m1, const float* m2, float* dst);
+
+    inline static void multiplyMatrix(const float* m, float scalar, float* dst);
+
+    inline static void multiplyMatrix(const float* m1, const float* m2, float* dst);
+
+    inline static void multiplyMatrixArray(const float* m1, const float* m2, unsigned int count, float* dst);
+
+    inline static void negateMatrix(const float* m, float* dst);
+
+    inline static void transposeMatrix(const float* m, float* dst);
+
+    inline static void transformVector4(const float* m, float x, float y, float z, float w, float* dst);
+
+    inline static void transformVector4(const float* m, const float* v, float* dst);
+
+    inline static void transformVector3Array(const float* m, const float* v, float w, unsigned int count, float* dst);
+
+    inline static void crossVector3(const float* v1, const float* v2, float* dst);
+};
+
+}
+
+#define MathUtil ScalarMathUtil
+#include "MathUtil.inl"
+#undef MathUtil
+
+#endif
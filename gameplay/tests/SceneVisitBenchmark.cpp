@@ -0,0 +1,104 @@
+#include "BenchmarkGame.h"
+
+namespace gameplay
+{
+
+static const unsigned int GROUP_COUNT = 100;
+static const unsigned int GROUP_SIZE = 200;
+static const unsigned int NODE_COUNT = GROUP_COUNT * (GROUP_SIZE + 1);
+static const unsigned int VISIT_COUNT = 20;
+
+/**
+ * Counts the lights in a scene of NODE_COUNT nodes by calling a Lua function for each node
+ * (Scene::visit), by calling a Lua function once with the nodes that have a light
+ * (Scene::visitNodes), and natively (Scene::gatherNodes).
+ */
+class SceneVisitBenchmark : public GameBenchmark
+{
+public:
+
+    SceneVisitBenchmark() : _scene(NULL), _lightCount(0)
+    {
+    }
+
+    void initialize()
+    {
+        // Groups of nodes with a light on every tenth one.
+        _scene = Scene::create();
+        Light* light = Light::createPoint(Vector3::one(), 10.0f);
+        _lightCount = 0;
+        for (unsigned int i = 0; i < GROUP_COUNT; ++i)
+        {
+            Node* group = _scene->addNode();
+            for (unsigned int j = 0; j < GROUP_SIZE; ++j)
+            {
+                Node* node = Node::create();
+                if (j % 10 == 0)
+                {
+                    node->setLight(light);
+                    ++_lightCount;
+                }
+                group->addChild(node);
+                SAFE_RELEASE(node);
+            }
+        }
+        SAFE_RELEASE(light);
+
+        Game::getInstance()->getScriptController()->loadScript("visit.lua");
+    }
+
+    bool update(float elapsedTime)
+    {
+        ScriptController* sc = Game::getInstance()->getScriptController();
+
+        sc->setInt("lightCount", 0);
+        double start = Game::getAbsoluteTime();
+        for (unsigned int i = 0; i < VISIT_COUNT; ++i)
+            _scene->visit("countLight");
+        reportGameBenchmark("Scene::visit (nodes visited)", NODE_COUNT * VISIT_COUNT, start);
+        checkCount("Scene::visit", sc->getInt("lightCount"));
+
+        sc->setInt("lightCount", 0);
+        start = Game::getAbsoluteTime();
+        for (unsigned int i = 0; i < VISIT_COUNT; ++i)
+            _scene->visitNodes("countLights", Scene::FILTER_LIGHT);
+        reportGameBenchmark("Scene::visitNodes (nodes visited)", NODE_COUNT * VISIT_COUNT, start);
+        checkCount("Scene::visitNodes", sc->getInt("lightCount"));
+
+        std::vector<Node*> nodes;
+        unsigned int count = 0;
+        start = Game::getAbsoluteTime();
+        for (unsigned int i = 0; i < VISIT_COUNT; ++i)
+        {
+            nodes.clear();
+            count += _scene->gatherNodes(nodes, Scene::FILTER_LIGHT);
+        }
+        reportGameBenchmark("Scene::gatherNodes (nodes visited)", NODE_COUNT * VISIT_COUNT, start);
+        checkCount("Scene::gatherNodes", (int)count);
+
+        return false;
+    }
+
+    void finalize()
+    {
+        SAFE_RELEASE(_scene);
+    }
+
+private:
+
+    void checkCount(const char* name, int count)
+    {
+        if (count != (int)(_lightCount * VISIT_COUNT))
+            printf("SceneVisitBenchmark: %s counted %d lights instead of %u\n", name, count, _lightCount * VISIT_COUNT);
+    }
+
+    Scene* _scene;
+    unsigned int _lightCount;
+};
+
+GameBenchmark* createSceneVisitBenchmark()
+{
+    return new SceneVisitBenchmark();
+}
+
+}
@@ -0,0 +1,125 @@
+#include "Test.h"
+#include "FileSystem.h"
+#include "BufferedStream.h"
+
+namespace gameplay
+{
+
+static const unsigned int RECORD_COUNT = 50000;
+static const char* STREAM_FILE = "stream.tmp";
+
+/**
+ * Writes RECORD_COUNT records laid out like the nodes in a bundle: an ID, a transform
+ * matrix and a length-prefixed name.
+ */
+static bool writeRecords()
+{
+    Stream* stream = FileSystem::open(STREAM_FILE, FileSystem::WRITE);
+    if (!stream)
+        return false;
+
+    for (unsigned int i = 0; i < RECORD_COUNT; ++i)
+    {
+        float m[16];
+        for (unsigned int j = 0; j < 16; ++j)
+            m[j] = (float)((i * 16 + j) % 1000) * 0.01f;
+        char name[32];
+        unsigned int length = (unsigned int)sprintf(name, "node%u", i);
+
+        stream->write(&i, sizeof(i), 1);
+        stream->write(m, sizeof(float), 16);
+        stream->write(&length, sizeof(length), 1);
+        stream->write(name, 1, length);
+    }
+    SAFE_DELETE(stream);
+    return true;
+}
+
+/**
+ * Reads the records one field at a time through the Stream interface, as Bundle did.
+ */
+static double readRecords(Stream* stream)
+{
+    double checksum = 0.0;
+    for (unsigned int i = 0; i < RECORD_COUNT; ++i)
+    {
+        unsigned int id, length;
+        float m[16];
+        char name[32];
+        if (stream->read(&id, sizeof(id), 1) != 1 || stream->read(m, sizeof(float), 16) != 16 ||
+            stream->read(&length, sizeof(length), 1) != 1 || length >= sizeof(name) ||
+            stream->read(name, 1, length) != length)
+        {
+            return -1.0;
+        }
+        checksum += id + m[0] + m[15] + length + name[length - 1];
+    }
+    return checksum;
+}
+
+/**
+ * Reads the records with the inline typed readers of BufferedStream.
+ */
+static double readRecordsTyped(BufferedStream* stream)
+{
+    double checksum = 0.0;
+    for (unsigned int i = 0; i < RECORD_COUNT; ++i)
+    {
+        unsigned int id, length;
+        float m[16];
+        char name[32];
+        if (!stream->read(&id) || !stream->readArray(m, 16) ||
+            !stream->read(&length) || length >= sizeof(name) ||
+            !stream->readArray(name, length))
+        {
+            return -1.0;
+        }
+        checksum += id + m[0] + m[15] + length + name[length - 1];
+    }
+    return checksum;
+}
+
+void benchmarkStream()
+{
+    FileSystem::setResourcePath(getTestResourcePath());
+    TEST_CHECK(writeRecords());
+
+    clock_t start = clock();
+    Stream* stream = FileSystem::open(STREAM_FILE);
+    TEST_CHECK(stream != NULL);
+    const double expected = stream ? readRecords(stream) : 0.0;
+    SAFE_DELETE(stream);
+    reportBenchmark("FileStream read (records)", RECORD_COUNT, start);
+    TEST_CHECK(expected > 0.0);
+
+    start = clock();
+    BufferedStream* buffered = BufferedStream::create(FileSystem::open(STREAM_FILE));
+    TEST_CHECK(buffered != NULL);
+    TEST_CHECK(buffered && readRecords(buffered) == expected);
+    SAFE_DELETE(buffered);
+    reportBenchmark("BufferedStream read (records)", RECORD_COUNT, start);
+
+    start = clock();
+    buffered = BufferedStream::create(FileSystem::open(STREAM_FILE));
+    TEST_CHECK(buffered != NULL);
+    TEST_CHECK(buffered && readRecordsTyped(buffered) == expected);
+    SAFE_DELETE(buffered);
+    reportBenchmark("BufferedStream typed read (records)", RECORD_COUNT, start);
+
+    // Reading from memory, as compressed archive entries do once they are inflated.
+    int size = 0;
+    char* data = FileSystem::readAll(STREAM_FILE, &size);
+    TEST_CHECK(data != NULL);
+    if (data)
+    {
+        start = clock();
+        buffered = BufferedStream::create(data, (size_t)size);
+        TEST_CHECK(readRecordsTyped(buffered) == expected);
+        SAFE_DELETE(buffered);
+        reportBenchmark("BufferedStream typed read from memory (records)", RECORD_COUNT, start);
+    }
+
+    remove((std::string(FileSystem::getResourcePath()) + STREAM_FILE).c_str());
+}
+
+}
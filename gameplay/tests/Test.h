@@ -0,0 +1,64 @@
+#ifndef TEST_H_
+#define TEST_H_
+
+#include "Base.h"
+
+namespace gameplay
+{
+
+/**
+ * Records a failed check and logs where it failed.
+ *
+ * @param file The source file of the check.
+ * @param line The line of the check.
+ * @param expression The expression that was false.
+ */
+void testFailed(const char* file, int line, const char* expression);
+
+/**
+ * Gets the path of the directory holding the test resources.
+ *
+ * @return The resource path, ending with a slash.
+ */
+const char* getTestResourcePath();
+
+/**
+ * Prints how long a benchmark took in total and per operation.
+ *
+ * @param name The name of the benchmark.
+ * @param operationCount The number of operations timed.
+ * @param start The processor time when the benchmark started, from clock().
+ */
+void reportBenchmark(const char* name, unsigned int operationCount, clock_t start);
+
+void testAIMessage();
+void testTimeEventWheel();
+void testPoolAllocator();
+void testProperties();
+void testArchive();
+void testResourceCache();
+void testTransform();
+void testMathUtil();
+void testAudioBuffer();
+
+void benchmarkArchive();
+void benchmarkBatchMath();
+void benchmarkMathUtil();
+void benchmarkPropertiesGet();
+void benchmarkPropertiesLoad();
+void benchmarkStream();
+void benchmarkTimeEventWheel();
+
+}
+
+/**
+ * Checks that an expression is true, recording a failure of the current test if it is not.
+ */
+#define TEST_CHECK(expression) \
+    do \
+    { \
+        if (!(expression)) \
+            gameplay::testFailed(__FILE__, __LINE__, #expression); \
+    } while (0)
+
+#endif
@@ -0,0 +1,114 @@
+#include "Test.h"
+#include "TimeEventWheel.h"
+
+namespace gameplay
+{
+
+static const unsigned int EVENT_COUNT = 1000000;
+static const double SCHEDULE_SPAN = 60000.0;
+static const double FRAME_TIME = 16.0;
+
+/**
+ * Counts the events it receives.
+ */
+class CountingTimeListener : public TimeListener
+{
+public:
+
+    CountingTimeListener() : eventCount(0) { }
+
+    void timeEvent(long timeDiff, void* cookie)
+    {
+        ++eventCount;
+    }
+
+    unsigned int eventCount;
+};
+
+/**
+ * A time event held in a priority queue, as Game held them before the timing wheel.
+ */
+struct QueuedTimeEvent
+{
+    double time;
+    TimeListener* listener;
+    void* cookie;
+
+    bool operator<(const QueuedTimeEvent& e) const
+    {
+        return time > e.time;
+    }
+};
+
+static double eventTime(unsigned int i)
+{
+    return (double)((i * 2654435761u) % (unsigned int)(SCHEDULE_SPAN * 4)) * 0.25;
+}
+
+void benchmarkTimeEventWheel()
+{
+    // Schedule a minute of events, cancel every fourth one, then fire the rest frame by frame.
+    {
+        TimeEventWheel wheel;
+        CountingTimeListener listener;
+        std::vector<unsigned int> handles(EVENT_COUNT);
+
+        clock_t start = clock();
+        for (unsigned int i = 0; i < EVENT_COUNT; ++i)
+            handles[i] = wheel.add(0.0, eventTime(i), &listener, NULL);
+        reportBenchmark("TimeEventWheel::add", EVENT_COUNT, start);
+
+        start = clock();
+        for (unsigned int i = 0; i < EVENT_COUNT; i += 4)
+            wheel.remove(handles[i]);
+        reportBenchmark("TimeEventWheel::remove", EVENT_COUNT / 4, start);
+
+        start = clock();
+        for (double time = 0.0; time <= SCHEDULE_SPAN; time += FRAME_TIME)
+            wheel.fire(time);
+        wheel.fire(SCHEDULE_SPAN);
+        reportBenchmark("TimeEventWheel::fire", listener.eventCount, start);
+        TEST_CHECK(listener.eventCount == EVENT_COUNT - EVENT_COUNT / 4);
+        TEST_CHECK(wheel.getEventCount() == 0);
+    }
+
+    // The same events through a priority queue, which can't cancel them.
+    {
+        std::priority_queue<QueuedTimeEvent> queue;
+        CountingTimeListener listener;
+
+        clock_t start = clock();
+        for (unsigned int i = 0; i < EVENT_COUNT; ++i)
+        {
+            if (i % 4 == 0)
+                continue;
+            QueuedTimeEvent event;
+            event.time = eventTime(i);
+            event.listener = &listener;
+            event.cookie = NULL;
+            queue.push(event);
+        }
+        reportBenchmark("std::priority_queue push", EVENT_COUNT - EVENT_COUNT / 4, start);
+
+        start = clock();
+        for (double time = 0.0; time <= SCHEDULE_SPAN; time += FRAME_TIME)
+        {
+            while (!queue.empty() && queue.top().time <= time)
+            {
+                QueuedTimeEvent event = queue.top();
+                queue.pop();
+                event.listener->timeEvent((long)(time - event.time), event.cookie);
+            }
+        }
+        while (!queue.empty())
+        {
+            QueuedTimeEvent event = queue.top();
+            queue.pop();
+            event.listener->timeEvent((long)(SCHEDULE_SPAN - event.time), event.cookie);
+        }
+        reportBenchmark("std::priority_queue pop", listener.eventCount, start);
+        TEST_CHECK(listener.eventCount == EVENT_COUNT - EVENT_COUNT / 4);
+    }
+}
+
+}
@@ -0,0 +1,131 @@
+#include "Test.h"
+#include "TimeEventWheel.h"
+
+namespace gameplay
+{
+
+/**
+ * Records the cookies of the events it receives, and optionally schedules or
+ * cancels another event from within an event.
+ */
+class TestTimeListener : public TimeListener
+{
+public:
+
+    TestTimeListener() : wheel(NULL), scheduleTime(-1.0), cancelHandle(0) { }
+
+    void timeEvent(long timeDiff, void* cookie)
+    {
+        fired.push_back((int)(intptr_t)cookie);
+        timeDiffs.push_back(timeDiff);
+
+        if (wheel && scheduleTime >= 0.0)
+        {
+            wheel->add(scheduleTime, scheduleTime, this, (void*)(intptr_t)100);
+            scheduleTime = -1.0;
+        }
+        if (wheel && cancelHandle)
+        {
+            wheel->remove(cancelHandle);
+            cancelHandle = 0;
+        }
+    }
+
+    std::vector<int> fired;
+    std::vector<long> timeDiffs;
+    TimeEventWheel* wheel;
+    double scheduleTime;
+    unsigned int cancelHandle;
+};
+
+void testTimeEventWheel()
+{
+    // Events fire in order of their time, including events within the same millisecond
+    // and events far enough ahead to be held by the upper wheels.
+    {
+        TimeEventWheel wheel;
+        TestTimeListener listener;
+        const double times[] = { 5000000.0, 20.75, 300.0, 20.25, 70000.0, 1.0 };
+        for (int i = 0; i < 6; ++i)
+            wheel.add(0.0, times[i], &listener, (void*)(intptr_t)i);
+        TEST_CHECK(wheel.getEventCount() == 6);
+
+        wheel.fire(0.5);
+        TEST_CHECK(listener.fired.empty());
+
+        wheel.fire(21.0);
+        TEST_CHECK(listener.fired.size() == 3);
+        if (listener.fired.size() == 3)
+        {
+            TEST_CHECK(listener.fired[0] == 5);
+            TEST_CHECK(listener.fired[1] == 3);
+            TEST_CHECK(listener.fired[2] == 1);
+        }
+
+        // Events never fire before their time.
+        wheel.fire(299.0);
+        TEST_CHECK(listener.fired.size() == 3);
+
+        wheel.fire(80000.0);
+        TEST_CHECK(listener.fired.size() == 5);
+        if (listener.fired.size() == 5)
+        {
+            TEST_CHECK(listener.fired[3] == 2);
+            TEST_CHECK(listener.fired[4] == 4);
+            TEST_CHECK(listener.timeDiffs[4] == 10000);
+        }
+
+        wheel.fire(5000000.0);
+        TEST_CHECK(listener.fired.size() == 6 && listener.fired[5] == 0);
+        TEST_CHECK(wheel.getEventCount() == 0);
+    }
+
+    // Removed events do not fire, and handles become invalid once their event is gone.
+    {
+        TimeEventWheel wheel;
+        TestTimeListener listener;
+        unsigned int first = wheel.add(0.0, 10.0, &listener, (void*)(intptr_t)1);
+        unsigned int second = wheel.add(0.0, 10.0, &listener, (void*)(intptr_t)2);
+        TEST_CHECK(first != 0 && second != 0 && first != second);
+        TEST_CHECK(wheel.remove(first));
+        TEST_CHECK(!wheel.remove(first));
+        TEST_CHECK(wheel.getEventCount() == 1);
+
+        // The freed event is reused, but the old handle does not refer to it.
+        unsigned int third = wheel.add(0.0, 20.0, &listener, (void*)(intptr_t)3);
+        TEST_CHECK(third != first);
+        TEST_CHECK(!wheel.remove(first));
+
+        wheel.fire(10.0);
+        TEST_CHECK(listener.fired.size() == 1 && listener.fired[0] == 2);
+        TEST_CHECK(!wheel.remove(second));
+
+        wheel.clear();
+        TEST_CHECK(wheel.getEventCount() == 0);
+        TEST_CHECK(!wheel.remove(third));
+        wheel.fire(100.0);
+        TEST_CHECK(listener.fired.size() == 1);
+    }
+
+    // Events scheduled from an event fire no earlier than the next call to fire(),
+    // and events cancelled from an event do not fire.
+    {
+        TimeEventWheel wheel;
+        TestTimeListener listener;
+        listener.wheel = &wheel;
+        wheel.add(0.0, 5.0, &listener, (void*)(intptr_t)1);
+        unsigned int cancelled = wheel.add(0.0, 6.0, &listener, (void*)(intptr_t)2);
+        listener.scheduleTime = 5.0;
+        listener.cancelHandle = cancelled;
+
+        wheel.fire(10.0);
+        TEST_CHECK(listener.fired.size() == 1 && listener.fired[0] == 1);
+        TEST_CHECK(wheel.getEventCount() == 1);
+
+        wheel.fire(11.0);
+        TEST_CHECK(listener.fired.size() == 2 && listener.fired[1] == 100);
+        TEST_CHECK(wheel.getEventCount() == 0);
+    }
+}
+
+}
@@ -0,0 +1,63 @@
+#include "Test.h"
+#include "Transform.h"
+
+namespace gameplay
+{
+
+/**
+ * A transform listener that counts its calls and can remove a listener when it is called.
+ */
+class CountingListener : public Transform::Listener
+{
+public:
+
+    CountingListener() : callCount(0), removeOnCall(NULL) { }
+
+    void transformChanged(Transform* transform, long cookie)
+    {
+        ++callCount;
+        if (removeOnCall)
+        {
+            transform->removeListener(removeOnCall);
+            removeOnCall = NULL;
+        }
+    }
+
+    unsigned int callCount;
+    Transform::Listener* removeOnCall;
+};
+
+void testTransform()
+{
+    Transform transform;
+    CountingListener first, second, third;
+    transform.addListener(&first);
+    transform.addListener(&second);
+    transform.addListener(&third);
+
+    transform.setTranslation(1.0f, 0.0f, 0.0f);
+    TEST_CHECK(first.callCount == 1 && second.callCount == 1 && third.callCount == 1);
+
+    // A listener that removes itself does not stop the next listener from being notified.
+    first.removeOnCall = &first;
+    transform.setTranslation(2.0f, 0.0f, 0.0f);
+    TEST_CHECK(first.callCount == 2 && second.callCount == 2 && third.callCount == 2);
+    transform.setTranslation(3.0f, 0.0f, 0.0f);
+    TEST_CHECK(first.callCount == 2 && second.callCount == 3 && third.callCount == 3);
+
+    // A listener removed by an earlier one is not notified.
+    second.removeOnCall = &third;
+    transform.setTranslation(4.0f, 0.0f, 0.0f);
+    TEST_CHECK(second.callCount == 4 && third.callCount == 3);
+
+    // Listeners can be added again once removed.
+    transform.addListener(&first);
+    transform.setTranslation(5.0f, 0.0f, 0.0f);
+    TEST_CHECK(first.callCount == 3 && second.callCount == 5 && third.callCount == 3);
+    transform.removeListener(&first);
+    transform.removeListener(&second);
+    transform.setTranslation(6.0f, 0.0f, 0.0f);
+    TEST_CHECK(first.callCount == 3 && second.callCount == 5);
+}
+
+}
@@ -0,0 +1,122 @@
+#include "Test.h"
+
+using namespace gameplay;
+
+namespace gameplay
+{
+
+static unsigned int __failureCount = 0;
+static std::string __resourcePath;
+
+void testFailed(const char* file, int line, const char* expression)
+{
+    printf("%s(%d): check failed: %s\n", file, line, expression);
+    ++__failureCount;
+}
+
+const char* getTestResourcePath()
+{
+    return __resourcePath.c_str();
+}
+
+void reportBenchmark(const char* name, unsigned int operationCount, clock_t start)
+{
+    const double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    printf("%s: %u operations in %.3f ms (%.2f ns each)\n", name, operationCount, seconds * 1000.0,
+        operationCount ? seconds * 1e9 / operationCount : 0.0);
+}
+
+}
+
+struct TestCase
+{
+    const char* name;
+    void (*run)();
+};
+
+static const TestCase __tests[] =
+{
+    { "AIMessage", testAIMessage },
+    { "TimeEventWheel", testTimeEventWheel },
+    { "PoolAllocator", testPoolAllocator },
+    { "Properties", testProperties },
+    { "Archive", testArchive },
+    { "ResourceCache", testResourceCache },
+    { "Transform", testTransform },
+    { "MathUtil", testMathUtil },
+    { "AudioBuffer", testAudioBuffer }
+};
+
+// Benchmarks print timings rather than checking them, so they are only run when named.
+static const TestCase __benchmarks[] =
+{
+    { "ArchiveBenchmark", benchmarkArchive },
+    { "BatchMathBenchmark", benchmarkBatchMath },
+    { "MathUtilBenchmark", benchmarkMathUtil },
+    { "PropertiesGetBenchmark", benchmarkPropertiesGet },
+    { "PropertiesLoadBenchmark", benchmarkPropertiesLoad },
+    { "StreamBenchmark", benchmarkStream },
+    { "TimeEventWheelBenchmark", benchmarkTimeEventWheel }
+};
+
+/**
+ * Runs a test and prints whether it passed.
+ *
+ * @return True if the test passed.
+ */
+static bool runTest(const TestCase& test)
+{
+    unsigned int failureCount = __failureCount;
+    test.run();
+    if (__failureCount != failureCount)
+    {
+        printf("%s: FAILED\n", test.name);
+        return false;
+    }
+    printf("%s: passed\n", test.name);
+    return true;
+}
+
+/**
+ * Runs the tests.
+ *
+ * Usage: gameplay-tests [test name] [resource path]
+ *
+ * Runs all tests if no test name is given. Benchmarks are only run by name.
+ * The resource path defaults to "res/".
+ */
+int main(int argc, char** argv)
+{
+    const char* name = argc > 1 ? argv[1] : NULL;
+    __resourcePath = argc > 2 ? argv[2] : "res/";
+    if (!__resourcePath.empty() && __resourcePath[__resourcePath.size() - 1] != '/')
+        __resourcePath += '/';
+
+    unsigned int runCount = 0;
+    unsigned int failedCount = 0;
+    for (unsigned int i = 0; i < sizeof(__tests) / sizeof(__tests[0]); ++i)
+    {
+        if (name && strcmp(name, __tests[i].name) != 0)
+            continue;
+
+        ++runCount;
+        if (!runTest(__tests[i]))
+            ++failedCount;
+    }
+    for (unsigned int i = 0; name && i < sizeof(__benchmarks) / sizeof(__benchmarks[0]); ++i)
+    {
+        if (strcmp(name, __benchmarks[i].name) != 0)
+            continue;
+
+        ++runCount;
+        if (!runTest(__benchmarks[i]))
+            ++failedCount;
+    }
+
+    if (runCount == 0)
+    {
+        printf("Unknown test '%s'.\n", name);
+        return 1;
+    }
+    return failedCount == 0 ? 0 : 1;
+}
@@ -0,0 +1,20 @@
+-- Visitors timed by SceneVisitBenchmark.
+
+lightCount = 0
+
+-- Called by Scene:visit once per node.
+function countLight(node)
+    if node:getLight() then
+        lightCount = lightCount + 1
+    end
+    return true
+end
+
+-- Called by Scene:visitNodes once with the nodes that have a light.
+function countLights(nodes)
+    for i = 1, #nodes do
+        if nodes[i]:getLight() then
+            lightCount = lightCount + 1
+        end
+    end
+end
@@ -83,7 +83,7 @@ void RacerGame::initialize()
     }
 
     // Create audio tracks
-    _backgroundSound = AudioSource::create("res/common/background_track.ogg");
+    _backgroundSound = AudioSource::create("res/common/background_track.ogg", true);
     if (_backgroundSound)
     {
         _backgroundSound->setLooped(true);
@@ -95,7 +95,7 @@ void SpaceshipGame::initialize()
     initializeEnvironment();
 
     // Create a background audio track
-    _backgroundSound = AudioSource::create("res/background.ogg");
+    _backgroundSound = AudioSource::create("res/background.ogg", true);
     if (_backgroundSound)
         _backgroundSound->setLooped(true);
 
@@ -0,0 +1,252 @@
+#include "Base.h"
+#include "ArchiveEncoder.h"
+#include "FileIO.h"
+#include <zlib.h>
+
+#ifdef WIN32
+    #include <windows.h>
+#else
+    #include <dirent.h>
+#endif
+
+// Version of the archive format.
+#define ARCHIVE_VERSION_MAJOR 1
+#define ARCHIVE_VERSION_MINOR 0
+
+// Uncompressed files start on a multiple of this many bytes within the archive.
+#define ARCHIVE_ALIGNMENT 16
+
+// Size of a directory entry: hash, name offset, offset, size and stored size.
+#define ARCHIVE_ENTRY_SIZE 20
+
+namespace gameplay
+{
+
+/**
+ * A file to be written to an archive.
+ */
+struct ArchiveFile
+{
+    std::string name;
+    std::string path;
+    unsigned int hash;
+    unsigned int nameOffset;
+    unsigned int offset;
+    unsigned int size;
+    unsigned int storedSize;
+};
+
+/**
+ * Hashes a path within the archive (32-bit FNV-1a). Must match the hash used by FileSystem.
+ */
+static unsigned int hashPath(const char* path)
+{
+    unsigned int hash = 2166136261u;
+    while (*path)
+    {
+        hash ^= (unsigned char)*path++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static bool compareArchiveFiles(const ArchiveFile& a, const ArchiveFile& b)
+{
+    if (a.hash != b.hash)
+        return a.hash < b.hash;
+    return a.name < b.name;
+}
+
+/**
+ * Adds the files in a directory and its subdirectories to the list of files.
+ *
+ * @param dirPath The path of the directory on disk.
+ * @param prefix The name of the directory within the archive, ending in '/' or empty.
+ * @param files The list to add the files to.
+ */
+static bool listFiles(const std::string& dirPath, const std::string& prefix, std::vector<ArchiveFile>& files)
+{
+#ifdef WIN32
+    WIN32_FIND_DATAA findData;
+    HANDLE find = FindFirstFileA((dirPath + "/*").c_str(), &findData);
+    if (find == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+    do
+    {
+        std::string name(findData.cFileName);
+        if (name == "." || name == "..")
+            continue;
+
+        if ((findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0)
+        {
+            listFiles(dirPath + "/" + name, prefix + name + "/", files);
+        }
+        else
+        {
+            ArchiveFile file;
+            file.name = prefix + name;
+            file.path = dirPath + "/" + name;
+            files.push_back(file);
+        }
+    } while (FindNextFileA(find, &findData) != 0);
+
+    FindClose(find);
+    return true;
+#else
+    DIR* dir = opendir(dirPath.c_str());
+    if (dir == NULL)
+    {
+        return false;
+    }
+    struct dirent* dp;
+    while ((dp = readdir(dir)) != NULL)
+    {
+        std::string name(dp->d_name);
+        if (name == "." || name == "..")
+            continue;
+
+        std::string path(dirPath + "/" + name);
+        struct stat buf;
+        if (stat(path.c_str(), &buf) != 0)
+            continue;
+
+        if (S_ISDIR(buf.st_mode))
+        {
+            listFiles(path, prefix + name + "/", files);
+        }
+        else
+        {
+            ArchiveFile file;
+            file.name = prefix + name;
+            file.path = path;
+            files.push_back(file);
+        }
+    }
+    closedir(dir);
+    return true;
+#endif
+}
+
+/**
+ * Writes zero bytes until the file position is a multiple of ARCHIVE_ALIGNMENT.
+ */
+static void writeAlignment(FILE* file)
+{
+    long int position = ftell(file);
+    while (position % ARCHIVE_ALIGNMENT != 0)
+    {
+        write((unsigned char)0, file);
+        ++position;
+    }
+}
+
+int writeArchive(const char* inDirPath, const char* outFilePath, bool compress)
+{
+    std::vector<ArchiveFile> files;
+    if (!listFiles(inDirPath, "", files))
+    {
+        LOG(1, "Failed to open directory: '%s'\n", inDirPath);
+        return -1;
+    }
+
+    // The directory is sorted by hash so that FileSystem can binary search it.
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        files[i].hash = hashPath(files[i].name.c_str());
+    }
+    std::sort(files.begin(), files.end(), compareArchiveFiles);
+
+    unsigned int namesSize = 0;
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        files[i].nameOffset = namesSize;
+        namesSize += files[i].name.length() + 1;
+    }
+
+    FILE* file = fopen(outFilePath, "wb");
+    if (file == NULL)
+    {
+        LOG(1, "Failed to open file for writing: '%s'\n", outFilePath);
+        return -1;
+    }
+
+    // File header and version.
+    char identifier[] = { '\xAB', 'G', 'P', 'K', '\xBB', '\r', '\n', '\x1A', '\n' };
+    fwrite(identifier, 1, sizeof(identifier), file);
+    write((unsigned char)ARCHIVE_VERSION_MAJOR, file);
+    write((unsigned char)ARCHIVE_VERSION_MINOR, file);
+    write((unsigned int)files.size(), file);
+    write(namesSize, file);
+
+    // The directory is written once the offset and size of each file are known.
+    long int directoryPosition = ftell(file);
+    for (size_t i = 0; i < files.size() * ARCHIVE_ENTRY_SIZE; ++i)
+    {
+        write((unsigned char)0, file);
+    }
+
+    // NULL-terminated names, referenced from the directory by offset.
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        fwrite(files[i].name.c_str(), 1, files[i].name.length() + 1, file);
+    }
+
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        ArchiveFile& archiveFile = files[i];
+        std::ifstream in(archiveFile.path.c_str(), std::ios::in | std::ios::binary);
+        if (!in)
+        {
+            LOG(1, "Failed to open file: '%s'\n", archiveFile.path.c_str());
+            fclose(file);
+            return -1;
+        }
+        std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        archiveFile.size = (unsigned int)data.size();
+        archiveFile.storedSize = archiveFile.size;
+
+        // Files are only stored compressed if that saves at least an eighth of their size,
+        // since already compressed formats such as PNG and OGG gain little.
+        std::vector<unsigned char> compressed;
+        if (compress && !data.empty())
+        {
+            uLongf compressedSize = compressBound(data.size());
+            compressed.resize(compressedSize);
+            if (compress2(&compressed[0], &compressedSize, (const Bytef*)data.data(), data.size(), Z_BEST_COMPRESSION) == Z_OK &&
+                compressedSize < data.size() - data.size() / 8)
+            {
+                archiveFile.storedSize = (unsigned int)compressedSize;
+            }
+        }
+
+        if (archiveFile.storedSize == archiveFile.size)
+        {
+            writeAlignment(file);
+            archiveFile.offset = (unsigned int)ftell(file);
+            fwrite(data.data(), 1, data.size(), file);
+        }
+        else
+        {
+            archiveFile.offset = (unsigned int)ftell(file);
+            fwrite(&compressed[0], 1, archiveFile.storedSize, file);
+        }
+        LOG(2, "  %s (%u bytes, %u stored)\n", archiveFile.name.c_str(), archiveFile.size, archiveFile.storedSize);
+    }
+
+    fseek(file, directoryPosition, SEEK_SET);
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        write(files[i].hash, file);
+        write(files[i].nameOffset, file);
+        write(files[i].offset, file);
+        write(files[i].size, file);
+        write(files[i].storedSize, file);
+    }
+
+    fclose(file);
+    return 0;
+}
+
+}
@@ -0,0 +1,25 @@
+#ifndef ARCHIVEENCODER_H_
+#define ARCHIVEENCODER_H_
+
+namespace gameplay
+{
+
+/**
+ * Packs the files in a directory and its subdirectories into a resource archive
+ * that can be mounted at runtime with FileSystem::mountArchive().
+ *
+ * Files are named in the archive by their path relative to the directory, using
+ * forward slashes. The directory is sorted by the hash of each name so it can be
+ * searched without parsing. Uncompressed files start on a 16-byte boundary.
+ *
+ * @param inDirPath Input path to the directory to pack.
+ * @param outFilePath Output file path to write the archive to.
+ * @param compress True to compress each file with zlib where it makes the file smaller.
+ *
+ * @return 0 if successful, -1 if error.
+ */
+int writeArchive(const char* inDirPath, const char* outFilePath, bool compress);
+
+}
+
+#endif
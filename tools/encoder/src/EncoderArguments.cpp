@@ -28,7 +28,9 @@ EncoderArguments::EncoderArguments(size_t argc, const char** argv) :
     _textOutput(false),
     _optimizeAnimations(false),
     _animationGrouping(ANIMATIONGROUP_PROMPT),
-    _outputMaterial(false)
+    _outputMaterial(false),
+    _archive(false),
+    _archiveCompression(true)
 {
     __instance = this;
 
@@ -102,8 +104,14 @@ std::string EncoderArguments::getOutputDirPath() const
 
 std::string EncoderArguments::getOutputFileExtension() const
 {
+    if (_archive)
+        return ".gpk";
+
     switch (getFileFormat())
     {
+    case FILEFORMAT_PROPERTIES:
+        return ".gpp";
+
     case FILEFORMAT_PNG:
     case FILEFORMAT_RAW:
         if (_normalMap)
@@ -124,7 +132,9 @@ std::string EncoderArguments::getOutputFilePath() const
     else
     {
         // Generate an output file path
-        int pos = _filePath.find_last_of('.');
+        // Properties files keep their extension so that e.g. duck.material and duck.scene don't collide.
+        // Directories being packed have no extension to replace.
+        int pos = (_archive || getFileFormat() == FILEFORMAT_PROPERTIES) ? -1 : _filePath.find_last_of('.');
         std::string outputFilePath(pos > 0 ? _filePath.substr(0, pos) : _filePath);
 
         // Modify the original file name if the output extension can be the same as the input
@@ -241,10 +251,18 @@ void EncoderArguments::printUsage() const
     "Supported file extensions:\n" \
     "  .fbx\t(FBX scenes)\n" \
     "  .ttf\t(TrueType fonts)\n" \
+    "  .material, .scene, .form, .theme, .particle, .physics, .properties\n" \
+        "\t\t(Properties files, compiled to binary)\n" \
     "\n" \
     "General options:\n" \
     "  -v <verbosity>\tVerbosity level (0-4).\n" \
     "\n" \
+    "Archive options:\n" \
+    "  -a\t\tPack the input directory into a resource archive (.gpk),\n" \
+        "\t\tcompressing files where it makes them smaller.\n" \
+    "  -a:store\tPack the input directory without compressing files.\n" \
+        "\t\tArchives are mounted with FileSystem::mountArchive().\n" \
+    "\n" \
     "FBX file options:\n" \
     "  -i <id>\tFilter by node ID.\n" \
     "  -t\t\tWrite text/xml.\n" \
@@ -290,6 +308,12 @@ void EncoderArguments::printUsage() const
     "  -s <sizes>\tComma-separated list of font sizes (in pixels).\n" \
     "  -p\t\tOutput font preview.\n" \
     "  -f\t\tFormat of font. -f:b (BITMAP), -f:d (DISTANCE_FIELD).\n" \
+    "\n" \
+    "Properties files:\n" \
+        "\t\tProperties files are compiled with their inheritance resolved\n" \
+        "\t\tand their numeric values parsed. Properties::create() detects\n" \
+        "\t\tcompiled files by their header, so the output file can replace\n" \
+        "\t\tthe text file under its original name.\n" \
     "\n");
     exit(8);
 }
@@ -319,6 +343,16 @@ bool EncoderArguments::outputMaterialEnabled() const
     return _outputMaterial;
 }
 
+bool EncoderArguments::archiveEnabled() const
+{
+    return _archive;
+}
+
+bool EncoderArguments::archiveCompressionEnabled() const
+{
+    return _archiveCompression;
+}
+
 const char* EncoderArguments::getNodeId() const
 {
     if (_nodeId.length() == 0)
@@ -374,6 +408,12 @@ EncoderArguments::FileFormat EncoderArguments::getFileFormat() const
     {
         return FILEFORMAT_RAW;
     }
+    if (ext.compare("material") == 0 || ext.compare("scene") == 0 || ext.compare("form") == 0 ||
+        ext.compare("theme") == 0 || ext.compare("particle") == 0 || ext.compare("physics") == 0 ||
+        ext.compare("properties") == 0)
+    {
+        return FILEFORMAT_PROPERTIES;
+    }
 
     return FILEFORMAT_UNKNOWN;
 }
@@ -387,6 +427,17 @@ void EncoderArguments::readOption(const std::vector<std::string>& options, size_
     }
     switch (str[1])
     {
+    case 'a':
+        if (str.compare("-a") == 0)
+        {
+            _archive = true;
+        }
+        else if (str.compare("-a:store") == 0)
+        {
+            _archive = true;
+            _archiveCompression = false;
+        }
+        break;
     case 'f':
         if (str.compare("-f:b") == 0)
         {
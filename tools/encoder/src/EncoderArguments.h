@@ -23,7 +23,8 @@ public:
         FILEFORMAT_TTF,
         FILEFORMAT_GPB,
         FILEFORMAT_PNG,
-        FILEFORMAT_RAW
+        FILEFORMAT_RAW,
+        FILEFORMAT_PROPERTIES
     };
 
     struct HeightmapOption
@@ -164,6 +165,16 @@ public:
 
     bool outputMaterialEnabled() const;
 
+    /**
+     * Returns true if the input path is a directory to pack into a resource archive.
+     */
+    bool archiveEnabled() const;
+
+    /**
+     * Returns true if files should be compressed when packed into a resource archive.
+     */
+    bool archiveCompressionEnabled() const;
+
     const char* getNodeId() const;
 
     static std::string getRealPath(const std::string& filepath);
@@ -210,6 +221,8 @@ private:
     bool _optimizeAnimations;
     AnimationGroupOption _animationGrouping;
     bool _outputMaterial;
+    bool _archive;
+    bool _archiveCompression;
 
     std::vector<std::string> _groupAnimationNodeId;
     std::vector<std::string> _groupAnimationAnimationId;
@@ -0,0 +1,650 @@
+#include "Base.h"
+#include "PropertiesEncoder.h"
+#include "FileIO.h"
+
+// Version of the compiled properties format.
+#define PROPERTIES_VERSION_MAJOR 1
+#define PROPERTIES_VERSION_MINOR 0
+
+// Number count written for values that are not parsed ahead of time, such as variable references.
+#define PROPERTIES_NUMBERS_UNPARSED 0xFF
+
+// Maximum number of numbers written for a value (a matrix).
+#define PROPERTIES_NUMBERS_MAX 16
+
+namespace gameplay
+{
+
+typedef std::pair<std::string, std::string> PropertiesPair;
+
+/**
+ * A namespace read from a text properties file.
+ */
+struct PropertiesNamespace
+{
+    std::string name;
+    std::string id;
+    std::string parentID;
+    std::vector<PropertiesPair> properties;
+    std::vector<PropertiesPair> variables;
+    std::vector<PropertiesNamespace*> namespaces;
+    PropertiesNamespace* parent;
+
+    PropertiesNamespace() : parent(NULL) { }
+
+    ~PropertiesNamespace()
+    {
+        for (size_t i = 0; i < namespaces.size(); ++i)
+        {
+            delete namespaces[i];
+        }
+    }
+};
+
+/**
+ * Reads a text file held in memory with the same semantics as the runtime Stream,
+ * so that the parser below can follow the runtime Properties parser line for line.
+ */
+class PropertiesStream
+{
+public:
+
+    PropertiesStream(const std::string& text) : _text(text), _position(0) { }
+
+    bool eof() const
+    {
+        return _position >= _text.size();
+    }
+
+    signed char readChar()
+    {
+        if (eof())
+            return EOF;
+        return (signed char)_text[_position++];
+    }
+
+    char* readLine(char* str, int num)
+    {
+        if (eof())
+            return NULL;
+        int i = 0;
+        while (i < num - 1 && !eof())
+        {
+            char c = _text[_position++];
+            str[i++] = c;
+            if (c == '\n')
+                break;
+        }
+        str[i] = '\0';
+        return str;
+    }
+
+    bool seek(long int offset)
+    {
+        long int position = (long int)_position + offset;
+        if (position < 0 || position > (long int)_text.size())
+            return false;
+        _position = (size_t)position;
+        return true;
+    }
+
+private:
+
+    const std::string& _text;
+    size_t _position;
+};
+
+static bool isVariable(const char* str, char* outName, size_t outSize)
+{
+    size_t len = strlen(str);
+    if (len > 3 && str[0] == '$' && str[1] == '{' && str[len - 1] == '}')
+    {
+        size_t size = len - 3;
+        if (size > (outSize - 1))
+            size = outSize - 1;
+        strncpy(outName, str + 2, size);
+        outName[size] = 0;
+        return true;
+    }
+
+    return false;
+}
+
+static char* trimWhiteSpace(char* str)
+{
+    if (str == NULL)
+    {
+        return str;
+    }
+
+    // Trim leading space.
+    while (isspace(*str))
+        str++;
+
+    // All spaces?
+    if (*str == 0)
+    {
+        return str;
+    }
+
+    // Trim trailing space.
+    char* end = str + strlen(str) - 1;
+    while (end > str && isspace(*end))
+        end--;
+
+    // Write new null terminator.
+    *(end + 1) = 0;
+
+    return str;
+}
+
+static void skipWhiteSpace(PropertiesStream* stream)
+{
+    signed char c;
+    do
+    {
+        c = stream->readChar();
+    } while (isspace(c) && c != EOF);
+
+    // Put the cursor back in front of the non-whitespace character.
+    if (c != EOF)
+    {
+        stream->seek(-1);
+    }
+}
+
+static void setVariable(PropertiesNamespace* space, const char* name, const char* value)
+{
+    // Update the variable in this namespace or a parent if it exists already.
+    PropertiesPair* variable = NULL;
+    for (PropertiesNamespace* current = space; current; current = current->parent)
+    {
+        for (size_t i = 0; i < current->variables.size(); ++i)
+        {
+            if (current->variables[i].first == name)
+            {
+                variable = &current->variables[i];
+                break;
+            }
+        }
+    }
+
+    if (variable)
+    {
+        variable->second = value;
+    }
+    else
+    {
+        space->variables.push_back(PropertiesPair(name, value));
+    }
+}
+
+static bool seekBeforeNamespaceEnd(PropertiesStream* stream)
+{
+    if (!stream->seek(-1))
+        return false;
+    while (stream->readChar() != '}')
+    {
+        if (!stream->seek(-2))
+            return false;
+    }
+    return stream->seek(-1);
+}
+
+static bool readNamespace(PropertiesStream* stream, PropertiesNamespace* space);
+
+static PropertiesNamespace* createNamespace(PropertiesStream* stream, const char* name, const char* id, const char* parentID, PropertiesNamespace* parent)
+{
+    PropertiesNamespace* space = new PropertiesNamespace();
+    space->name = name;
+    if (id)
+        space->id = id;
+    if (parentID)
+        space->parentID = parentID;
+    space->parent = parent;
+    parent->namespaces.push_back(space);
+
+    return readNamespace(stream, space) ? space : NULL;
+}
+
+static bool readNamespace(PropertiesStream* stream, PropertiesNamespace* space)
+{
+    char line[2048];
+    char variable[256];
+    bool comment = false;
+
+    while (true)
+    {
+        // Skip whitespace at the start of lines
+        skipWhiteSpace(stream);
+
+        // Stop when we have reached the end of the file.
+        if (stream->eof())
+            break;
+
+        // Read the next line.
+        if (stream->readLine(line, 2048) == NULL)
+        {
+            LOG(1, "Error reading line from file.\n");
+            return false;
+        }
+
+        // Ignore comments
+        if (comment)
+        {
+            // Check for end of multi-line comment at either start or end of line
+            if (strncmp(line, "*/", 2) == 0)
+                comment = false;
+            else
+            {
+                trimWhiteSpace(line);
+                const int len = strlen(line);
+                if (len >= 2 && strncmp(line + (len - 2), "*/", 2) == 0)
+                    comment = false;
+            }
+        }
+        else if (strncmp(line, "/*", 2) == 0)
+        {
+            // Start of multi-line comment (must be at start of line)
+            comment = true;
+        }
+        else if (strncmp(line, "//", 2) != 0)
+        {
+            if (strchr(line, '=') != NULL)
+            {
+                // Name/value pair.
+                char* name = strtok(line, "=");
+                if (name == NULL)
+                {
+                    LOG(1, "Error parsing properties file: attribute without name.\n");
+                    return false;
+                }
+                name = trimWhiteSpace(name);
+
+                char* value = strtok(NULL, "");
+                if (value == NULL)
+                {
+                    LOG(1, "Error parsing properties file: attribute with name ('%s') but no value.\n", name);
+                    return false;
+                }
+                value = trimWhiteSpace(value);
+
+                if (isVariable(name, variable, 256))
+                {
+                    setVariable(space, variable, value);
+                }
+                else
+                {
+                    space->properties.push_back(PropertiesPair(name, value));
+                }
+            }
+            else
+            {
+                char* parentID = NULL;
+
+                // Get the last character on the line (ignoring whitespace).
+                const char* lineEnd = trimWhiteSpace(line) + (strlen(trimWhiteSpace(line)) - 1);
+
+                // This line might begin or end a namespace, or it might be a key/value pair without '='.
+                char* open = strchr(line, '{');
+                char* inherit = strchr(line, ':');
+                char* close = strchr(line, '}');
+
+                char* name = trimWhiteSpace(strtok(line, " \t\n{"));
+                if (name == NULL)
+                {
+                    LOG(1, "Error parsing properties file: failed to determine a valid token for line '%s'.\n", line);
+                    return false;
+                }
+                else if (name[0] == '}')
+                {
+                    // End of namespace.
+                    return true;
+                }
+
+                // Get its ID and parent ID if it has them.
+                char* value = trimWhiteSpace(strtok(NULL, ":{"));
+                if (inherit != NULL)
+                {
+                    parentID = trimWhiteSpace(strtok(NULL, "{"));
+                }
+
+                bool idless = value != NULL && value[0] == '{';
+                if (idless || open != NULL)
+                {
+                    // If the namespace ends on this line, seek back to right before the '}' character.
+                    bool endsOnLine = close && close == lineEnd;
+                    if (endsOnLine && !seekBeforeNamespaceEnd(stream))
+                    {
+                        LOG(1, "Failed to seek back to before a '}' character in properties file.\n");
+                        return false;
+                    }
+
+                    if (!createNamespace(stream, name, idless ? NULL : value, parentID, space))
+                        return false;
+
+                    // If the namespace ends on this line, seek to right after the '}' character.
+                    if (endsOnLine && !stream->seek(1))
+                    {
+                        LOG(1, "Failed to seek to immediately after a '}' character in properties file.\n");
+                        return false;
+                    }
+                }
+                else
+                {
+                    // Find out if the next line starts with "{"
+                    skipWhiteSpace(stream);
+                    if (stream->readChar() == '{')
+                    {
+                        if (!createNamespace(stream, name, value, parentID, space))
+                            return false;
+                    }
+                    else
+                    {
+                        stream->seek(-1);
+
+                        // Store "name value" as a name/value pair, or even just "name".
+                        space->properties.push_back(PropertiesPair(name, value ? value : ""));
+                    }
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+static PropertiesNamespace* findNamespace(PropertiesNamespace* space, const std::string& id)
+{
+    // Depth-first search by ID, matching Properties::getNamespace().
+    for (size_t i = 0; i < space->namespaces.size(); ++i)
+    {
+        PropertiesNamespace* child = space->namespaces[i];
+        if (child->id == id)
+            return child;
+
+        child = findNamespace(child, id);
+        if (child)
+            return child;
+    }
+    return NULL;
+}
+
+static PropertiesNamespace* copyNamespace(const PropertiesNamespace* space)
+{
+    // Like the runtime copy constructor, variables are not copied.
+    PropertiesNamespace* copy = new PropertiesNamespace();
+    copy->name = space->name;
+    copy->id = space->id;
+    copy->parentID = space->parentID;
+    copy->properties = space->properties;
+    copy->parent = space->parent;
+    for (size_t i = 0; i < space->namespaces.size(); ++i)
+    {
+        copy->namespaces.push_back(copyNamespace(space->namespaces[i]));
+    }
+    return copy;
+}
+
+static const char* getVariable(const PropertiesNamespace* space, const char* name)
+{
+    for (const PropertiesNamespace* current = space; current; current = current->parent)
+    {
+        for (size_t i = 0; i < current->variables.size(); ++i)
+        {
+            if (current->variables[i].first == name)
+                return current->variables[i].second.c_str();
+        }
+    }
+    return NULL;
+}
+
+static void mergeNamespace(PropertiesNamespace* derived, const PropertiesNamespace* overrides)
+{
+    // Overwrite or add each property found in the overrides.
+    // Like Properties::mergeWith(), a value that references a variable is replaced by the variable's value.
+    for (size_t i = 0; i < overrides->properties.size(); ++i)
+    {
+        const PropertiesPair& property = overrides->properties[i];
+        std::string value = property.second;
+        char variable[256];
+        if (isVariable(value.c_str(), variable, 256))
+        {
+            const char* variableValue = getVariable(overrides, variable);
+            value = variableValue ? variableValue : "";
+        }
+
+        bool found = false;
+        for (size_t j = 0; j < derived->properties.size() && !found; ++j)
+        {
+            if (derived->properties[j].first == property.first)
+            {
+                derived->properties[j].second = value;
+                found = true;
+            }
+        }
+        if (!found)
+        {
+            derived->properties.push_back(PropertiesPair(property.first, value));
+        }
+    }
+
+    // Merge all common nested namespaces, add new ones.
+    for (size_t i = 0; i < overrides->namespaces.size(); ++i)
+    {
+        const PropertiesNamespace* overridesNamespace = overrides->namespaces[i];
+        bool merged = false;
+        for (size_t j = 0; j < derived->namespaces.size(); ++j)
+        {
+            PropertiesNamespace* derivedNamespace = derived->namespaces[j];
+            if (derivedNamespace->name == overridesNamespace->name && derivedNamespace->id == overridesNamespace->id)
+            {
+                mergeNamespace(derivedNamespace, overridesNamespace);
+                merged = true;
+            }
+        }
+        if (!merged)
+        {
+            derived->namespaces.push_back(copyNamespace(overridesNamespace));
+        }
+    }
+}
+
+static void resolveInheritance(PropertiesNamespace* space, const char* id = NULL);
+
+static void resolveDerived(PropertiesNamespace* space, PropertiesNamespace* derived)
+{
+    // Namespaces can be defined like so: "name id : parentID { }".
+    // Data from the parent namespace is merged into the child.
+    if (!derived->parentID.empty())
+    {
+        PropertiesNamespace* parent = findNamespace(space, derived->parentID);
+        if (parent)
+        {
+            resolveInheritance(space, parent->id.c_str());
+
+            PropertiesNamespace* overrides = copyNamespace(derived);
+
+            for (size_t i = 0; i < derived->namespaces.size(); ++i)
+            {
+                delete derived->namespaces[i];
+            }
+            derived->namespaces.clear();
+
+            derived->properties = parent->properties;
+            for (size_t i = 0; i < parent->namespaces.size(); ++i)
+            {
+                derived->namespaces.push_back(copyNamespace(parent->namespaces[i]));
+            }
+
+            mergeNamespace(derived, overrides);
+            delete overrides;
+        }
+    }
+
+    resolveInheritance(derived);
+}
+
+static void resolveInheritance(PropertiesNamespace* space, const char* id)
+{
+    if (id)
+    {
+        PropertiesNamespace* derived = findNamespace(space, id);
+        if (derived)
+            resolveDerived(space, derived);
+    }
+    else
+    {
+        for (size_t i = 0; i < space->namespaces.size(); ++i)
+        {
+            resolveDerived(space, space->namespaces[i]);
+        }
+    }
+}
+
+static unsigned int addString(std::map<std::string, unsigned int>& indices, std::vector<const std::string*>& strings, const std::string& str)
+{
+    std::map<std::string, unsigned int>::iterator itr = indices.find(str);
+    if (itr != indices.end())
+        return itr->second;
+
+    unsigned int index = (unsigned int)strings.size();
+    itr = indices.insert(std::make_pair(str, index)).first;
+    strings.push_back(&itr->first);
+    return index;
+}
+
+static void addStrings(std::map<std::string, unsigned int>& indices, std::vector<const std::string*>& strings, const PropertiesNamespace* space)
+{
+    addString(indices, strings, space->name);
+    addString(indices, strings, space->id);
+    addString(indices, strings, space->parentID);
+    for (size_t i = 0; i < space->variables.size(); ++i)
+    {
+        addString(indices, strings, space->variables[i].first);
+        addString(indices, strings, space->variables[i].second);
+    }
+    for (size_t i = 0; i < space->properties.size(); ++i)
+    {
+        addString(indices, strings, space->properties[i].first);
+        addString(indices, strings, space->properties[i].second);
+    }
+    for (size_t i = 0; i < space->namespaces.size(); ++i)
+    {
+        addStrings(indices, strings, space->namespaces[i]);
+    }
+}
+
+/**
+ * Parses the comma-separated numbers at the start of a value the same way the
+ * runtime's sscanf("%f,%f,...") calls do.
+ */
+static unsigned char parseNumbers(const std::string& value, float* numbers)
+{
+    // Variable references are resolved when the property is read, so they can't be parsed now.
+    char variable[256];
+    if (isVariable(value.c_str(), variable, 256))
+        return PROPERTIES_NUMBERS_UNPARSED;
+
+    const char* str = value.c_str();
+    unsigned char count = 0;
+    while (count < PROPERTIES_NUMBERS_MAX)
+    {
+        int length;
+        if (sscanf(str, "%f%n", &numbers[count], &length) != 1)
+            break;
+        ++count;
+        str += length;
+        if (*str != ',')
+            break;
+        ++str;
+    }
+    return count;
+}
+
+static void writeNamespace(const std::map<std::string, unsigned int>& indices, const PropertiesNamespace* space, FILE* file)
+{
+    write(indices.find(space->name)->second, file);
+    write(indices.find(space->id)->second, file);
+    write(indices.find(space->parentID)->second, file);
+
+    write((unsigned int)space->variables.size(), file);
+    for (size_t i = 0; i < space->variables.size(); ++i)
+    {
+        write(indices.find(space->variables[i].first)->second, file);
+        write(indices.find(space->variables[i].second)->second, file);
+    }
+
+    write((unsigned int)space->properties.size(), file);
+    for (size_t i = 0; i < space->properties.size(); ++i)
+    {
+        const PropertiesPair& property = space->properties[i];
+        write(indices.find(property.first)->second, file);
+        write(indices.find(property.second)->second, file);
+
+        float numbers[PROPERTIES_NUMBERS_MAX];
+        unsigned char count = parseNumbers(property.second, numbers);
+        write(count, file);
+        if (count != PROPERTIES_NUMBERS_UNPARSED)
+        {
+            write(numbers, count, file);
+        }
+    }
+
+    write((unsigned int)space->namespaces.size(), file);
+    for (size_t i = 0; i < space->namespaces.size(); ++i)
+    {
+        writeNamespace(indices, space->namespaces[i], file);
+    }
+}
+
+int writeProperties(const char* inFilePath, const char* outFilePath)
+{
+    std::ifstream in(inFilePath, std::ios::in | std::ios::binary);
+    if (!in)
+    {
+        LOG(1, "Failed to open file: '%s'\n", inFilePath);
+        return -1;
+    }
+    std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    PropertiesNamespace root;
+    PropertiesStream stream(text);
+    if (!readNamespace(&stream, &root))
+    {
+        LOG(1, "Failed to parse properties file: '%s'\n", inFilePath);
+        return -1;
+    }
+    resolveInheritance(&root);
+
+    // Every name, ID and value is written once to a string table and referenced by index.
+    std::map<std::string, unsigned int> indices;
+    std::vector<const std::string*> strings;
+    addStrings(indices, strings, &root);
+
+    FILE* file = fopen(outFilePath, "wb");
+    if (file == NULL)
+    {
+        LOG(1, "Failed to open file for writing: '%s'\n", outFilePath);
+        return -1;
+    }
+
+    // File header and version.
+    char identifier[] = { '\xAB', 'G', 'P', 'P', '\xBB', '\r', '\n', '\x1A', '\n' };
+    fwrite(identifier, 1, sizeof(identifier), file);
+    write((unsigned char)PROPERTIES_VERSION_MAJOR, file);
+    write((unsigned char)PROPERTIES_VERSION_MINOR, file);
+
+    write((unsigned int)strings.size(), file);
+    for (size_t i = 0; i < strings.size(); ++i)
+    {
+        write(*strings[i], file);
+    }
+
+    writeNamespace(indices, &root, file);
+
+    fclose(file);
+    return 0;
+}
+
+}
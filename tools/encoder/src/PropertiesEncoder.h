@@ -0,0 +1,23 @@
+#ifndef PROPERTIESENCODER_H_
+#define PROPERTIESENCODER_H_
+
+namespace gameplay
+{
+
+/**
+ * Compiles a text properties file (.material, .scene, .form, etc.) to the binary
+ * format that Properties::create() loads without parsing.
+ *
+ * Namespace inheritance is resolved and numeric values are parsed while compiling,
+ * following the same rules as the runtime Properties class.
+ *
+ * @param inFilePath Input file path to the text properties file.
+ * @param outFilePath Output file path to write the compiled properties to.
+ *
+ * @return 0 if successful, -1 if error.
+ */
+int writeProperties(const char* inFilePath, const char* outFilePath);
+
+}
+
+#endif
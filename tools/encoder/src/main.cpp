@@ -4,6 +4,8 @@
 #include "GPBDecoder.h"
 #include "EncoderArguments.h"
 #include "NormalMapGenerator.h"
+#include "PropertiesEncoder.h"
+#include "ArchiveEncoder.h"
 #include "Font.h"
 
 using namespace gameplay;
@@ -94,6 +96,12 @@ int main(int argc, const char** argv)
         return -1;
     }
 
+    if (arguments.archiveEnabled())
+    {
+        LOG(1, "Packing directory: %s\n", arguments.getFilePathPointer());
+        return writeArchive(arguments.getFilePath().c_str(), arguments.getOutputFilePath().c_str(), arguments.archiveCompressionEnabled());
+    }
+
     // File exists
     LOG(1, "Encoding file: %s\n", arguments.getFilePathPointer());
 
@@ -159,6 +167,14 @@ int main(int argc, const char** argv)
             }
             break;
         }
+    case EncoderArguments::FILEFORMAT_PROPERTIES:
+        {
+            if (writeProperties(arguments.getFilePath().c_str(), arguments.getOutputFilePath().c_str()) != 0)
+            {
+                return -1;
+            }
+            break;
+        }
    default:
         {
             LOG(1, "Error: Unsupported file format: %s\n", arguments.getFilePathPointer());
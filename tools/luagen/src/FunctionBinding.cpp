@@ -988,34 +988,12 @@ static inline void outputReturnValue(ostream& o, const FunctionBinding& b, int i
         break;
     case FunctionBinding::Param::TYPE_OBJECT:
     case FunctionBinding::Param::TYPE_CONSTRUCTOR:
-        o << "if (returnPtr)\n";
-        indent(o, indentLevel);
-        o << "{\n";
-        indent(o, indentLevel + 1);
-        o << LUA_OBJECT << "* object = (" << LUA_OBJECT << "*)lua_newuserdata(state, sizeof(" << LUA_OBJECT << "));\n";
-        indent(o, indentLevel + 1);
-        o << "object->instance = returnPtr;\n";
-        indent(o, indentLevel + 1);
-        o << "object->owns = ";
+        o << "gameplay::ScriptUtil::pushObject(state, returnPtr, \"" << Generator::getInstance()->getUniqueNameFromRef(b.returnParam.info) << "\", ";
         if (b.own || (b.returnParam.type == FunctionBinding::Param::TYPE_OBJECT && b.returnParam.kind == FunctionBinding::Param::KIND_VALUE))
             o << "true";
         else
             o << "false";
-        o << ";\n";
-        indent(o, indentLevel + 1);
-        o << "luaL_getmetatable(state, \"" << Generator::getInstance()->getUniqueNameFromRef(b.returnParam.info) << "\");\n";
-        indent(o, indentLevel + 1);
-        o << "lua_setmetatable(state, -2);\n";
-        indent(o, indentLevel);
-        o << "}\n";
-        indent(o, indentLevel);
-        o << "else\n";
-        indent(o, indentLevel);
-        o << "{\n";
-        indent(o, indentLevel + 1);
-        o << "lua_pushnil(state);\n";
-        indent(o, indentLevel);
-        o << "}\n";
+        o << ");\n";
         break;
     case FunctionBinding::Param::TYPE_DESTRUCTOR:
     case FunctionBinding::Param::TYPE_VOID: